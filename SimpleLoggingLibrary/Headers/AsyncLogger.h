@@ -3,13 +3,31 @@
 // SLL
 #include "LoggerBase.h"
 #include "ConfigPackage.h"
+#include "DeferredFormat.h"
+#include "Interfaces/IAsyncExecutor.h"
+#include "LatencyHistogram.h"
+#include "MemoryBudget.h"
+#include "MessageCoalescer.h"
+#include "NumaAllocator.h"
+#include "PayloadPool.h"
+#include "RateLimiter.h"
+#include "SignalSafeRing.h"
+#include "SinkWorkerLogger.h"
+#include "SpillFile.h"
 
 // STL
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
-#include <queue>
+#include <vector>
 
 
 namespace SLL
@@ -19,8 +37,9 @@ namespace SLL
     //  Class   - AsyncLogger
     //
     //  Purpose - Provide a thread-safe wrapper around an arbitrary SLL logger object.
-    //            Note: AsyncLogger includes own worker thread that performs the actual logging.
-    //                  
+    //            Note: AsyncLogger includes own worker thread that performs the actual logging,
+    //                  unless the ConfigPackage specifies an executor (e.g., a shared AsyncWorkerPool).
+    //                  Loggers are per-process - child processes never inherit a logger's queue or worker.
     //
     ///
     class AsyncLogger : public virtual LoggerBase, public virtual ILogger
@@ -29,33 +48,132 @@ namespace SLL
         AsyncLogger(AsyncLogger&&) = delete;
         AsyncLogger& operator=(AsyncLogger&&) = delete;
 
+        // Crash hook - calls DrainOnCrash.
+        friend class CrashDrain;
+
+    public:
+        // Message storage handed out by Reserve (see below).
+        class Reservation;
+
+        // What LogAsync reports about its message.
+        enum class LogAsyncResult : uint8_t
+        {
+            Durable,        // Written and flushed.
+            Suppressed,     // Rate limited or below every sink's threshold - there was nothing to write.
+            NotWritten,     // Dropped, discarded at shutdown, or the sink failed.
+        };
+
     private:
+        /// Private Message Lanes \\\
+
+        // Each lane is its own FIFO queue - the priority lane is always drained first.
+        static constexpr size_t NormalLane = 0;     // INFO, WARN
+        static constexpr size_t PriorityLane = 1;   // ERROR, FATAL
+        static constexpr size_t LaneCount = 2;
+
+        using LaneCounts = std::array<uint64_t, LaneCount>;
+
         /// Private LogMessage Class \\\
 
         // Encapsulates minimum required log message data into a single package.
+        // Short messages are stored inline; longer ones borrow a buffer from the logger's PayloadPool.
+        // Deferred messages keep their format pointer and store captured arguments in the payload instead of text.
+        // The event time and a process-wide sequence number are captured at submission, for the worker to render from.
+        // With latency histograms, the time it was handed to the logger is kept too (see ConfigPackage::SetAsyncLatencyHistograms).
+        // A message charged to a memory budget gives the charge back when it's destroyed (i.e., written or discarded).
         class LogMessage
         {
+            // Empty reservations hold an empty message.
+            friend class AsyncLogger::Reservation;
+
             /// No copy.
             LogMessage(const LogMessage&) = delete;
             LogMessage& operator=(const LogMessage&) = delete;
 
+        public:
+            // Inline payload capacity, in characters (256 bytes).
+            static constexpr size_t InlineLength = 256 / sizeof(utf16);
+
         private:
             VerbosityLevel lvl;
-            std::unique_ptr<utf16[ ]> str;
             std::thread::id tid;
+            LogClock::rep ticks;
+            std::chrono::steady_clock::rep queuedTicks;
+            uint64_t seq;
+            size_t len;
+            const utf8* pNarrowFormat;
+            const utf16* pWideFormat;
+            PayloadPool* pPool;
+            PayloadPool::Buffer pooledStr;
+            MemoryBudget* pBudget;
+            size_t charged;
+            utf16 inlineStr[InlineLength];
 
             LogMessage( ) noexcept :
                 lvl(VerbosityLevel::MAX),
-                str(nullptr),
-                tid(std::thread::id( ))
+                tid(std::thread::id( )),
+                ticks(0),
+                queuedTicks(0),
+                seq(0),
+                len(0),
+                pNarrowFormat(nullptr),
+                pWideFormat(nullptr),
+                pPool(nullptr),
+                pBudget(nullptr),
+                charged(0)
             { }
 
+            void ReleasePayload( ) noexcept
+            {
+                if ( pPool )
+                {
+                    pPool->Release(pooledStr);
+                    pPool = nullptr;
+                }
+
+                if ( pBudget )
+                {
+                    pBudget->Release(charged);
+                    pBudget = nullptr;
+                    charged = 0;
+                }
+            }
+
         public:
-            LogMessage(const VerbosityLevel& l, std::unique_ptr<utf16[ ]>&& s, const std::thread::id& t) noexcept :
-                lvl(l),
-                str(std::move(s)),
-                tid(t)
-            { }
+            // Reserve storage for a message of l characters (including null-terminator).
+            LogMessage(const VerbosityLevel& v, const std::thread::id& t, const LogTime& time, PayloadPool& pool, const size_t l) :
+                lvl(v),
+                tid(t),
+                ticks(time.time_since_epoch( ).count( )),
+                queuedTicks(0),
+                seq(0),
+                len(l),
+                pNarrowFormat(nullptr),
+                pWideFormat(nullptr),
+                pPool(nullptr),
+                pBudget(nullptr),
+                charged(0)
+            {
+                if ( len > InlineLength )
+                {
+                    pooledStr = pool.Acquire(len);
+                    pPool = &pool;
+                }
+            }
+
+            // Reserve storage for l characters worth of captured arguments, to be formatted later with pFormat (narrow).
+            LogMessage(const VerbosityLevel& v, const std::thread::id& t, const LogTime& time, PayloadPool& pool, const size_t l, const utf8* pFormat) :
+                LogMessage(v, t, time, pool, l)
+            {
+                pNarrowFormat = pFormat;
+            }
+
+            // Reserve storage for l characters worth of captured arguments, to be formatted later with pFormat (wide).
+            LogMessage(const VerbosityLevel& v, const std::thread::id& t, const LogTime& time, PayloadPool& pool, const size_t l, const utf16* pFormat) :
+                LogMessage(v, t, time, pool, l)
+            {
+                pWideFormat = pFormat;
+            }
 
             LogMessage(LogMessage&& src) noexcept :
                 LogMessage( )
@@ -63,18 +181,47 @@ namespace SLL
                 *this = std::move(src);
             }
 
-            ~LogMessage( ) = default;
+            ~LogMessage( )
+            {
+                ReleasePayload( );
+            }
 
             LogMessage& operator=(LogMessage&& src) noexcept
             {
                 if ( this != &src )
                 {
+                    ReleasePayload( );
+
                     lvl = src.lvl;
-                    str = std::move(src.str);
                     tid = std::move(src.tid);
+                    ticks = src.ticks;
+                    queuedTicks = src.queuedTicks;
+                    seq = src.seq;
+                    len = src.len;
+                    pNarrowFormat = src.pNarrowFormat;
+                    pWideFormat = src.pWideFormat;
+                    pPool = src.pPool;
+                    pooledStr = std::move(src.pooledStr);
+                    pBudget = src.pBudget;
+                    charged = src.charged;
+
+                    // Only copy as much of the inline buffer as is actually in use.
+                    if ( !pPool && len != 0 )
+                    {
+                        memcpy(inlineStr, src.inlineStr, len * sizeof(utf16));
+                    }
 
                     src.lvl = VerbosityLevel::MAX;
                     src.tid = std::thread::id( );
+                    src.ticks = 0;
+                    src.queuedTicks = 0;
+                    src.seq = 0;
+                    src.len = 0;
+                    src.pNarrowFormat = nullptr;
+                    src.pWideFormat = nullptr;
+                    src.pPool = nullptr;
+                    src.pBudget = nullptr;
+                    src.charged = 0;
                 }
 
                 return *this;
@@ -85,15 +232,324 @@ namespace SLL
                 return lvl;
             }
 
+            utf16* GetBuffer( ) noexcept
+            {
+                return (pPool) ? pooledStr.Get( ) : inlineStr;
+            }
+
+            size_t GetLength( ) const noexcept
+            {
+                return len;
+            }
+
             const utf16* GetString( ) const noexcept
             {
-                return str.get( );
+                return (pPool) ? pooledStr.Get( ) : inlineStr;
             }
 
             const std::thread::id& GetThreadID( ) const noexcept
             {
                 return tid;
             }
+
+            // Event time, rebuilt from the raw clock ticks captured at submission.
+            LogTime GetTime( ) const noexcept
+            {
+                return LogTime(LogClock::duration(ticks));
+            }
+
+            // Bytes the message takes up while queued, beyond its queue slot - i.e., any pooled payload.
+            // - Note: Queue slots are charged with the storage of the queue they're in (see StorageCharge).
+            size_t GetFootprint( ) const noexcept
+            {
+                return (pPool) ? pooledStr.GetLength( ) * sizeof(utf16) : 0;
+            }
+
+            // Record that bytes were charged to budget, to be given back when the message is destroyed.
+            void SetCharge(MemoryBudget& budget, const size_t bytes) noexcept
+            {
+                pBudget = &budget;
+                charged = bytes;
+            }
+
+            // Time the message was handed to the logger (zero if it wasn't recorded).
+            std::chrono::steady_clock::rep GetQueuedTicks( ) const noexcept
+            {
+                return queuedTicks;
+            }
+
+            void SetQueuedTicks(const std::chrono::steady_clock::rep t) noexcept
+            {
+                queuedTicks = t;
+            }
+
+            uint64_t GetSequenceNumber( ) const noexcept
+            {
+                return seq;
+            }
+
+            void SetSequenceNumber(const uint64_t s) noexcept
+            {
+                seq = s;
+            }
+
+            // Shrink the message to the first l characters (including null-terminator) of its storage.
+            void SetLength(const size_t l) noexcept
+            {
+                len = l;
+            }
+
+            bool IsDeferred( ) const noexcept
+            {
+                return pNarrowFormat || pWideFormat;
+            }
+
+            const utf8* GetNarrowFormat( ) const noexcept
+            {
+                return pNarrowFormat;
+            }
+
+            const utf16* GetWideFormat( ) const noexcept
+            {
+                return pWideFormat;
+            }
+
+            // Captured arguments of a deferred message.
+            const uint8_t* GetCapture( ) const noexcept
+            {
+                return reinterpret_cast<const uint8_t*>(GetString( ));
+            }
+
+            size_t GetCaptureSize( ) const noexcept
+            {
+                return len * sizeof(utf16);
+            }
+        };
+
+        // Message queue - storage is placed in a NUMA node's local memory (or on the heap).
+        using MsgQueue = std::vector<LogMessage, NumaAllocator<LogMessage>>;
+
+        /// Private NodeQueues Struct \\\
+
+        // Message queues (one per lane) and payload buffers for the producers running on a single NUMA node.
+        // - Note: The pool is declared before the queues, so it outlives any queued messages.
+        struct NodeQueues
+        {
+            PayloadPool pool;
+            std::array<MsgQueue, LaneCount> queues;
+
+            explicit NodeQueues(const NumaHelper::Placement& placement) :
+                pool(placement),
+                queues{ MsgQueue(NumaAllocator<LogMessage>(placement)), MsgQueue(NumaAllocator<LogMessage>(placement)) }
+            { }
+        };
+
+    public:
+        /// Public Reservation Class \\\
+
+        // Message storage handed out by Reserve - fill it in place, then Commit it to queue the message.
+        // A reservation that's destroyed without being committed is dropped.  A rate limited one is empty
+        // (GetBuffer( ) returns nullptr) - there's nothing to fill in or commit.
+        // - Note: A reservation must not outlive the logger it came from - commit or drop it first.
+        class Reservation
+        {
+            friend class AsyncLogger;
+
+            /// No copy.
+            Reservation(const Reservation&) = delete;
+            Reservation& operator=(const Reservation&) = delete;
+
+        private:
+            const AsyncLogger* mpOwner;
+            size_t mCapacity;
+            LogMessage mMsg;
+
+            // Empty reservation - handed out for rate limited messages.
+            Reservation( ) noexcept :
+                mpOwner(nullptr),
+                mCapacity(0),
+                mMsg( )
+            { }
+
+            // Message storage is built in place - capacity characters, plus a null-terminator.
+            Reservation(const AsyncLogger& owner, const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, PayloadPool& pool, const size_t capacity) :
+                mpOwner(&owner),
+                mCapacity(capacity),
+                mMsg(lvl, tid, time, pool, capacity + 1)
+            { }
+
+        public:
+            Reservation(Reservation&& src) noexcept :
+                mpOwner(src.mpOwner),
+                mCapacity(src.mCapacity),
+                mMsg(std::move(src.mMsg))
+            {
+                src.mpOwner = nullptr;
+                src.mCapacity = 0;
+            }
+
+            ~Reservation( ) = default;
+
+            Reservation& operator=(Reservation&& src) noexcept
+            {
+                if ( this != &src )
+                {
+                    mpOwner = src.mpOwner;
+                    mCapacity = src.mCapacity;
+                    mMsg = std::move(src.mMsg);
+
+                    src.mpOwner = nullptr;
+                    src.mCapacity = 0;
+                }
+
+                return *this;
+            }
+
+            // Returns writable message storage - holds GetCapacity( ) characters, plus a null-terminator.
+            // Returns nullptr once the reservation has been committed, or if it was rate limited.
+            utf16* GetBuffer( ) noexcept
+            {
+                return (mpOwner) ? mMsg.GetBuffer( ) : nullptr;
+            }
+
+            // Returns maximum message length, in characters (not counting the null-terminator).
+            size_t GetCapacity( ) const noexcept
+            {
+                return mCapacity;
+            }
+
+            // Queue the first length characters of the buffer as the message (null-terminated for you).
+            // Returns false if the message was dropped (e.g., the queue was full).
+            bool Commit(const size_t length);
+        };
+
+    private:
+        /// Private FlushWaiter Struct \\\
+
+        // Pending flush barrier - completed once the worker has written message number targets[lane] of every lane.
+        // Completion goes to onFlushed if set, otherwise to the promise.
+        struct FlushWaiter
+        {
+            LaneCounts targets;
+            std::promise<void> promise;
+            std::function<void(bool)> onFlushed;
+        };
+
+        /// Private Memory Budget Types \\\
+
+        // Queue and staging storage (in bytes) charged to the memory budget - given back when the logger goes away.
+        struct StorageCharge
+        {
+            MemoryBudget* const pBudget;
+            std::atomic<size_t> bytes { 0 };
+
+            explicit StorageCharge(MemoryBudget* pMemoryBudget) noexcept :
+                pBudget(pMemoryBudget)
+            { }
+
+            ~StorageCharge( )
+            {
+                if ( pBudget )
+                {
+                    pBudget->Release(bytes.load(std::memory_order_relaxed));
+                }
+            }
+        };
+
+        /// Private Lock Types \\\
+
+        // std::mutex that knows which thread holds it - lets the crash hook skip a lock the crashing thread already holds,
+        // rather than trying to take it a second time.
+        class TrackedMutex
+        {
+        private:
+            std::mutex mMutex;
+            std::atomic<std::thread::id> mOwner { std::thread::id( ) };
+
+        public:
+            void lock( )
+            {
+                mMutex.lock( );
+                mOwner.store(std::this_thread::get_id( ), std::memory_order_relaxed);
+            }
+
+            bool try_lock( ) noexcept
+            {
+                if ( !mMutex.try_lock( ) )
+                {
+                    return false;
+                }
+
+                mOwner.store(std::this_thread::get_id( ), std::memory_order_relaxed);
+                return true;
+            }
+
+            void unlock( ) noexcept
+            {
+                mOwner.store(std::thread::id( ), std::memory_order_relaxed);
+                mMutex.unlock( );
+            }
+
+            // Returns true if the calling thread holds the lock.
+            bool HeldByCurrentThread( ) const noexcept
+            {
+                return mOwner.load(std::memory_order_relaxed) == std::this_thread::get_id( );
+            }
+        };
+
+        /// Private Thread Staging Types \\\
+
+        // A producer thread's staged messages (see ConfigPackage::SetAsyncThreadStagingSize).
+        // - Note: The mutex is only contended when the worker sweeps up stale messages, or someone flushes.
+        struct ThreadStaging
+        {
+            TrackedMutex mutex;
+            std::vector<LogMessage> msgs;
+            std::chrono::steady_clock::time_point firstStaged;
+            std::atomic<bool> bOrphaned { false };
+        };
+
+        // The calling thread's staging buffers, by logger ID - marks them orphaned when the thread exits.
+        struct ThreadStagingCache
+        {
+            std::vector<std::pair<uint64_t, std::weak_ptr<ThreadStaging>>> entries;
+
+            ~ThreadStagingCache( );
+        };
+
+        /// Private Latency Types \\\
+
+        // Latency histograms (see ConfigPackage::SetAsyncLatencyHistograms), and what the last summary covered up to.
+        // - Note: summarized and lastSummary are only touched by whichever thread is currently writing batches.
+        struct LatencyHistograms
+        {
+            LatencyHistogram queueWait;
+            LatencyHistogram sinkWrite;
+            LatencyHistogram logCall;
+            LatencyStats summarized;
+            std::chrono::steady_clock::time_point lastSummary;
+        };
+
+        /// Private Executor Types \\\
+
+        // Shared with the work posted to the executor, so work that runs after we're gone is harmless.
+        // - Note: bRunning keeps passes from overlapping - a pass that finds another one running leaves the work to it
+        //         (it re-posts itself while there's more), rather than tying up an executor thread waiting on it.
+        //         The mutex is only held to check and flip it, never for the length of a pass.
+        struct ExecutorState
+        {
+            std::mutex mutex;
+            std::condition_variable idleCV;
+            const AsyncLogger* pOwner;
+            bool bRunning;
+        };
+
+        // What we've posted to the executor (guarded by mMsgQueueMutex).
+        enum class DrainState : uint8_t
+        {
+            Idle,       // Nothing posted.
+            Delayed,    // Pass posted to run once the batch latency passes.
+            Posted,     // Pass posted to run right away (or running).
         };
 
         /// Private Data Members \\\
@@ -101,29 +557,234 @@ namespace SLL
         // Logger Data
         OptionFlag mOptionMask;
         std::shared_ptr<ILogger> mpLogger;
-        mutable size_t mSuccessCounter;
-        mutable size_t mFailCounter;
-        
-        // Message Queue
-        mutable std::queue<LogMessage> mMsgQueue;
-        mutable std::mutex mMsgQueueMutex;
+
+        // Sink Delivery Queues (null == sinks written directly by the worker)
+        // - Note: Same object as mpLogger when set - kept typed so per-batch flushes can leave the queued sinks alone.
+        std::shared_ptr<SinkWorkerLogger> mpSinkWorkers;
+
+        // Batching Settings (latency 0 == write messages as they arrive, otherwise hold a batch until it fills or the latency passes)
+        const std::chrono::microseconds mBatchLatency;
+        const size_t mBatchSize;
+        mutable std::atomic<bool> mFlushRequested;
+
+        // Deferred Formatting (formatted on the worker - format strings must outlive their queued messages)
+        const bool mDeferFormatting;
+
+        // Crash Handling (registered with CrashDrain)
+        // - Note: mSinkOwner is the thread writing to the sink - the worker claims it for each batch, the crash hook for good.
+        // - Note: The crash hook's buffers are sized when we register, so it doesn't have to allocate them mid-crash.
+        const bool mDrainOnCrash;
+        mutable std::atomic<std::thread::id> mSinkOwner;
+        mutable MsgQueue mCrashBatch;
+        mutable std::basic_string<utf16> mCrashRenderBuffer;
+
+        // LogSignalSafe Messages (null == LogSignalSafe disabled)
+        const std::unique_ptr<SignalSafeRing> mpSignalSafeRing;
+        mutable std::basic_string<utf16> mRenderBuffer;
+
+        // Message Queues and Payload Buffers (one set per NUMA node, or a single set when not NUMA-aware)
+        // - Note: A single set is double-buffered with the worker's batch vector, so capacity is reused rather than reallocated.
+        //         Node queues are merged into the batch instead, so their storage never leaves its node.
+        // - Note: mMsgQueueSize counts the messages in every lane, mLaneSizes the messages in each lane (across nodes).
+        // - Note: mMsgQueueHighWatermark is the most mMsgQueueSize has ever been (see GetStats).
+        const std::vector<std::unique_ptr<NodeQueues>> mNodes;
+        mutable TrackedMutex mMsgQueueMutex;
         mutable std::atomic<size_t> mMsgQueueSize;
+        mutable std::atomic<size_t> mMsgQueueHighWatermark;
+        mutable LaneCounts mLaneSizes;
+        mutable LaneCounts mEnqueuedCounts;
+
+        // Queue Limit (0 == unbounded) and Spill File (null == normal messages are dropped once the queue is full)
+        // - Note: The spill file has its own lock, so its I/O never holds up the queue.  Messages headed for it wait in
+        //         mSpillOutbox (guarded by mMsgQueueMutex) until they're appended, once the queue lock has been released -
+        //         mSpillBatch (guarded by mSpillMutex) is what they're appended from.
+        // - Note: mSpilledCount (guarded by mMsgQueueMutex) counts messages in the outbox or the file - they're also counted
+        //         in mMsgQueueSize.  mSpillLost counts outbox messages that couldn't be appended, for the worker to write off.
+        // - Note: Lock order is mSpillMutex, then mMsgQueueMutex.
+        // - Note: mQueueReserve is how many messages each queue is sized for up front - a batch's worth, or a full queue's
+        //         worth when prefaulted or placed on a NUMA node (growing would mean fresh, unfaulted memory, or another
+        //         node allocation).
+        const size_t mQueueCapacity;
+        const size_t mQueueReserve;
+        const std::unique_ptr<SpillFile> mpSpillFile;
+        mutable TrackedMutex mSpillMutex;
+        mutable std::vector<LogMessage> mSpillOutbox;
+        mutable std::vector<LogMessage> mSpillBatch;
+        mutable size_t mSpilledCount;
+        mutable std::atomic<bool> mSpillPending;
+        mutable std::atomic<size_t> mSpillLost;
+
+        // Thread Staging (0 == disabled)
+        // - Note: Threads that log in bursts take the queue lock once per burst.  A thread's staged messages are handed off once
+        //         its buffer fills, a WARN or above arrives, FlushThread or a flush is called, or they're StagedMsgMaxAge old -
+        //         on an executor, that last only happens on the logger's next pass.  They're numbered once they reach the queue.
+        // - Note: The ID tells this logger's staging buffers apart from those of an earlier logger at the same address.
+        // - Note: Lock order is mStagingMutex, then a ThreadStaging's mutex, then mSpillMutex, then mMsgQueueMutex.
+        const size_t mThreadStagingSize;
+        const uint64_t mInstanceId;
+        mutable TrackedMutex mStagingMutex;
+        mutable std::vector<std::shared_ptr<ThreadStaging>> mStagingBuffers;
+
+        // Memory Budget (null == unbounded), shared with other loggers
+        // - Note: Queue, batch and staging buffer storage is charged to the budget as it grows and shrinks (see ChargeStorage).
+        // - Note: With a budget (and memory that isn't prefaulted), the worker frees idle pool and queue memory once it's
+        //         been quiet for IdleTrimDelay - mLastBatchTime and mIdleTrimmed are only touched by the worker.
+        const std::shared_ptr<MemoryBudget> mpBudget;
+        mutable StorageCharge mStorageCharge;
+        const bool mTrimIdleMemory;
+        mutable std::chrono::steady_clock::time_point mLastBatchTime;
+        mutable bool mIdleTrimmed;
+
+        // Latency Histograms (null == disabled) and Summary Interval (0 == no summaries)
+        // - Note: Time spent queued, time the sink took to write each message, and how long each Log call took - so a slowdown
+        //         can be traced to the producers, the queue or the sink.  Costs a few clock reads per message, on both sides.
+        // - Note: Summaries are INFO messages covering what was written since the last one.  They're written between batches,
+        //         so a logger with nothing to write doesn't write them either.
+        const std::unique_ptr<LatencyHistograms> mpLatency;
+        const std::chrono::milliseconds mLatencySummaryInterval;
+
+        // Repeated Message Coalescing (null == disabled), only touched by the worker
+        const std::unique_ptr<MessageCoalescer> mpCoalescer;
+        mutable std::vector<MessageCoalescer::Summary> mCoalesceSummaries;
+
+        // Call-Site Rate Limiter (null == disabled), shared with other loggers
+        // - Note: Messages below every sink's threshold are never written, so they don't count against their call site.
+        const std::shared_ptr<RateLimiter> mpRateLimiter;
+        const VerbosityLevel mRateLimitThreshold;
+
+        // Flush Barriers (guarded by mMsgQueueMutex)
+        mutable std::vector<FlushWaiter> mFlushWaiters;
+
+        // Batch Storage (only touched by whichever thread is currently writing batches)
+        // - Note: Swapped with the queue, so its capacity is recycled between batches.
+        // - Note: mMergePositions tracks how far into each node's queue a merge has got.
+        mutable MsgQueue mBatch;
+        mutable std::vector<size_t> mMergePositions;
+        mutable LaneCounts mWrittenCounts;
+
+        // Executor (null == dedicated worker thread)
+        const std::shared_ptr<IAsyncExecutor> mpExecutor;
+        const std::shared_ptr<ExecutorState> mpExecutorState;
+        mutable DrainState mDrainState;
 
         // Worker Thread
+        // - Note: Affinity, priority and name are applied by the worker itself, when it starts.
+        const uint64_t mWorkerAffinity;
+        const int mWorkerPriority;
+        const std::basic_string<utf16> mWorkerName;
         mutable std::thread mWorkerThread;
         mutable std::atomic<bool> mTerminate;
-        mutable std::condition_variable mMsgCV;
+        mutable std::condition_variable_any mMsgCV;
+
+        // Shutdown - mShutdown stops new messages, mDiscard stops the worker writing the ones it already has.
+        // - Note: mBatchRemaining counts the messages of the current batch the worker hasn't started on yet.
+        mutable std::atomic<bool> mShutdown;
+        mutable std::atomic<bool> mDiscard;
+        mutable std::atomic<size_t> mBatchRemaining;
 
         /// Private Worker Methods \\\
 
         // Worker Thread Methods
         void WorkerLogLoop( ) const;
+        void ApplyWorkerSettings( ) const;
+        void ProcessBatch( ) const;
+        void WriteBatch( ) const;
+        bool ClaimSink( ) const noexcept;
+        void ReleaseSink( ) const noexcept;
+        void WakeWorker( ) const;
+        void StartWorker( ) const;
+        void StopWorker( ) const;
+        size_t ClaimBatchMsgs(const size_t count) const noexcept;
+        void RunExecutorPass( ) const;
+        static void RunPostedPass(ExecutorState& state);
         void WaitForMsgs( ) const;
         bool WaitPredicate( ) const noexcept;
+        bool BatchPredicate( ) const noexcept;
         bool TerminatePredicate( ) const;
-        void PushMsg(LogMessage&& msg) const;
-        std::queue<LogMessage> GetQueuedMsgs( ) const;
-        void LogMsgs(std::queue<LogMessage>&&) const;
+        bool PushMsg(LogMessage&& msg) const;
+        bool EnqueueMsg(LogMessage&& msg, const bool bOverflow = false) const;
+        bool OverflowMsg(LogMessage&& msg) const;
+        void TrimIdleMemory( ) const noexcept;
+        void ReserveQueueStorage( ) const;
+        size_t GetBatchReserve( ) const noexcept;
+        void ChargeStorage(const size_t slotsBefore, const size_t slotsAfter) const noexcept;
+        bool StageMsg(LogMessage&& msg) const;
+        bool HandOffStagedMsgs(ThreadStaging& staging) const;
+        void HandOffAllStagedMsgs(const bool bStaleOnly) const;
+        ThreadStaging& GetThreadStaging( ) const;
+        size_t GetQueuedMsgs(MsgQueue&) const;
+        void MergeNodeMsgs(const size_t lane, MsgQueue&) const;
+        bool SpillMsg(const LogMessage& msg) const;
+        void WriteSpillOutbox( ) const;
+        void AppendSpillBatch( ) const;
+        bool ReplaySpilledMsgs(MsgQueue&) const;
+        size_t ReadSpilledMsgs(MsgQueue&) const;
+        void LogMsgs(MsgQueue&, const bool bFlush) const;
+        void WriteLatencySummary( ) const;
+        bool CoalesceMsg(const LogRecord& record, const LogMessage& msg) const;
+        void WriteDueSummaries(const bool bAll) const;
+        void WriteCoalesceSummaries( ) const;
+        bool IsRateLimited(const VerbosityLevel& lvl, const void* pSite) const noexcept;
+        std::chrono::steady_clock::time_point StartLogCallTimer( ) const noexcept;
+        void StopLogCallTimer(const std::chrono::steady_clock::time_point& start) const noexcept;
+        bool LogFormatted(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const;
+        bool SubmitMsg(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const;
+        bool SubmitMsg(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const;
+        NodeQueues& GetLocalNode( ) const noexcept;
+        static NumaHelper::Placement GetQueuePlacement(const ConfigPackage& config) noexcept;
+        static std::vector<std::unique_ptr<NodeQueues>> BuildNodes(const ConfigPackage& config);
+        static std::unique_ptr<LatencyHistograms> BuildLatencyHistograms(const ConfigPackage& config);
+        static std::unique_ptr<SpillFile> BuildSpillFile(const ConfigPackage& config, const size_t queueCapacity);
+        static std::unique_ptr<MessageCoalescer> BuildCoalescer(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig);
+        static const std::shared_ptr<RateLimiter>& GetSharedRateLimiter(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig);
+        static std::shared_ptr<SinkWorkerLogger> BuildSinkWorkers(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig);
+        std::basic_string_view<utf16> RenderMsg(const LogMessage&, std::basic_string<utf16>& buf) const;
+        void CompleteFlushWaiters(const LaneCounts& written, const bool bAll) const;
+        void AddFlushWaiter(FlushWaiter&& waiter) const;
+        static void CompleteFlushWaiter(FlushWaiter& waiter, const bool bFlushed) noexcept;
+        static size_t GetLane(const VerbosityLevel& lvl) noexcept;
+
+        // Crash hook - stop accepting messages and write out whatever is still queued, until the deadline (see CrashDrain).
+        void DrainOnCrash(const std::chrono::steady_clock::time_point& deadline, const bool bSignal) const noexcept;
+        bool WriteLaneOnCrash(const size_t lane, const std::chrono::steady_clock::time_point& deadline, const bool bSignal) const noexcept;
+        bool WriteMsgOnCrash(const LogMessage& msg, const uint64_t seq, const std::chrono::steady_clock::time_point& deadline, const bool bSignal) const noexcept;
+        static bool TryLockOnCrash(TrackedMutex& mutex, const std::chrono::steady_clock::time_point& deadline) noexcept;
+
+        // Write out messages submitted via LogSignalSafe (worker only).
+        void DrainSignalSafeMsgs( ) const;
+
+        // How long the crash hook waits for the worker to finish writing its current batch (within the drain's budget).
+        static constexpr std::chrono::milliseconds CrashSinkWait { 250 };
+
+        // How much the crash hook's render buffer is sized for up front, in characters.
+        static constexpr size_t CrashRenderReserve = 4 * LogMessage::InlineLength;
+
+        // How many of the current batch's messages the worker claims at a time - Shutdown can stop it between claims.
+        static constexpr size_t BatchClaimSize = 32;
+
+        // Upper bound on the space preallocated for the spill file.
+        static constexpr uint64_t SpillPreallocationLimit = 64ull * 1024 * 1024;
+
+        // How often the worker checks for LogSignalSafe messages while it's otherwise idle.
+        static constexpr std::chrono::milliseconds SignalSafePollInterval { 10 };
+
+        // How long the worker must have been idle before it frees pool and queue memory (with a memory budget).
+        static constexpr std::chrono::milliseconds IdleTrimDelay { 1000 };
+
+        // How long messages may sit in a quiet thread's staging buffer before the worker hands them off itself.
+        static constexpr std::chrono::milliseconds StagedMsgMaxAge { 5 };
+
+        // LogSignalSafe implementation - allocation-free and lock-free.
+        template <class T>
+        bool LogSignalSafeInternal(const VerbosityLevel& lvl, const T* pFormat, va_list pArgs) const noexcept;
+
+        // LogAsync implementation.
+        template <class T>
+        bool LogAsyncInternal(std::function<void(LogAsyncResult)>&& onDurable, const VerbosityLevel& lvl, const T* pFormat, va_list pArgs) const;
+
+        // Producer helper for LogDeferredFormat - captures arguments without formatting them.
+        template <class T>
+        bool LogDeferred(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const T* pFormat, va_list pArgs) const;
 
     public:
         /// Constructors \\\
@@ -132,6 +793,8 @@ namespace SLL
         AsyncLogger(const ConfigPackage&);
 
         // Multiple-ConfigPackage Constructor [C]
+        // - Note: Both ConfigPackages must have the same rate limiter (if any), and the same coalescing settings (if both
+        //         enable coalescing) - throws std::invalid_argument otherwise.
         AsyncLogger(const ConfigPackage&, const ConfigPackage&);
 
         /// Destructor \\\
@@ -141,6 +804,7 @@ namespace SLL
         /// Public Methods \\\
 
         // Submit log message to stream(s) (variadic arguments).
+        // - Note: Returns false if the message was dropped because the queue was full (see ConfigPackage::SetAsyncQueueCapacity).
         bool Log(const VerbosityLevel& lvl, const utf8* pFormat, ...) const;
         bool Log(const VerbosityLevel& lvl, const utf16* pFormat, ...) const;
 
@@ -155,5 +819,90 @@ namespace SLL
         // Submit log message to stream(s) (va_list, explicit thread ID).
         bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, va_list pArgs) const;
         bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const;
+
+        // Submit log message to stream(s) (variadic arguments, explicit thread ID and event time).
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, ...) const;
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, ...) const;
+
+        // Submit log message to stream(s) (va_list, explicit thread ID and event time).
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const;
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const;
+
+        // Submit pre-formatted log record to stream(s) - message text is copied and written as-is.
+        bool WriteRecord(const LogRecord& record) const;
+
+        // Reserve storage for a message of up to maxLength characters, to be filled in place and then committed.
+        // The event time is captured now, like Log would.  pSite identifies the call site to the rate limiter,
+        // as Log's format string does (e.g., a string literal or static at the call site) - null is never limited.
+        // Returns an empty reservation if the message was rate limited.
+        // - Note: Long messages are written into a pooled buffer that's handed to the worker as-is - the text is never copied.
+        Reservation Reserve(const VerbosityLevel& lvl, const size_t maxLength, const void* pSite) const;
+
+        // Hand the calling thread's staged messages to the queue now, rather than waiting for its staging buffer to fill up.
+        // Returns false if any of them were dropped (e.g., the queue was full).  Doesn't wait for them to be written.
+        // - Note: Does nothing unless thread staging is enabled (see ConfigPackage::SetAsyncThreadStagingSize).
+        bool FlushThread( ) const;
+
+        // Wait until every message submitted before the call has been written and flushed.
+        // - Note: Partially-filled batches are written right away rather than waiting for the latency target.
+        // - Note: Every thread's staged messages are handed to the queue first.
+        bool Flush( ) const;
+
+        // Same as Flush( ), but gives up after the specified timeout.  Returns false on timeout or failure.
+        bool Flush(const std::chrono::milliseconds& timeout) const;
+
+        // Non-blocking Flush( ) - the returned future becomes ready once the barrier is reached.
+        // The future holds an exception if the underlying logger failed to flush.
+        std::future<void> FlushAsync( ) const;
+
+        // Non-blocking Flush( ) - onFlushed(success) is called once the barrier is reached.
+        // - Note: Usually called on the worker (or executor) thread, or a sink's delivery queue worker (see
+        //         ConfigPackage::SetAsyncSinkQueueCapacity) - it must not block waiting on this logger.
+        void FlushAsync(std::function<void(bool)> onFlushed) const;
+
+        // Submit log message to stream(s), then call onDurable(result) once it has been written and flushed.
+        // Messages that are rate limited, below every sink's threshold, or not queued at all (Log would return false) are
+        // reported right away, on the calling thread.
+        // - Note: Otherwise, same threading rules as FlushAsync(onFlushed).
+        bool LogAsync(std::function<void(LogAsyncResult)> onDurable, const VerbosityLevel& lvl, const utf8* pFormat, ...) const;
+        bool LogAsync(std::function<void(LogAsyncResult)> onDurable, const VerbosityLevel& lvl, const utf16* pFormat, ...) const;
+
+        // Submit log message from a signal handler - never allocates, locks, or throws.
+        // Uses SignalSafeFormat's restricted format (e.g., %d, %u, %x, %s, %p - no width or precision),
+        // and messages are truncated to SignalSafeRing::TextLength characters.
+        // Returns false if LogSignalSafe isn't enabled (see ConfigPackage::SetAsyncSignalSafeCapacity), the ring is full, or an argument is invalid.
+        // - Note: With an executor, messages are written with the logger's next pass (e.g., next Log or Flush).
+        bool LogSignalSafe(const VerbosityLevel& lvl, const utf8* pFormat, ...) const noexcept;
+        bool LogSignalSafe(const VerbosityLevel& lvl, const utf16* pFormat, ...) const noexcept;
+
+        // Returns a snapshot of the logger's statistics (lock-free).
+        // Accepted, dropped, failed and queue counts are this logger's own; filtered, written, bytes written, flushes
+        // and restore attempts come from the underlying logger, which is what does the filtering and writing.
+        // - Note: Written counts lines the underlying logger wrote, so coalesce summaries are included - and with
+        //         separate ConfigPackages, each stream counts its own writes (see DualLogger::GetStats).
+        // - Note: Dropped also counts messages a sink's delivery queue had no room for (see ConfigPackage::SetAsyncSinkQueueCapacity).
+        LogStats GetStats( ) const;
+
+        // Returns a snapshot of the logger's latency histograms (lock-free) - all empty unless they're enabled
+        // (see ConfigPackage::SetAsyncLatencyHistograms).
+        // - Note: With a sink delivery queue, the sink write ends once the message is in the sink's queue.
+        LatencyStats GetLatencyStats( ) const;
+
+        // Start the worker thread now, rather than with the first message (see also ConfigPackage::SetAsyncEagerStart).
+        // - Note: Does nothing if it's already running, or if the logger runs on an executor.
+        void Start( );
+
+        // Stop accepting messages, and write out the ones already submitted until the deadline passes.
+        // Returns number of messages discarded unwritten (0 if everything was written in time).
+        // - Note: Messages submitted afterwards are dropped (Log returns false).  Calling it again returns 0.
+        // - Note: Once out of time, the worker stops within BatchClaimSize messages, and sinks with a delivery queue stop
+        //         holding it up (records that don't fit are dropped, see ConfigPackage::SetAsyncSinkBlockWhenFull).
+        //         A write already in progress can't be interrupted, though - if an in-line sink is stuck, the destructor
+        //         still waits for it.  Give sinks that may stall a delivery queue (see ConfigPackage::SetAsyncSinkQueueCapacity).
+        // - Note: Messages still waiting in the LogSignalSafe ring aren't counted.
+        size_t Shutdown(const std::chrono::steady_clock::time_point& deadline);
+
+        // Same as Shutdown(deadline), with the deadline timeout from now.
+        size_t Shutdown(const std::chrono::milliseconds& timeout);
     };
 }
\ No newline at end of file
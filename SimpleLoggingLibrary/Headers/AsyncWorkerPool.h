@@ -0,0 +1,90 @@
+#pragma once
+
+// SLL
+#include "Interfaces/IAsyncExecutor.h"
+
+// STL
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - AsyncWorkerPool
+    //
+    //  Purpose - Fixed set of worker threads shared by any number of AsyncLogger objects.
+    //            Loggers post one pass (at most one batch) at a time and re-post themselves while
+    //            they still have work, so work is run first-come, first-served and busy loggers
+    //            can't starve quiet ones.  A logger only ever runs one pass at a time - a pass that
+    //            finds its logger busy returns right away, so it never holds a worker up.
+    //            Share a pool between loggers via ConfigPackage::SetAsyncExecutor.
+    //
+    ///
+    class AsyncWorkerPool : public IAsyncExecutor
+    {
+        /// No copy or move.
+        AsyncWorkerPool(const AsyncWorkerPool&) = delete;
+        AsyncWorkerPool(AsyncWorkerPool&&) = delete;
+        AsyncWorkerPool& operator=(const AsyncWorkerPool&) = delete;
+        AsyncWorkerPool& operator=(AsyncWorkerPool&&) = delete;
+
+    public:
+        using Clock = std::chrono::steady_clock;
+
+    private:
+        /// Private Types \\\
+
+        // Work that becomes ready once its due time passes.
+        struct DelayedWork
+        {
+            Clock::time_point due;
+            std::function<void( )> work;
+        };
+
+        /// Private Data Members \\\
+
+        std::vector<std::thread> mWorkers;
+        std::deque<std::function<void( )>> mReady;
+        std::vector<DelayedWork> mDelayed;
+
+        std::mutex mMutex;
+        std::condition_variable mWorkCV;
+        bool mTerminate;
+
+        /// Private Helper Methods \\\
+
+        // Worker thread main loop.
+        void WorkerLoop( );
+
+        // Move delayed work whose due time has passed into the ready queue.  Caller must hold mMutex.
+        void PromoteDueWork(const Clock::time_point& now);
+
+    public:
+        /// Constructor \\\
+
+        // Start workerCount threads (0 selects one per hardware thread).
+        explicit AsyncWorkerPool(const size_t workerCount = 0);
+
+        /// Destructor \\\
+
+        // Stop and join the workers - work that hasn't started yet is dropped.
+        ~AsyncWorkerPool( );
+
+        /// Public Methods \\\
+
+        // Returns number of worker threads.
+        size_t GetWorkerCount( ) const noexcept;
+
+        // Run work as soon as a worker is free.
+        void Post(std::function<void( )> work) override;
+
+        // Run work once delay has passed.
+        void PostAfter(const std::chrono::microseconds& delay, std::function<void( )> work) override;
+    };
+}
\ No newline at end of file
@@ -9,11 +9,20 @@
 #include "../CommonCode/Headers/CCStringUtil.h"
 
 // STL
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace SLL
 {
+    // Forward declarations - see Interfaces/IAsyncExecutor.h, MemoryBudget.h and RateLimiter.h.
+    class IAsyncExecutor;
+    class MemoryBudget;
+    class RateLimiter;
+
     ///
     //
     //  Class   - ConfigPackage
@@ -36,6 +45,73 @@ namespace SLL
         // UTF-16 string for target log filename.
         std::filesystem::path mLogFile;
 
+        // Number of messages written between periodic stream flushes (0 == no periodic flush).
+        size_t mFlushInterval;
+
+        // Maximum time the async worker will hold a partial batch before writing it.
+        std::chrono::microseconds mAsyncBatchLatency;
+
+        // Maximum number of messages the async worker will write per batch.
+        size_t mAsyncBatchSize;
+
+        // Executor for async loggers to run on, e.g., a shared AsyncWorkerPool (null == each async logger runs its own worker thread).
+        std::shared_ptr<IAsyncExecutor> mAsyncExecutor;
+
+        // Whether async loggers write out their queued messages if the process crashes (see CrashDrain).
+        bool mAsyncDrainOnCrash;
+
+        // Number of messages async loggers can hold for LogSignalSafe (0 == LogSignalSafe disabled).
+        size_t mAsyncSignalSafeCapacity;
+
+        // Maximum number of messages async loggers hold in memory (0 == unbounded).
+        size_t mAsyncQueueCapacity;
+
+        // File async loggers spill overflowing messages to (empty == drop them instead).
+        std::filesystem::path mAsyncSpillFile;
+
+        // Whether async loggers start their worker thread when they're built, rather than on the first message.
+        bool mAsyncEagerStart;
+
+        // CPUs the async worker thread may run on (0 == any CPU).
+        uint64_t mAsyncWorkerAffinity;
+
+        // Windows thread priority of the async worker thread (THREAD_PRIORITY_* value).
+        int mAsyncWorkerPriority;
+
+        // Name given to the async worker thread (empty == unnamed).
+        std::basic_string<utf16> mAsyncWorkerName;
+
+        // Whether async loggers keep a queue (and payload buffers) in each NUMA node's local memory.
+        bool mAsyncNumaAware;
+
+        // Whether async loggers back their queues with large pages.
+        bool mAsyncLargePages;
+
+        // Whether async loggers fault in (and lock) their queue and payload memory when they're built.
+        bool mAsyncPrefaultMemory;
+
+        // Number of messages each producer thread stages before handing them to the async queue (0 == no staging).
+        size_t mAsyncThreadStagingSize;
+
+        // Number of messages this sink's own delivery queue holds (0 == sink written directly by the async worker),
+        // and whether a full delivery queue makes the async worker wait for space rather than drop the message.
+        size_t mAsyncSinkQueueCapacity;
+        bool mAsyncSinkBlockWhenFull;
+
+        // Whether async loggers keep latency histograms, and how often they write a summary of them (0 == never).
+        bool mAsyncLatencyHistograms;
+        std::chrono::milliseconds mAsyncLatencySummaryInterval;
+
+        // Memory budget async loggers charge their queued messages to (null == unbounded).
+        std::shared_ptr<MemoryBudget> mAsyncMemoryBudget;
+
+        // Window repeated messages are coalesced within (0 == no coalescing), and whether messages from the same format string count as repeats.
+        std::chrono::milliseconds mCoalesceWindow;
+        bool mCoalesceByFormat;
+
+        // Rate limiter messages are checked against, by call site (null == no rate limiting).
+        std::shared_ptr<RateLimiter> mRateLimiter;
+
         /// Private Helper Methods \\\
 
         // Sanity checker for verbosity level arguments.
@@ -47,6 +123,24 @@ namespace SLL
         // Sanity check for option flag arguments.
         static void ValidateOptionFlag(const OptionFlag, const std::string&);
 
+        // Sanity check for async batch latency arguments.
+        static void ValidateAsyncBatchLatency(const std::chrono::microseconds, const std::string&);
+
+        // Sanity check for async batch size arguments.
+        static void ValidateAsyncBatchSize(const size_t, const std::string&);
+
+        // Sanity check for async worker affinity arguments.
+        static void ValidateAsyncWorkerAffinity(const uint64_t, const std::string&);
+
+        // Sanity checker for async worker thread priority arguments.
+        static void ValidateAsyncWorkerPriority(const int, const std::string&);
+
+        // Sanity check for async latency summary interval arguments.
+        static void ValidateAsyncLatencySummaryInterval(const std::chrono::milliseconds, const std::string&);
+
+        // Sanity check for coalescing window arguments.
+        static void ValidateCoalesceWindow(const std::chrono::milliseconds, const std::string&);
+
     public:
         /// Constructors \\\
 
@@ -94,6 +188,78 @@ namespace SLL
         // Returns configured target file.
         const std::filesystem::path& GetFile( ) const noexcept;
 
+        // Returns configured number of messages between periodic stream flushes.
+        size_t GetFlushInterval( ) const noexcept;
+
+        // Returns configured async worker batch latency target.
+        std::chrono::microseconds GetAsyncBatchLatency( ) const noexcept;
+
+        // Returns configured async worker maximum batch size.
+        size_t GetAsyncBatchSize( ) const noexcept;
+
+        // Returns configured async executor (null if none).
+        const std::shared_ptr<IAsyncExecutor>& GetAsyncExecutor( ) const noexcept;
+
+        // Returns whether async loggers drain their queues on a crash.
+        bool GetAsyncDrainOnCrash( ) const noexcept;
+
+        // Returns configured LogSignalSafe capacity.
+        size_t GetAsyncSignalSafeCapacity( ) const noexcept;
+
+        // Returns configured async queue capacity.
+        size_t GetAsyncQueueCapacity( ) const noexcept;
+
+        // Returns configured async spill file.
+        const std::filesystem::path& GetAsyncSpillFile( ) const noexcept;
+
+        // Returns whether async loggers start their worker thread when they're built.
+        bool GetAsyncEagerStart( ) const noexcept;
+
+        // Returns configured async worker thread CPU affinity mask.
+        uint64_t GetAsyncWorkerAffinity( ) const noexcept;
+
+        // Returns configured async worker thread priority.
+        int GetAsyncWorkerPriority( ) const noexcept;
+
+        // Returns configured async worker thread name.
+        const std::basic_string<utf16>& GetAsyncWorkerName( ) const noexcept;
+
+        // Returns whether async loggers keep per-NUMA-node queues.
+        bool GetAsyncNumaAware( ) const noexcept;
+
+        // Returns whether async loggers back their queues with large pages.
+        bool GetAsyncLargePages( ) const noexcept;
+
+        // Returns whether async loggers prefault their queue and payload memory.
+        bool GetAsyncPrefaultMemory( ) const noexcept;
+
+        // Returns configured async thread staging size.
+        size_t GetAsyncThreadStagingSize( ) const noexcept;
+
+        // Returns configured async sink delivery queue capacity.
+        size_t GetAsyncSinkQueueCapacity( ) const noexcept;
+
+        // Returns whether a full async sink delivery queue waits for space (rather than dropping the message).
+        bool GetAsyncSinkBlockWhenFull( ) const noexcept;
+
+        // Returns whether async loggers keep latency histograms.
+        bool GetAsyncLatencyHistograms( ) const noexcept;
+
+        // Returns configured async latency summary interval.
+        std::chrono::milliseconds GetAsyncLatencySummaryInterval( ) const noexcept;
+
+        // Returns configured async memory budget (null if none).
+        const std::shared_ptr<MemoryBudget>& GetAsyncMemoryBudget( ) const noexcept;
+
+        // Returns configured coalescing window.
+        std::chrono::milliseconds GetCoalesceWindow( ) const noexcept;
+
+        // Returns whether messages from the same format string are coalesced.
+        bool GetCoalesceByFormat( ) const noexcept;
+
+        // Returns configured rate limiter (null if none).
+        const std::shared_ptr<RateLimiter>& GetRateLimiter( ) const noexcept;
+
         /// Setters \\\
 
         // Sets color output for specified verbosity level.
@@ -108,6 +274,96 @@ namespace SLL
         // Specifies file to log to [M].
         void SetFile(std::filesystem::path&&);
 
+        // Sets number of messages between periodic stream flushes (0 disables periodic flushing).
+        void SetFlushInterval(const size_t);
+
+        // Sets maximum time the async worker may wait to fill a batch (0 disables batching).
+        void SetAsyncBatchLatency(const std::chrono::microseconds);
+
+        // Sets maximum number of messages the async worker will write per batch.
+        void SetAsyncBatchSize(const size_t);
+
+        // Sets executor for async loggers to run on (null gives each logger its own worker thread).
+        void SetAsyncExecutor(const std::shared_ptr<IAsyncExecutor>&);
+
+        // Sets whether async loggers drain their queues on a crash (std::terminate, abort, SIGSEGV, etc).
+        // - Note: Enabling this installs process-wide terminate and signal handlers when the first such logger is built.
+        //         Only CrashDrain::MaxLoggers loggers are drained at once - any more are built, but aren't drained.
+        void SetAsyncDrainOnCrash(const bool);
+
+        // Sets number of messages async loggers can hold for LogSignalSafe (0 disables LogSignalSafe).
+        // - Note: The space is allocated up front, when the logger is built.
+        void SetAsyncSignalSafeCapacity(const size_t);
+
+        // Sets maximum number of messages async loggers hold in memory (0 == unbounded).
+        // Once full, INFO and WARN messages go to the spill file (see SetAsyncSpillFile), or are dropped if there isn't one.
+        // - Note: ERROR and FATAL messages are always kept in memory.
+        void SetAsyncQueueCapacity(const size_t);
+
+        // Sets file async loggers spill overflowing messages to, for the worker to replay once it catches up.
+        // - Note: The file is scratch space, not a log - it's overwritten when the logger is built, and deleted with it.
+        //         Each logger needs a file of its own - building one on a file another logger is using throws.
+        void SetAsyncSpillFile(const std::filesystem::path&);
+
+        // Sets whether async loggers start their worker thread when they're built, so the first message doesn't pay for it.
+        // - Note: Has no effect on loggers that run on an executor.
+        void SetAsyncEagerStart(const bool);
+
+        // Sets CPUs the async worker thread may run on - bit N selects CPU N (0 lets it run on any CPU).
+        // E.g., pin the worker to a housekeeping core, away from latency-critical threads.
+        // - Note: 32-bit builds only accept CPUs 0-31 (the mask is a DWORD_PTR to Windows).
+        // - Note: Worker thread settings have no effect on loggers that run on an executor.
+        void SetAsyncWorkerAffinity(const uint64_t);
+
+        // Sets Windows thread priority of the async worker thread - one of the THREAD_PRIORITY_* levels:
+        // IDLE (-15), LOWEST (-2), BELOW_NORMAL (-1), NORMAL (0), ABOVE_NORMAL (1), HIGHEST (2) or TIME_CRITICAL (15).
+        void SetAsyncWorkerPriority(const int);
+
+        // Sets name given to the async worker thread (e.g., "sll-worker"), as shown by debuggers and profilers.
+        void SetAsyncWorkerName(const std::basic_string<utf16>&);
+
+        // Sets whether async loggers keep a queue (and payload buffers) in each NUMA node's local memory.
+        // Producers queue messages on the node they're running on, so their writes stay node-local; the worker merges the
+        // node queues back into submission order.
+        // - Note: Has no effect on machines with a single NUMA node.
+        void SetAsyncNumaAware(const bool);
+
+        // Sets whether async loggers back their queues with large pages, so a large queue needs far fewer TLB entries and page faults.
+        // - Note: Needs the "Lock pages in memory" privilege (SeLockMemoryPrivilege) - without it, normal pages are used.
+        void SetAsyncLargePages(const bool);
+
+        // Sets whether async loggers fault in and lock their queue and payload memory when they're built, so logging latency
+        // is flat from the first message (rather than paying a page fault per page on the first pass through the queue).
+        // - Note: The queues are sized for the queue capacity (see SetAsyncQueueCapacity), or the batch size if it's unbounded.
+        void SetAsyncPrefaultMemory(const bool);
+
+        // Sets number of messages each producer thread stages before handing them to the async queue together (0 disables staging).
+        void SetAsyncThreadStagingSize(const size_t);
+
+        // Sets number of messages this sink's own delivery queue holds, for a worker thread of its own to write (0 disables it).
+        void SetAsyncSinkQueueCapacity(const size_t);
+
+        // Sets whether a full delivery queue makes the async worker wait for space, rather than drop the message.
+        void SetAsyncSinkBlockWhenFull(const bool);
+
+        // Sets whether async loggers keep latency histograms (see AsyncLogger::GetLatencyStats).
+        void SetAsyncLatencyHistograms(const bool);
+
+        // Sets how often the async worker writes a latency summary to the log (0 disables summaries, otherwise enables histograms).
+        void SetAsyncLatencySummaryInterval(const std::chrono::milliseconds);
+
+        // Sets memory budget async loggers charge their queued messages to (null leaves them unbounded).
+        void SetAsyncMemoryBudget(const std::shared_ptr<MemoryBudget>&);
+
+        // Sets window repeated messages are coalesced within (0 disables coalescing - see MessageCoalescer).
+        void SetCoalesceWindow(const std::chrono::milliseconds);
+
+        // Sets whether messages from the same format string (i.e., call site) count as repeats, whatever their arguments.
+        void SetCoalesceByFormat(const bool);
+
+        // Sets rate limiter Log calls are checked against, per call site (null disables rate limiting - see RateLimiter).
+        void SetRateLimiter(const std::shared_ptr<RateLimiter>&);
+
         /// Public Methods \\\
 
         // Enables specified logger functionality.
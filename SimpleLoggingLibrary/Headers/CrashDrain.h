@@ -0,0 +1,78 @@
+#pragma once
+
+// STL
+#include <chrono>
+#include <cstddef>
+
+namespace SLL
+{
+    // Forward declaration - see AsyncLogger.h.
+    class AsyncLogger;
+
+    ///
+    //
+    //  Class   - CrashDrain
+    //
+    //  Purpose - Process-wide crash hook for AsyncLogger objects built with ConfigPackage::SetAsyncDrainOnCrash.
+    //            On std::terminate, abort (SIGABRT), SIGSEGV, SIGILL or SIGFPE, each registered logger stops
+    //            accepting messages and writes out whatever is still queued, before the original terminate
+    //            handler runs (or the signal is re-raised with its original handler).
+    //            Handlers are installed when the first logger registers - logging itself is unaffected.
+    //            Note: The drain is best effort.  Within DrainBudget it writes queued, spilled and staged messages
+    //                  (in that order), then flushes.  After a signal it skips deferred messages and the spill file,
+    //                  since reading them would allocate - the sinks still format prefixes and write through
+    //                  C++ streams, which may.  If a crash inside the allocator leaves the drain stuck, a watchdog
+    //                  thread ends the process once DrainTimeout has passed, rather than leave it hanging.
+    //
+    ///
+    class CrashDrain
+    {
+        /// Static Class - No Ctors, Dtor, or Assignment Allowed
+        CrashDrain( ) = delete;
+        CrashDrain(const CrashDrain&) = delete;
+        CrashDrain(CrashDrain&&) = delete;
+
+        ~CrashDrain( ) = delete;
+
+        CrashDrain& operator=(const CrashDrain&) = delete;
+        CrashDrain& operator=(CrashDrain&&) = delete;
+
+    public:
+        // Maximum number of loggers that can be registered at once.
+        static constexpr size_t MaxLoggers = 64;
+
+        // How long a drain may spend writing - loggers stop where they are once it has passed.
+        static constexpr std::chrono::milliseconds DrainBudget { 1000 };
+
+        // How long the watchdog waits for a drain to finish before ending the process itself.
+        static constexpr std::chrono::milliseconds DrainTimeout { 3000 };
+
+    private:
+        /// Private Helper Methods \\\
+
+        // Install the terminate and signal handlers (once per process).
+        static void InstallHandlers( );
+
+        // Drain every registered logger (only the first call does anything).
+        static void DrainAll(const bool bSignal) noexcept;
+
+        // Watchdog thread - ends the process if a drain outlasts DrainTimeout.
+        static void Watchdog( ) noexcept;
+
+        // std::terminate handler.
+        [[noreturn]] static void OnTerminate( );
+
+        // Signal handler.
+        static void OnSignal(int sig);
+
+    public:
+        /// Public Methods \\\
+
+        // Drain pLogger if the process crashes.  Installs the handlers on first use.
+        // Returns false if all MaxLoggers slots are taken - pLogger works as usual, it just isn't drained.
+        static bool Register(const AsyncLogger* pLogger);
+
+        // Stop draining pLogger - must be called before it's destroyed.
+        static void Unregister(const AsyncLogger* pLogger) noexcept;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+// CC Types
+#include <CCTypes.h>
+
+// STL
+#include <cstdarg>
+#include <cstdint>
+#include <string>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - DeferredFormat
+    //
+    //  Purpose - Split printf-style formatting into a cheap capture step and a later render step.
+    //            Capture walks the format string (without formatting anything) and copies the binary
+    //            value of every argument it references - string arguments are copied by value - into a
+    //            caller-supplied buffer.  Render replays the format against the captured values,
+    //            producing the same UTF-16 text that the wide vswprintf path would have produced.
+    //
+    //            Conversion specifiers follow the wide printf family's rules (e.g., %s and %c take wide
+    //            arguments; %hs, %S, %hc and %C take narrow ones), since that is how the logger has always
+    //            interpreted its format strings.  %n is not supported.
+    //
+    ///
+    class DeferredFormat
+    {
+        /// Static Class - No Ctors, Dtor, or Assignment Allowed
+        DeferredFormat( ) = delete;
+        DeferredFormat(const DeferredFormat&) = delete;
+        DeferredFormat(DeferredFormat&&) = delete;
+
+        ~DeferredFormat( ) = delete;
+
+        DeferredFormat& operator=(const DeferredFormat&) = delete;
+        DeferredFormat& operator=(DeferredFormat&&) = delete;
+
+    private:
+        /// Private Types \\\
+
+        // Binary type of a captured argument.
+        enum class ArgType : uint8_t
+        {
+            Int,
+            Long,
+            LongLong,
+            IntMax,
+            SizeT,
+            PtrDiff,
+            WideChar,
+            Double,
+            LongDouble,
+            Pointer,
+            NarrowString,
+            WideString,
+        };
+
+        // A single parsed conversion specification.
+        struct Spec
+        {
+            size_t length;      // Characters in the specification, including the leading '%'.
+            size_t starCount;   // Number of '*' width/precision arguments that precede the value.
+            bool bLiteral;      // "%%" - no argument.
+            ArgType type;
+        };
+
+        /// Private Helper Methods \\\
+
+        // Parse the conversion specification starting at pSpec (which points at a '%').
+        template <class T>
+        static Spec ParseSpec(const T* pSpec);
+
+        // Copy a value into the capture buffer (or just count its bytes, if pBuf is null).
+        static void Store(uint8_t* pBuf, const size_t bufLen, size_t& offset, const void* pSrc, const size_t bytes);
+
+        // Copy a value out of the capture buffer.
+        static void Load(const uint8_t* pBuf, const size_t bufLen, size_t& offset, void* pDst, const size_t bytes);
+
+        // Capture (or size, if pBuf is null) the arguments referenced by pFormat.
+        template <class T>
+        static size_t CaptureArgs(const T* pFormat, va_list pArgs, uint8_t* pBuf, const size_t bufLen);
+
+        // Render a single conversion specification with its value and append the result.
+        template <class V>
+        static void AppendSpec(std::basic_string<utf16>& out, const utf16* pSpec, const int* pStars, const size_t starCount, const V& val);
+
+    public:
+        /// Public Methods \\\
+
+        // Returns number of bytes needed to capture the arguments referenced by pFormat.
+        template <class T>
+        static size_t GetCaptureSize(const T* pFormat, va_list pArgs);
+
+        // Copy the arguments referenced by pFormat into pBuf.  Returns number of bytes written.
+        template <class T>
+        static size_t Capture(const T* pFormat, va_list pArgs, uint8_t* pBuf, const size_t bufLen);
+
+        // Replay pFormat against previously captured arguments, appending the formatted text to out.
+        template <class T>
+        static void Render(const T* pFormat, const uint8_t* pBuf, const size_t bufLen, std::basic_string<utf16>& out);
+    };
+
+    // Render is explicitly specialized (see DeferredFormat.cpp) - declare the specializations before any use.
+    template <>
+    void DeferredFormat::Render<utf8>(const utf8* pFormat, const uint8_t* pBuf, const size_t bufLen, std::basic_string<utf16>& out);
+
+    template <>
+    void DeferredFormat::Render<utf16>(const utf16* pFormat, const uint8_t* pBuf, const size_t bufLen, std::basic_string<utf16>& out);
+}
\ No newline at end of file
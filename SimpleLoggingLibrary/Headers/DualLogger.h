@@ -1,6 +1,12 @@
 #pragma once
 
 #include "StreamLogger.h"
+#include "RateLimiter.h"
+#include "StatCounters.h"
+
+// STL
+#include <memory>
+#include <optional>
 
 namespace SLL
 {
@@ -9,6 +15,8 @@ namespace SLL
     //  Class   - DualLogger
     //
     //  Purpose - Wrapper for StdOutLogger and FileLogger.
+    //            Note: Call sites are rate limited once per message, so both streams log the same messages -
+    //                  separate ConfigPackages must share the same rate limiter (if any).
     //
     ///
     class DualLogger : public virtual ILogger
@@ -16,9 +24,20 @@ namespace SLL
     private:
         /// Private Data Members \\\
 
+        // Call-Site Rate Limiter (null == disabled), and a count of the messages it has held back
+        std::shared_ptr<RateLimiter> mpRateLimiter;
+        mutable StatCounters mStats;
+
         StdOutLogger mStdOutLogger;
         FileLogger mFileLogger;
 
+        /// Private Helper Methods \\\
+
+        bool IsRateLimited(const VerbosityLevel& lvl, const void* pSite) const noexcept;
+        std::optional<uint64_t> StampSequenceNumber(const VerbosityLevel& lvl) const;
+        static const std::shared_ptr<RateLimiter>& GetSharedRateLimiter(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig);
+        static ConfigPackage WithoutRateLimiter(ConfigPackage config);
+
     public:
         /// Constructors \\\
 
@@ -29,6 +48,7 @@ namespace SLL
         DualLogger(ConfigPackage&& config);
 
         // Separate ConfigPackages Constructor [C]
+        // - Note: Both ConfigPackages must have the same rate limiter (if any) - throws std::invalid_argument otherwise.
         DualLogger(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig);
 
         // Separate ConfigPackages Constructor [M]
@@ -69,5 +89,24 @@ namespace SLL
         // Submit log message to stream(s) (va_list, explicit thread ID).
         bool Log(const VerbosityLevel&, const std::thread::id&, const utf8*, va_list) const;
         bool Log(const VerbosityLevel&, const std::thread::id&, const utf16*, va_list) const;
+
+        // Submit log message to stream(s) (variadic arguments, explicit thread ID and event time).
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf8*, ...) const;
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf16*, ...) const;
+
+        // Submit log message to stream(s) (va_list, explicit thread ID and event time).
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf8*, va_list) const;
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf16*, va_list) const;
+
+        // Submit pre-formatted log record to both streams - message text is written as-is.
+        bool WriteRecord(const LogRecord&) const;
+
+        // Force any buffered log messages out to both streams.
+        bool Flush( ) const;
+
+        // Returns both loggers' statistics, added together (lock-free).
+        // - Note: Each message is counted once per stream (e.g., one Log call accepted by both counts as two),
+        //         except rate limited messages, which are held back before either stream sees them.
+        LogStats GetStats( ) const;
     };
 }
\ No newline at end of file
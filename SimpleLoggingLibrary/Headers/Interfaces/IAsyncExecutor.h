@@ -0,0 +1,31 @@
+#pragma once
+
+// STL
+#include <chrono>
+#include <functional>
+
+namespace SLL
+{
+    // Runs AsyncLogger work (e.g., writing a batch of messages) on threads the executor owns.
+    // Implement this to drive async loggers from an existing event loop or thread pool;
+    // AsyncWorkerPool is the library's own implementation.
+    // - Note: Work must not be run on the posting thread before Post/PostAfter returns.
+    class IAsyncExecutor
+    {
+        IAsyncExecutor(const IAsyncExecutor&) = delete;
+        IAsyncExecutor& operator=(const IAsyncExecutor&) = delete;
+
+    public:
+        IAsyncExecutor( ) = default;
+        virtual ~IAsyncExecutor( ) = default;
+
+        /// Public Methods \\\
+
+        // Run work as soon as possible.
+        virtual void Post(std::function<void( )> work) = 0;
+
+        // Run work once delay has passed.
+        // - Note: Executors without timers may run it right away - batches just come out smaller.
+        virtual void PostAfter(const std::chrono::microseconds& delay, std::function<void( )> work) = 0;
+    };
+}
\ No newline at end of file
@@ -6,6 +6,12 @@
 // SLL Enum Classes
 #include "../ConfigPackage.h"
 
+// SLL Log Record (and Event Time)
+#include "../LogRecord.h"
+
+// SLL Logger Statistics
+#include "../LogStats.h"
+
 // STL - Thread ID
 #include <thread>
 
@@ -37,5 +43,22 @@ namespace SLL
         // Submit log message to stream(s) (va_list, explicit thread ID).
         virtual bool Log(const VerbosityLevel&, const std::thread::id&, const utf8*, va_list) const = 0;
         virtual bool Log(const VerbosityLevel&, const std::thread::id&, const utf16*, va_list) const = 0;
+
+        // Submit log message to stream(s) (variadic arguments, explicit thread ID and event time).
+        virtual bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf8*, ...) const = 0;
+        virtual bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf16*, ...) const = 0;
+
+        // Submit log message to stream(s) (va_list, explicit thread ID and event time).
+        virtual bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf8*, va_list) const = 0;
+        virtual bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf16*, va_list) const = 0;
+
+        // Submit pre-formatted log record to stream(s) - message text is written as-is.
+        virtual bool WriteRecord(const LogRecord&) const = 0;
+
+        // Force any buffered log messages out to stream(s).
+        virtual bool Flush( ) const = 0;
+
+        // Returns a snapshot of the logger's statistics (lock-free).
+        virtual LogStats GetStats( ) const = 0;
     };
 }
\ No newline at end of file
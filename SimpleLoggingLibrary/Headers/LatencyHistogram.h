@@ -0,0 +1,127 @@
+#pragma once
+
+// STL
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - LatencyHistogram
+    //
+    //  Purpose - Lock-free, HDR-style latency histogram behind AsyncLogger::GetLatencyStats.
+    //            Buckets are log-linear - each power of two is split into SubBucketCount equal buckets, so any
+    //            recorded value is off by at most 1/SubBucketCount (12.5%), from nanoseconds up to about a minute.
+    //            Like StatCounters, each thread records into its own slot, and slots are summed into a snapshot.
+    //            Note: Values past the last bucket are counted in it.
+    //
+    ///
+    class LatencyHistogram
+    {
+        /// No copy or move.
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram(LatencyHistogram&&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    public:
+        /// Public Constants \\\
+
+        // Buckets per power of two (and the number of exact buckets at the bottom).
+        static constexpr size_t SubBucketBits = 3;
+        static constexpr size_t SubBucketCount = size_t(1) << SubBucketBits;
+
+        // Largest power of two with buckets of its own - 2^36ns is about 69 seconds.
+        static constexpr size_t MaxExponent = 35;
+
+        static constexpr size_t BucketCount = SubBucketCount + (MaxExponent - SubBucketBits + 1) * SubBucketCount;
+
+        /// Public Snapshot Struct \\\
+
+        // Point-in-time copy of a histogram's counts.
+        struct Snapshot
+        {
+            std::array<uint64_t, BucketCount> buckets { };
+            uint64_t count = 0;                 // Values recorded.
+            uint64_t totalNanoseconds = 0;      // Sum of the values recorded.
+
+            // Returns the value that pct percent (0 - 100) of recorded values are at or below (0 if nothing's been recorded).
+            // - Note: Reported as the top of the value's bucket, so it's never an underestimate.
+            std::chrono::nanoseconds GetPercentile(const double pct) const noexcept;
+
+            // Returns the mean recorded value (0 if nothing's been recorded).
+            std::chrono::nanoseconds GetMean( ) const noexcept;
+
+            // Returns the largest recorded value, to bucket precision (0 if nothing's been recorded).
+            std::chrono::nanoseconds GetMax( ) const noexcept;
+
+            // Take away an earlier snapshot of the same histogram, leaving just what was recorded since.
+            Snapshot& operator-=(const Snapshot& rhs) noexcept;
+        };
+
+    private:
+        /// Private Types \\\
+
+        static constexpr size_t SlotCount = 16;
+
+        // One thread's counts - totals first, so a busy slot's bookkeeping shares a cache line.
+        struct alignas(64) Slot
+        {
+            std::atomic<uint64_t> count;
+            std::atomic<uint64_t> totalNanoseconds;
+            std::array<std::atomic<uint64_t>, BucketCount> buckets;
+        };
+
+        /// Private Data Members \\\
+
+        std::array<Slot, SlotCount> mSlots;
+
+        /// Static Private Helper Methods \\\
+
+        // Returns the calling thread's slot index.
+        static size_t GetSlotIndex( ) noexcept;
+
+    public:
+        /// Constructor \\\
+
+        // Default Constructor - all buckets start empty.
+        LatencyHistogram( ) noexcept;
+
+        /// Public Methods \\\
+
+        // Record a value (calling thread's slot only).  Negative values are recorded as zero.
+        void Record(const std::chrono::nanoseconds value) noexcept;
+
+        // Returns every slot's counts added together.
+        Snapshot GetSnapshot( ) const noexcept;
+
+        // Empty every bucket.
+        void Reset( ) noexcept;
+
+        /// Static Public Methods \\\
+
+        // Returns the bucket a value (in nanoseconds) is counted in.
+        static size_t GetBucketIndex(const uint64_t nanoseconds) noexcept;
+
+        // Returns the largest value (in nanoseconds) counted in a bucket.
+        static uint64_t GetBucketUpperBound(const size_t index) noexcept;
+    };
+
+    ///
+    //
+    //  Struct  - LatencyStats
+    //
+    //  Purpose - Snapshot of an AsyncLogger's latency histograms (see AsyncLogger::GetLatencyStats).
+    //            Note: Messages that went through the spill file or LogSignalSafe have no queue wait recorded.
+    //
+    ///
+    struct LatencyStats
+    {
+        LatencyHistogram::Snapshot queueWait;   // Handed to the logger (incl. any thread staging) until the worker took it.
+        LatencyHistogram::Snapshot sinkWrite;   // Time the sink spent writing it (rendering and coalescing excluded).
+        LatencyHistogram::Snapshot logCall;     // Time the calling thread spent in Log (or WriteRecord), formatting included.
+    };
+}
\ No newline at end of file
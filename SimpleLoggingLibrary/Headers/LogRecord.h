@@ -0,0 +1,39 @@
+#pragma once
+
+// CC Types
+#include <CCTypes.h>
+
+// SLL Enum Classes
+#include "VerbosityLevel.h"
+
+// STL
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+namespace SLL
+{
+    // Clock used to timestamp log events.
+    using LogClock = std::chrono::system_clock;
+    using LogTime = LogClock::time_point;
+
+    ///
+    //
+    //  Struct  - LogRecord
+    //
+    //  Purpose - A fully-formatted log message, along with the details needed to build its prefixes.
+    //            Loggers write the message text as-is - no printf-style formatting is applied.
+    //            Note: The record doesn't own the message text; it only needs to outlive the write.
+    //            Note: seq is the record's process-wide sequence number (see OptionFlag::LogSequenceNumber).
+    //
+    ///
+    struct LogRecord
+    {
+        VerbosityLevel lvl;
+        std::thread::id tid;
+        LogTime time;
+        std::basic_string_view<utf16> message;
+        uint64_t seq;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+// STL
+#include <cstdint>
+
+namespace SLL
+{
+    ///
+    //
+    //  Struct  - LogStats
+    //
+    //  Purpose - Point-in-time snapshot of a logger's counters (see ILogger::GetStats).
+    //            Note: Counters are read one at a time while other threads keep logging, so a
+    //                  snapshot taken under load may be a few messages out between fields.
+    //            Note: Queue depth and high-watermark are only tracked by AsyncLogger (zero otherwise).
+    //
+    ///
+    struct LogStats
+    {
+        uint64_t accepted = 0;              // Messages taken for writing (for AsyncLogger, queued).
+        uint64_t filtered = 0;              // Messages below the verbosity threshold.
+        uint64_t dropped = 0;               // Messages turned away (e.g., queue full, or logger shut down).
+        uint64_t coalesced = 0;             // Repeated messages counted in a summary rather than written (see ConfigPackage::SetCoalesceWindow).
+        uint64_t rateLimited = 0;           // Messages sampled out or throttled by their call site's rate limit (see ConfigPackage::SetRateLimiter).
+        uint64_t written = 0;               // Messages written to the stream.
+        uint64_t failed = 0;                // Messages that couldn't be written (e.g., stream in bad state).
+        uint64_t bytesWritten = 0;          // Bytes of text handed to the stream (UTF-16, including prefixes).
+        uint64_t queueDepth = 0;            // Messages currently queued.
+        uint64_t queueHighWatermark = 0;    // Most messages ever queued at once.
+        uint64_t flushes = 0;               // Times the stream was flushed.
+        uint64_t restoreAttempts = 0;       // Attempts to restore the stream from a bad state.
+
+        // Add another snapshot's counters to this one (e.g., to total up several loggers).
+        LogStats& operator+=(const LogStats& rhs) noexcept
+        {
+            accepted += rhs.accepted;
+            filtered += rhs.filtered;
+            dropped += rhs.dropped;
+            coalesced += rhs.coalesced;
+            rateLimited += rhs.rateLimited;
+            written += rhs.written;
+            failed += rhs.failed;
+            bytesWritten += rhs.bytesWritten;
+            queueDepth += rhs.queueDepth;
+            queueHighWatermark += rhs.queueHighWatermark;
+            flushes += rhs.flushes;
+            restoreAttempts += rhs.restoreAttempts;
+
+            return *this;
+        }
+    };
+}
\ No newline at end of file
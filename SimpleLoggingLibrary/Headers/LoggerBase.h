@@ -6,6 +6,9 @@
 // Logger Interface
 #include "Interfaces\ILogger.h"
 
+// Logger Statistics Counters
+#include "StatCounters.h"
+
 // Variadic Arguments
 #include <cstdarg>
 
@@ -55,22 +58,30 @@ namespace SLL
         template <class T>
         static const std::basic_string<T>& GetVerbosityLevelFormat( );
 
+        // Prefix - Sequence Number Format Getter
+        template <class T>
+        static const std::basic_string<T>& GetSequenceNumberFormat( );
+
         // Extract Thread ID
         static unsigned long ExtractThreadID(const std::thread::id&);
 
         // Get Local Time String
         template <class T>
-        static std::basic_string<T> GetLocalTime( );
+        static std::basic_string<T> GetLocalTime(const LogTime& time = LogClock::now( ));
 
         // Build Time Prefix String
         template <class T>
-        static std::unique_ptr<T[ ]> BuildTimePrefix( );
+        static std::unique_ptr<T[ ]> BuildTimePrefix(const LogTime& time = LogClock::now( ));
 
         // Returns required length of buffer to hold built format-string
         // that would be built using format and arguments.
         template <class T>
         static size_t GetRequiredBufferLength(const T*, va_list);
 
+        // Will build format-string with arguments into the provided buffer.
+        template <class T>
+        static void StringPrint(T*, const size_t, const T*, va_list);
+
         // Will build format-string with arguments, returning the resulting string.
         template <class T>
         static std::unique_ptr<T[ ]> StringPrintWrapper(const size_t, const T*, va_list);
@@ -79,9 +90,9 @@ namespace SLL
 
         /// Common Protected Data Members \\\
 
-        static const size_t mFlushInterval;
         mutable size_t mFlushCounter;
         mutable ConfigPackage mConfig;
+        mutable StatCounters mStats;
 
         /// Constructors \\\
 
@@ -110,10 +121,14 @@ namespace SLL
 
         /// Common Protected Helper Methods \\\
 
+        // Returns the next process-wide log sequence number.
+        static uint64_t NextSequenceNumber( ) noexcept;
+
         // Generates log-ready string that contains all enabled message-prefix output.
-        // e.g., timestamp (mm/dd/yyyy, HH:mm::ss), thread id, verbosity level, etc.
+        // e.g., timestamp (mm/dd/yyyy, HH:mm::ss), thread id, verbosity level, sequence number, etc.
+        // The timestamp reflects the event time, which defaults to now.
         template <class T, ENABLE_IF_SUPPORTED_CHARACTER_TYPE(T)>
-        std::vector<std::unique_ptr<T[ ]>> BuildMessagePrefixes(const VerbosityLevel& lvl, const std::thread::id& tid) const;
+        std::vector<std::unique_ptr<T[ ]>> BuildMessagePrefixes(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time = LogClock::now( ), const uint64_t seq = 0) const;
 
         // Build user's formatted log message (w/ va_list).
         template<class T, ENABLE_IF_SUPPORTED_CHARACTER_TYPE(T)>
@@ -123,6 +138,14 @@ namespace SLL
         template <class T, ENABLE_IF_SUPPORTED_CHARACTER_TYPE(T)>
         static std::unique_ptr<T[ ]> BuildFormattedMessage(const T* pFormat, ...);     
 
+        // Returns required buffer length (including null-terminator) for user's formatted log message.
+        template <class T, ENABLE_IF_SUPPORTED_CHARACTER_TYPE(T)>
+        static size_t GetFormattedMessageLength(const T* pFormat, va_list args);
+
+        // Build user's formatted log message into caller-provided buffer (w/ va_list).
+        template <class T, ENABLE_IF_SUPPORTED_CHARACTER_TYPE(T)>
+        static void PrintFormattedMessage(T* pBuf, const size_t bufLen, const T* pFormat, va_list args);
+
     public:
 
         /// Dummy Log Methods For Unit Tests (adhere to ILogger interface) \\\
@@ -166,5 +189,40 @@ namespace SLL
         {
             return false;
         }
+
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf8*, ...) const
+        {
+            return false;
+        }
+
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf16*, ...) const
+        {
+            return false;
+        }
+
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf8*, va_list) const
+        {
+            return false;
+        }
+
+        bool Log(const VerbosityLevel&, const std::thread::id&, const LogTime&, const utf16*, va_list) const
+        {
+            return false;
+        }
+
+        bool WriteRecord(const LogRecord&) const
+        {
+            return false;
+        }
+
+        bool Flush( ) const
+        {
+            return false;
+        }
+
+        /// Public Methods \\\
+
+        // Returns a snapshot of the logger's statistics (lock-free).
+        LogStats GetStats( ) const;
     };
 }
\ No newline at end of file
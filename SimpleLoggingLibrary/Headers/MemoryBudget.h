@@ -0,0 +1,107 @@
+#pragma once
+
+// SLL
+#include "VerbosityLevel.h"
+
+// STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - MemoryBudget
+    //
+    //  Purpose - Byte budget for queued log messages, shared by any number of AsyncLogger objects
+    //            (via ConfigPackage::SetAsyncMemoryBudget) - e.g., one budget for every logger in the process.
+    //            Each queued message is charged for its payload (staged messages included) until it's written
+    //            or discarded, and each logger for the queue and staging storage it holds, as it grows and shrinks.
+    //            Past the soft limit, messages below the shedding threshold are turned away, so the messages
+    //            that matter most get the remaining room.  Past the hard limit, every message takes the
+    //            logger's overflow path - the spill file for INFO and WARN if the logger has one, otherwise dropped.
+    //            Note: Lock-free - charging a message is a single atomic add (and a subtract, if it's refused).
+    //            Note: A logger with a budget also frees its idle payload and queue memory after a quiet second
+    //                  (unless its memory is prefaulted).
+    //
+    ///
+    class MemoryBudget
+    {
+        /// No copy or move (loggers hold on to it).
+        MemoryBudget(const MemoryBudget&) = delete;
+        MemoryBudget(MemoryBudget&&) = delete;
+        MemoryBudget& operator=(const MemoryBudget&) = delete;
+        MemoryBudget& operator=(MemoryBudget&&) = delete;
+
+    public:
+        /// Public Types \\\
+
+        // Outcome of asking the budget for room for a message.
+        enum class Admission : uint8_t
+        {
+            Admitted,   // Charged to the budget - queue it.
+            Shed,       // Past the soft limit and below the shedding threshold - drop it.
+            Overflow,   // Past the hard limit - take the logger's overflow path (not charged).
+        };
+
+    private:
+        /// Private Data Members \\\
+
+        const size_t mSoftLimit;
+        const size_t mHardLimit;
+        const VerbosityLevel mShedThreshold;
+
+        std::atomic<size_t> mBytesInUse;
+        std::atomic<size_t> mPeakBytes;
+        std::atomic<uint64_t> mShedCount;
+        std::atomic<uint64_t> mOverflowCount;
+
+        /// Private Helper Methods \\\
+
+        void RaisePeak(const size_t inUse) noexcept;
+
+    public:
+        /// Constructor \\\
+
+        // Limits are in bytes - softLimit must be non-zero, and no more than hardLimit.
+        // Past the soft limit, messages below shedThreshold are shed.
+        MemoryBudget(const size_t softLimit, const size_t hardLimit, const VerbosityLevel shedThreshold = VerbosityLevel::WARN);
+
+        /// Destructor \\\
+
+        ~MemoryBudget( ) = default;
+
+        /// Public Methods \\\
+
+        // Ask for room for a message of the specified size - it's only charged if Admitted is returned.
+        Admission Admit(const size_t bytes, const VerbosityLevel& lvl) noexcept;
+
+        // Charge memory that's already been allocated (e.g., a queue's storage) - unconditionally, since there's no turning it away.
+        void Charge(const size_t bytes) noexcept;
+
+        // Give back room charged by Admit or Charge.
+        void Release(const size_t bytes) noexcept;
+
+        // Returns configured soft limit, in bytes.
+        size_t GetSoftLimit( ) const noexcept;
+
+        // Returns configured hard limit, in bytes.
+        size_t GetHardLimit( ) const noexcept;
+
+        // Returns configured shedding threshold.
+        VerbosityLevel GetShedThreshold( ) const noexcept;
+
+        // Returns bytes currently charged.
+        size_t GetBytesInUse( ) const noexcept;
+
+        // Returns most bytes ever charged at once.
+        size_t GetPeakBytes( ) const noexcept;
+
+        // Returns number of messages shed (past the soft limit).
+        uint64_t GetShedCount( ) const noexcept;
+
+        // Returns number of messages sent down the overflow path (past the hard limit).
+        uint64_t GetOverflowCount( ) const noexcept;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+// SLL
+#include "LogRecord.h"
+
+// STL
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - MessageCoalescer
+    //
+    //  Purpose - Suppression stage behind ConfigPackage::SetCoalesceWindow - repeated messages are counted rather than
+    //            written, and the count goes out as one "repeated N times" summary, so an error storm costs a few lines
+    //            rather than millions.
+    //            A message matching the last one written (same level and text) is a repeat; the run's summary is written
+    //            when a different message is written, or once the window has passed since the run began.
+    //            Once the window has passed, the message is written again the next time it comes up.
+    //            With format coalescing, a message from the same format string (i.e., call site) as one written within the
+    //            window is a repeat too, whatever its arguments - so a storm of e.g. "Request %d failed" is one record.
+    //            AsyncLogger only knows the format string of deferred messages (see OptionFlag::LogDeferredFormat) -
+    //            others are coalesced by their text.
+    //            Note: Not thread-safe - StreamLogger's callers serialize it, and AsyncLogger only uses it on the worker.
+    //                  So for async loggers, summaries are only written between batches.
+    //
+    ///
+    class MessageCoalescer
+    {
+        /// No copy or move.
+        MessageCoalescer(const MessageCoalescer&) = delete;
+        MessageCoalescer(MessageCoalescer&&) = delete;
+        MessageCoalescer& operator=(const MessageCoalescer&) = delete;
+        MessageCoalescer& operator=(MessageCoalescer&&) = delete;
+
+    public:
+        /// Public Types \\\
+
+        // Summary record that's due to be written.
+        struct Summary
+        {
+            VerbosityLevel lvl;                 // Level of the repeated message.
+            std::thread::id tid;                // Thread that logged the last repeat.
+            LogTime time;                       // Time of the last repeat.
+            std::basic_string<utf16> message;   // E.g., "Last message repeated 42 times."
+            uint64_t seq;                       // Sequence number of the message that ended the run (or of the last repeat, if its window passed).
+        };
+
+    private:
+        /// Private Types \\\
+
+        // Repeats of a written message.
+        struct Repeats
+        {
+            VerbosityLevel lvl;
+            std::thread::id tid;
+            LogTime start;      // Time of the written message - the window runs from here.
+            LogTime last;       // Time of the last repeat.
+            uint64_t lastSeq;   // Sequence number of the last repeat.
+            uint64_t count;
+        };
+
+        // Repeats of a written message's format string.
+        struct FormatRepeats
+        {
+            Repeats repeats;
+            const utf8* pNarrowFormat;
+            const utf16* pWideFormat;
+        };
+
+        /// Private Data Members \\\
+
+        const LogClock::duration mWindow;
+        const bool mByFormat;
+
+        // Last message written, and its repeats since.
+        std::basic_string<utf16> mLastMessage;
+        bool mHasLastMessage;
+        Repeats mRun;
+
+        // Format strings written within the window, by address - and the earliest time one of their windows passes.
+        std::unordered_map<const void*, FormatRepeats> mFormats;
+        LogTime mNextExpiry;
+
+        /// Private Helper Methods \\\
+
+        // Count a message as a repeat.
+        static void CountRepeat(Repeats& repeats, const LogRecord& record) noexcept;
+
+        // Append the last message's summary (if it was repeated), and forget it - pEnding is the record that ended the run (if any).
+        void EndRun(const LogRecord* pEnding, std::vector<Summary>& summaries);
+
+        // Append a format string's summary (if it was repeated) - pEnding is the record that ended the run (if any).
+        static void EndFormat(const FormatRepeats& format, const LogRecord* pEnding, std::vector<Summary>& summaries);
+
+        // Append summaries whose window has passed by now - pEnding is the record being submitted (if any).
+        void ExpireRuns(const LogTime& now, const bool bAll, const LogRecord* pEnding, std::vector<Summary>& summaries);
+
+    public:
+        /// Constructor \\\
+
+        // Window must be positive - bByFormat also coalesces messages by their format string.
+        MessageCoalescer(const std::chrono::milliseconds window, const bool bByFormat);
+
+        /// Destructor \\\
+
+        ~MessageCoalescer( ) = default;
+
+        /// Public Methods \\\
+
+        // Returns whether the record should be written - false if it's been counted as a repeat instead.
+        // Summaries that are due (e.g., for the run this record ends) are appended to summaries, to be written before it.
+        // - Note: Pass the record's format string (if it has one, and the other as null) for format coalescing.
+        bool Submit(const LogRecord& record, const utf8* pNarrowFormat, const utf16* pWideFormat, std::vector<Summary>& summaries);
+
+        // Append summaries whose window has passed by now (bAll - every pending summary, e.g., on shutdown).
+        void Expire(const LogTime& now, const bool bAll, std::vector<Summary>& summaries);
+    };
+}
\ No newline at end of file
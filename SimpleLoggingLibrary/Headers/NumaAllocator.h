@@ -0,0 +1,84 @@
+#pragma once
+
+// SLL
+#include "NumaHelper.h"
+
+// STL
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - NumaAllocator
+    //
+    //  Purpose - STL allocator that places container storage as described by a NumaHelper::Placement
+    //            (e.g., in a specific NUMA node's local memory, or on large pages) - the default
+    //            placement is plain heap memory.
+    //            The placement travels with the storage when containers are swapped or moved.
+    //
+    ///
+    template <class T>
+    class NumaAllocator
+    {
+        template <class U>
+        friend class NumaAllocator;
+
+    public:
+        using value_type = T;
+
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+    private:
+        NumaHelper::Placement mPlacement;
+
+    public:
+        NumaAllocator( ) noexcept = default;
+
+        explicit NumaAllocator(const NumaHelper::Placement& placement) noexcept :
+            mPlacement(placement)
+        { }
+
+        template <class U>
+        NumaAllocator(const NumaAllocator<U>& other) noexcept :
+            mPlacement(other.mPlacement)
+        { }
+
+        const NumaHelper::Placement& GetPlacement( ) const noexcept
+        {
+            return mPlacement;
+        }
+
+        T* allocate(const size_t n)
+        {
+            if ( n > static_cast<size_t>(-1) / sizeof(T) )
+            {
+                throw std::bad_array_new_length( );
+            }
+
+            return static_cast<T*>(NumaHelper::Allocate(n * sizeof(T), mPlacement));
+        }
+
+        void deallocate(T* p, const size_t) noexcept
+        {
+            NumaHelper::Free(p, mPlacement);
+        }
+
+        template <class U>
+        bool operator==(const NumaAllocator<U>& other) const noexcept
+        {
+            return mPlacement == other.mPlacement;
+        }
+
+        template <class U>
+        bool operator!=(const NumaAllocator<U>& other) const noexcept
+        {
+            return mPlacement != other.mPlacement;
+        }
+    };
+}
\ No newline at end of file
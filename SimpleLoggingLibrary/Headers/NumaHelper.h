@@ -0,0 +1,80 @@
+#pragma once
+
+// STL
+#include <cstddef>
+#include <cstdint>
+
+namespace SLL
+{
+    class NumaHelper
+    {
+        // Fully static class - no instances allowed.
+        NumaHelper( ) = delete;
+        NumaHelper(const NumaHelper&) = delete;
+        NumaHelper(NumaHelper&&) = delete;
+
+        ~NumaHelper( ) = delete;
+
+        // No instances = no copy or move assignment.
+        NumaHelper& operator=(const NumaHelper&) = delete;
+        NumaHelper& operator=(NumaHelper&&) = delete;
+
+    private:
+        /// Static Private Helper Methods \\\
+
+        // Enable the lock-memory privilege large page allocations need (once per process).  Returns false if it isn't held.
+        static bool EnableLargePages( ) noexcept;
+
+        // Touch every page of a fresh allocation, then lock it into memory (best effort).
+        static void Prefault(void* p, const size_t bytes) noexcept;
+
+    public:
+        /// Static Public Constants \\\
+
+        // Node argument for memory that isn't tied to any particular node.
+        static constexpr size_t AnyNode = static_cast<size_t>(-1);
+
+        /// Public Placement Struct \\\
+
+        // Where (and how) Allocate places memory - the default is plain heap memory.
+        struct Placement
+        {
+            // NUMA node to allocate from (AnyNode == no preference).
+            size_t node = AnyNode;
+
+            // Back the memory with large pages, if the process is allowed to use them (falls back to normal pages).
+            bool bLargePages = false;
+
+            // Touch and lock every page up front, so first use doesn't page-fault and it never gets paged out.
+            bool bPrefault = false;
+
+            bool operator==(const Placement& other) const noexcept
+            {
+                return node == other.node && bLargePages == other.bLargePages && bPrefault == other.bPrefault;
+            }
+
+            bool operator!=(const Placement& other) const noexcept
+            {
+                return !(*this == other);
+            }
+        };
+
+        /// Static Public Methods \\\
+
+        // Returns number of NUMA nodes in the system (1 if it isn't NUMA, or the count isn't available).
+        static size_t GetNodeCount( ) noexcept;
+
+        // Returns NUMA node of the processor the calling thread is running on (0 if it isn't available).
+        static size_t GetCurrentNode( ) noexcept;
+
+        // Returns mask of the processors on a NUMA node (bit N == CPU N, first processor group only).  Returns 0 on failure.
+        static uint64_t GetNodeAffinity(const size_t node) noexcept;
+
+        // Allocate memory as described by placement (e.g., from a NUMA node's local memory).  Throws std::bad_alloc on failure.
+        // - Note: Anything other than the default placement is allocated in whole pages - meant for large, long-lived buffers.
+        static void* Allocate(const size_t bytes, const Placement& placement);
+
+        // Free memory obtained from Allocate (with the same placement).
+        static void Free(void* p, const Placement& placement) noexcept;
+    };
+}
\ No newline at end of file
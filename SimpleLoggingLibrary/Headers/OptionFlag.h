@@ -22,23 +22,29 @@ namespace SLL
         LogTimestamp        = 1 << 4,
         LogThreadID         = 1 << 5,
         LogVerbosityLevel   = 1 << 6,
+        LogSequenceNumber   = 1 << 7,
+
+        // Logging Options - Global Behavior (appended, so existing options keep their values)
+        LogDeferredFormat   = 1 << 8,
 
         // Enum Begin/Max
         BEGIN               = 1 << 0,
-        MAX                 = 1 << 7,
+        MAX                 = 1 << 9,
 
-        // Behavior Begin
+        // Behavior Begin (global options come in two ranges - the original ones, and those appended after the prefixes)
         GLOBAL_BEGIN        = LogToStdout,
         PREFIX_BEGIN        = LogTimestamp,
+        GLOBAL_EXT_BEGIN    = LogDeferredFormat,
 
         // Behavior End
         GLOBAL_END          = PREFIX_BEGIN,
-        PREFIX_END          = MAX,
+        PREFIX_END          = GLOBAL_EXT_BEGIN,
+        GLOBAL_EXT_END      = MAX,
 
         // Behavior Masks
         ALL_MASK            = MAX - 1,
-        GLOBAL_MASK         = PREFIX_BEGIN - 1,
-        PREFIX_MASK         = ALL_MASK & ~GLOBAL_MASK,
+        PREFIX_MASK         = PREFIX_END - PREFIX_BEGIN,
+        GLOBAL_MASK         = (GLOBAL_END - GLOBAL_BEGIN) | (GLOBAL_EXT_END - GLOBAL_EXT_BEGIN),
     };
 
     /// BITWISE OPERATOR OVERLOADS \\\
@@ -0,0 +1,193 @@
+#pragma once
+
+// CC Types
+#include <CCTypes.h>
+
+// SLL
+#include "NumaHelper.h"
+
+// STL
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - PayloadPool
+    //
+    //  Purpose - Lock-free pool of UTF-16 buffers for log message payloads that are too large
+    //            for a message's inline storage.  Buffers are carved out of per-size-class slabs
+    //            (allocated on first use) and recycled through lock-free free-lists, so buffers
+    //            released by the worker thread are handed straight back to producer threads.
+    //            Requests larger than the biggest size class, or that find their class exhausted,
+    //            fall back to the heap.
+    //            Slab memory can be placed in a specific NUMA node's local memory, so buffers
+    //            written by threads on that node stay node-local, and can be prefaulted up front,
+    //            so the first pass through a slab doesn't page-fault.
+    //            Trim gives the memory of slabs with no buffers in use back, e.g. once logging has gone quiet -
+    //            they're allocated afresh on their next use.
+    //
+    ///
+    class PayloadPool
+    {
+        /// No copy or move.
+        PayloadPool(const PayloadPool&) = delete;
+        PayloadPool(PayloadPool&&) = delete;
+        PayloadPool& operator=(const PayloadPool&) = delete;
+        PayloadPool& operator=(PayloadPool&&) = delete;
+
+    public:
+        /// Public Buffer Handle Class \\\
+
+        // Owning handle to a buffer obtained from the pool (or from the heap, as a fallback).
+        // Must be returned to the pool that produced it via PayloadPool::Release.
+        class Buffer
+        {
+            friend class PayloadPool;
+
+            /// No copy.
+            Buffer(const Buffer&) = delete;
+            Buffer& operator=(const Buffer&) = delete;
+
+        private:
+            utf16* mpData;
+            size_t mLength;
+            uint32_t mSizeClass;
+            uint32_t mSlot;
+
+        public:
+            Buffer( ) noexcept :
+                mpData(nullptr),
+                mLength(0),
+                mSizeClass(0),
+                mSlot(0)
+            { }
+
+            Buffer(Buffer&& src) noexcept :
+                Buffer( )
+            {
+                *this = std::move(src);
+            }
+
+            ~Buffer( ) = default;
+
+            Buffer& operator=(Buffer&& src) noexcept
+            {
+                if ( this != &src )
+                {
+                    mpData = src.mpData;
+                    mLength = src.mLength;
+                    mSizeClass = src.mSizeClass;
+                    mSlot = src.mSlot;
+
+                    src.mpData = nullptr;
+                    src.mLength = 0;
+                }
+
+                return *this;
+            }
+
+            utf16* Get( ) const noexcept
+            {
+                return mpData;
+            }
+
+            size_t GetLength( ) const noexcept
+            {
+                return mLength;
+            }
+        };
+
+    private:
+        /// Private Slab Class \\\
+
+        // Fixed-size buffers for a single size class, with a tagged (ABA-safe) free-list of slot indices.
+        class Slab
+        {
+            /// No copy or move.
+            Slab(const Slab&) = delete;
+            Slab(Slab&&) = delete;
+            Slab& operator=(const Slab&) = delete;
+            Slab& operator=(Slab&&) = delete;
+
+        private:
+            const size_t mBufferLength;
+            const uint32_t mBufferCount;
+            const NumaHelper::Placement mPlacement;
+
+            // Backing memory, allocated on first use.
+            std::atomic<utf16*> mpMemory;
+
+            // Free-list links (slot + 1, zero terminates the list).
+            std::unique_ptr<std::atomic<uint32_t>[ ]> mpNext;
+
+            // Free-list head - upper 32 bits are an ABA tag, lower 32 bits are (slot + 1).
+            std::atomic<uint64_t> mFreeHead;
+
+            // Next never-used slot.
+            std::atomic<uint32_t> mUnused;
+
+        public:
+            Slab(const size_t bufferLength, const uint32_t bufferCount, const NumaHelper::Placement& placement);
+            ~Slab( );
+
+            utf16* GetMemory( );
+
+            size_t GetBufferLength( ) const noexcept;
+
+            utf16* TryAcquire(uint32_t& slot);
+            void Release(const uint32_t slot) noexcept;
+
+            size_t Trim( ) noexcept;
+        };
+
+        /// Private Static Constants \\\
+
+        // Smallest size class, in bytes (anything smaller fits in a LogMessage's inline storage).
+        static constexpr size_t MinBufferBytes = 512;
+
+        // Number of size classes - each class doubles the buffer size of the previous class.
+        static constexpr size_t SizeClassCount = 6;
+
+        // Bytes of buffer memory per size-class slab.
+        static constexpr size_t SlabBytes = 64 * 1024;
+
+        // Size class recorded for buffers that came from the heap.
+        static constexpr uint32_t HeapSizeClass = static_cast<uint32_t>(SizeClassCount);
+
+        /// Private Data Members \\\
+
+        std::array<std::unique_ptr<Slab>, SizeClassCount> mSlabs;
+
+        /// Private Helper Methods \\\
+
+        // Returns size class for a buffer of the specified length, or HeapSizeClass if too large.
+        static uint32_t GetSizeClass(const size_t len) noexcept;
+
+    public:
+        /// Constructor \\\
+
+        // Place slab memory as described by placement (the default placement selects the heap).
+        // - Note: Prefaulted slabs are allocated right away, rather than on first use.
+        // - Note: Slabs are smaller than a large page, so placement's large page setting is ignored.
+        explicit PayloadPool(const NumaHelper::Placement& placement = NumaHelper::Placement( ));
+
+        /// Destructor \\\
+
+        ~PayloadPool( ) = default;
+
+        /// Public Methods \\\
+
+        // Obtain buffer that holds at least len characters.
+        Buffer Acquire(const size_t len);
+
+        // Return buffer to the pool (or to the heap).
+        void Release(Buffer& buf) noexcept;
+
+        // Free the memory of every slab with no buffers in use.  Returns number of bytes freed.
+        // - Note: Safe to call while other threads acquire and release buffers - a slab that's in use is left alone.
+        size_t Trim( ) noexcept;
+    };
+}
\ No newline at end of file
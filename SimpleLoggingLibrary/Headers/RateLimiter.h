@@ -0,0 +1,123 @@
+#pragma once
+
+// SLL
+#include "VerbosityLevel.h"
+
+// STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Call-site key for RateLimiter::Allow, for callers with a logging macro of their own - each expansion (i.e., each
+// file and line) gets a key of its own, without hashing either.
+#define SLL_RATE_LIMIT_SITE ([ ] ( ) -> const void* { static const char site = 0; return &site; }( ))
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - RateLimiter
+    //
+    //  Purpose - Per-call-site rate limiting and sampling, shared by any number of loggers (via ConfigPackage::SetRateLimiter).
+    //            Loggers key each message by its format string's address (i.e., its call site), and ask before anything
+    //            is formatted, so a suppressed message costs a few atomic operations rather than a formatted string.
+    //            Each site can be sampled ("first N, then 1 in M") and/or held to a token bucket ("R per second, bursts of B");
+    //            messages at or above the exempt threshold (ERROR, by default) are never limited.
+    //            Limits can be changed at any time - e.g., to rein in a runaway site without redeploying.
+    //            Pre-formatted records (e.g., WriteRecord) have no call site, so they're never limited.
+    //            Note: Lock-free - sites are claimed in a fixed-size table, and sites that don't fit are never limited.
+    //
+    ///
+    class RateLimiter
+    {
+        /// No copy or move (loggers hold on to it).
+        RateLimiter(const RateLimiter&) = delete;
+        RateLimiter(RateLimiter&&) = delete;
+        RateLimiter& operator=(const RateLimiter&) = delete;
+        RateLimiter& operator=(RateLimiter&&) = delete;
+
+    public:
+        /// Public Constants \\\
+
+        // Default number of call sites tracked.
+        static constexpr size_t DefaultSiteCapacity = 1024;
+
+    private:
+        /// Private Types \\\
+
+        // Slots probed for a site before it's given up on.
+        static constexpr size_t MaxProbes = 16;
+
+        // One call site's state, padded out so busy neighbouring sites never share a cache line.
+        struct alignas(64) Site
+        {
+            std::atomic<const void*> key;       // Call site (null == slot unclaimed).
+            std::atomic<uint64_t> count;        // Messages seen, for sampling.
+            std::atomic<int64_t> tat;           // Token bucket, as a theoretical arrival time (steady clock ticks, GCRA).
+        };
+
+        /// Private Data Members \\\
+
+        const size_t mSiteMask;
+        const std::unique_ptr<Site[ ]> mpSites;
+
+        // Limits - read on every message, written by the setters.
+        std::atomic<uint64_t> mSampleFirst;
+        std::atomic<uint64_t> mSampleEvery;
+        std::atomic<int64_t> mTokenInterval;    // Steady clock ticks per token (0 == no token bucket).
+        std::atomic<int64_t> mTokenBurst;
+        std::atomic<VerbosityLevel> mExemptThreshold;
+
+        std::atomic<size_t> mSiteCount;
+        std::atomic<uint64_t> mSampledCount;
+        std::atomic<uint64_t> mThrottledCount;
+        std::atomic<uint64_t> mUntrackedCount;
+
+        /// Private Helper Methods \\\
+
+        // Returns site's slot, claiming one if it's new (null if there's no room for it).
+        Site* FindSite(const void* pSite) noexcept;
+
+    public:
+        /// Constructor \\\
+
+        // Tracks up to siteCapacity call sites (rounded up to a power of two) - must be non-zero (and small enough to round up).
+        // Nothing is limited until sampling or a token bucket is set.
+        explicit RateLimiter(const size_t siteCapacity = DefaultSiteCapacity);
+
+        /// Destructor \\\
+
+        ~RateLimiter( ) = default;
+
+        /// Public Methods \\\
+
+        // Returns whether a message from call site pSite should be logged - false if it's been sampled out or throttled.
+        // Null call sites are never limited.
+        bool Allow(const void* pSite, const VerbosityLevel& lvl) noexcept;
+
+        // Sets sampling - each site's first N messages are logged, then 1 in every M (M of 1 disables sampling).
+        void SetSampling(const uint64_t first, const uint64_t every);
+
+        // Sets each site's token bucket - up to burst messages at once, refilled at messagesPerSecond (0 disables it).
+        void SetTokenBucket(const double messagesPerSecond, const uint64_t burst);
+
+        // Sets level at and above which messages are never limited (VerbosityLevel::MAX exempts nothing).
+        void SetExemptThreshold(const VerbosityLevel);
+
+        // Start every site over - sample counts from zero, and full token buckets (e.g., after changing limits).
+        void Reset( ) noexcept;
+
+        // Returns number of call sites tracked so far.
+        size_t GetSiteCount( ) const noexcept;
+
+        // Returns number of messages sampled out.
+        uint64_t GetSampledCount( ) const noexcept;
+
+        // Returns number of messages turned away by a token bucket.
+        uint64_t GetThrottledCount( ) const noexcept;
+
+        // Returns number of messages that weren't limited because their site didn't fit in the table.
+        uint64_t GetUntrackedCount( ) const noexcept;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+// CC Types
+#include <CCTypes.h>
+
+// STL
+#include <cstdarg>
+#include <cstddef>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - SignalSafeFormat
+    //
+    //  Purpose - Restricted printf-style formatter that is safe to call from a signal handler:
+    //            it never allocates, locks, or touches locale state, and writes straight into a
+    //            caller-supplied buffer (truncating if needed).
+    //
+    //            Supported conversions are %d, %i, %u, %x, %X, %o, %c, %s, %p and %%, with the
+    //            hh, h, l, ll, j, z and t length modifiers.  Flags, width and precision aren't
+    //            supported.  %s takes a string of the format's own character type; narrow text
+    //            is widened byte-for-byte, so it should be ASCII.
+    //            Formatting stops at the first unsupported conversion - the rest of the format is
+    //            copied as-is, since the argument types that follow can no longer be known.
+    //
+    ///
+    class SignalSafeFormat
+    {
+        /// Static Class - No Ctors, Dtor, or Assignment Allowed
+        SignalSafeFormat( ) = delete;
+        SignalSafeFormat(const SignalSafeFormat&) = delete;
+        SignalSafeFormat(SignalSafeFormat&&) = delete;
+
+        ~SignalSafeFormat( ) = delete;
+
+        SignalSafeFormat& operator=(const SignalSafeFormat&) = delete;
+        SignalSafeFormat& operator=(SignalSafeFormat&&) = delete;
+
+    public:
+        /// Public Methods \\\
+
+        // Format into pBuf (always null-terminated if bufLen != 0).  Returns number of characters written, excluding the null-terminator.
+        template <class T>
+        static size_t Format(utf16* pBuf, const size_t bufLen, const T* pFormat, va_list pArgs) noexcept;
+    };
+}
\ No newline at end of file
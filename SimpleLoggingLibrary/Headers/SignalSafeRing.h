@@ -0,0 +1,105 @@
+#pragma once
+
+// CC Types
+#include <CCTypes.h>
+
+// SLL
+#include "LogRecord.h"
+#include "VerbosityLevel.h"
+
+// STL
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - SignalSafeRing
+    //
+    //  Purpose - Fixed-capacity, lock-free ring of log entries, for AsyncLogger::LogSignalSafe.
+    //            Any number of producers (including signal handlers) claim a slot with a single
+    //            atomic, fill it in place and publish it; the worker thread is the only consumer.
+    //            All memory is allocated up front - claiming and publishing never allocate or block.
+    //            A producer interrupted between claim and publish only holds up the consumer, never
+    //            other producers (e.g., a signal handler running on top of it).
+    //
+    ///
+    class SignalSafeRing
+    {
+        /// No copy or move.
+        SignalSafeRing(const SignalSafeRing&) = delete;
+        SignalSafeRing(SignalSafeRing&&) = delete;
+        SignalSafeRing& operator=(const SignalSafeRing&) = delete;
+        SignalSafeRing& operator=(SignalSafeRing&&) = delete;
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "SignalSafeRing requires lock-free 64-bit atomics.");
+
+    public:
+        // Characters of message text per entry (including null-terminator) - longer messages are truncated.
+        static constexpr size_t TextLength = 256;
+
+        // A single log entry, filled in place by the producer.
+        struct Entry
+        {
+            VerbosityLevel lvl;
+            std::thread::id tid;
+            LogClock::rep ticks;
+            uint64_t seq;
+            size_t len;
+            utf16 text[TextLength];
+        };
+
+    private:
+        /// Private Types \\\
+
+        // Entry, plus the turn counter that says whether it's free (== position) or published (== position + 1).
+        struct Slot
+        {
+            std::atomic<uint64_t> turn;
+            Entry entry;
+        };
+
+        /// Private Data Members \\\
+
+        const size_t mMask;
+        std::unique_ptr<Slot[ ]> mpSlots;
+
+        std::atomic<uint64_t> mClaimPos;
+        uint64_t mConsumePos;
+
+        /// Private Helper Methods \\\
+
+        // Returns capacity rounded up to a power of two (at least two slots).
+        static size_t RoundUpCapacity(const size_t capacity);
+
+    public:
+        /// Constructor \\\
+
+        // Capacity is rounded up to a power of two (at least two).
+        explicit SignalSafeRing(const size_t capacity);
+
+        /// Destructor \\\
+
+        ~SignalSafeRing( ) = default;
+
+        /// Public Methods \\\
+
+        // Returns number of entries the ring can hold.
+        size_t GetCapacity( ) const noexcept;
+
+        // Producer - claim an entry to fill, or nullptr if the ring is full.  Publish(ticket) once it's filled.
+        Entry* TryClaim(uint64_t& ticket) noexcept;
+
+        // Producer - hand a claimed entry to the consumer.
+        void Publish(const uint64_t ticket) noexcept;
+
+        // Consumer - returns the oldest published entry, or nullptr if there isn't one.  Pop( ) once done with it.
+        const Entry* Front( ) noexcept;
+
+        // Consumer - release the entry returned by Front( ) back to the producers.
+        void Pop( ) noexcept;
+    };
+}
\ No newline at end of file
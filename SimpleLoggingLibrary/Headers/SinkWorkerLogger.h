@@ -0,0 +1,223 @@
+#pragma once
+
+// SLL
+#include "LoggerBase.h"
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - SinkWorkerLogger
+    //
+    //  Purpose - Writes each record to one or more sinks (e.g., a StdOutLogger and a FileLogger), where each sink
+    //            can have a delivery queue and worker thread of its own - so a slow sink only ever holds up itself.
+    //            AsyncLogger writes through one when a sink's ConfigPackage sets a delivery queue capacity
+    //            (see ConfigPackage::SetAsyncSinkQueueCapacity).  Sinks without one are written in-line.
+    //            Each sink takes its settings from its own ConfigPackage (see the two-ConfigPackage AsyncLogger
+    //            constructor), so e.g. the console can have a delivery queue while the file is written directly.
+    //            Note: Each delivery queue has its own backpressure policy (drop, or wait for space when full)
+    //                  and drop count - drops are reported to the sink itself when the logger is destroyed.
+    //                  A sink that waits for space holds up the async worker, and so the other sink - e.g., use it for
+    //                  a durable file log that mustn't lose messages, not for a console that may stall.
+    //            Note: Flush waits for every sink, queued or not.
+    //            Note: Queued sinks are flushed by their worker after every pass through their queue.
+    //            Note: A worker that stops making progress (e.g., its sink is stuck) is abandoned on destruction,
+    //                  along with whatever is still in its queue, rather than holding the destructor up forever.
+    //            Note: Like DualLogger, it isn't meant to be written from several threads at once -
+    //                  AsyncLogger's worker is the only writer.
+    //
+    ///
+    class SinkWorkerLogger : public virtual LoggerBase, public virtual ILogger
+    {
+        /// No copy or move (sink workers hold a reference to their sink).
+        SinkWorkerLogger(const SinkWorkerLogger&) = delete;
+        SinkWorkerLogger(SinkWorkerLogger&&) = delete;
+        SinkWorkerLogger& operator=(const SinkWorkerLogger&) = delete;
+        SinkWorkerLogger& operator=(SinkWorkerLogger&&) = delete;
+
+    public:
+        /// Public Types \\\
+
+        // One sink, and how it's delivered to (queueCapacity 0 == written in-line, on the caller's thread).
+        struct SinkSettings
+        {
+            std::shared_ptr<ILogger> pLogger;
+            size_t queueCapacity;
+            bool bBlockWhenFull;
+        };
+
+    private:
+        /// Private Types \\\
+
+        // A queued record, with its own copy of the message text.
+        struct QueuedRecord
+        {
+            VerbosityLevel lvl;
+            std::thread::id tid;
+            LogTime time;
+            uint64_t seq;
+            std::basic_string<utf16> message;
+        };
+
+        // A flush waiting on queued sinks - onFlushed gets the combined result once the last of them is done.
+        struct PendingFlush
+        {
+            std::atomic<size_t> remaining;
+            std::atomic<bool> bFlushed;
+            std::function<void(bool)> onFlushed;
+        };
+
+        // A queued sink's part of a pending flush - done once its worker has written and flushed records up to target.
+        struct FlushBarrier
+        {
+            uint64_t target;
+            uint64_t passes;
+            std::shared_ptr<PendingFlush> pFlush;
+        };
+
+        // A sink, with its delivery queue and worker (queue and counters guarded by mutex, unless atomic).
+        // - Note: writer is the thread writing to the sink - the worker claims it for each pass, the crash hook for good.
+        //         Once the crash hook has it, the worker leaves the sink and its queue alone.
+        struct Sink
+        {
+            std::shared_ptr<ILogger> pLogger;
+            size_t queueCapacity;
+            bool bBlockWhenFull;
+
+            std::mutex mutex;
+            std::condition_variable workCV;     // Worker waits for records, a flush request, or stop.
+            std::condition_variable doneCV;     // Writers wait for space, flushers for their records to be flushed.
+            std::deque<QueuedRecord> queue;
+            std::vector<FlushBarrier> barriers;
+
+            uint64_t submitted = 0;             // Records queued so far.
+            uint64_t flushedThrough = 0;        // Records written and flushed so far.
+            uint64_t flushPasses = 0;           // Worker passes completed (each ends with a flush).
+            bool bFlushOk = true;               // Result of the last flush.
+            bool bFlushWanted = false;
+            bool bStop = false;
+            bool bExited = false;
+
+            std::atomic<size_t> queueDepth{ 0 };
+            std::atomic<size_t> queueHighWatermark{ 0 };
+            std::atomic<uint64_t> dropped{ 0 };
+            std::atomic<std::thread::id> writer{ std::thread::id( ) };
+            std::atomic<bool> bTakenOver{ false };
+
+            std::thread worker;
+        };
+
+        /// Private Data Members \\\
+
+        // Sinks are shared with their workers, so an abandoned worker never outlives its sink.
+        const std::vector<std::shared_ptr<Sink>> mSinks;
+
+        // Set once the crash hook has taken over (see TakeOverSinks) / once writers must no longer wait for space (see StopBlocking).
+        mutable std::atomic<bool> mCrashed;
+        mutable std::atomic<bool> mNoBlock;
+
+        // How long the destructor waits on a worker that isn't making progress before abandoning it.
+        static constexpr std::chrono::milliseconds StopTimeout { 5000 };
+
+        /// Private Helper Methods \\\
+
+        // Delivery queue worker - writes and flushes the sink's queued records until stopped.
+        static void SinkWorkerLoop(const std::shared_ptr<Sink>& pSink);
+
+        // Queue a copy of the record for a queued sink.  Returns false if it was dropped.
+        bool QueueRecord(Sink& sink, const LogRecord& record) const;
+
+        // Wait until everything queued for the sink so far is written and flushed.  Returns the flush result.
+        bool FlushQueuedSink(Sink& sink) const;
+
+        // Stop the sink's worker once its queue is empty, and wait for it - unless it stops making progress.
+        // Returns false if the worker was abandoned (and left running).
+        static bool StopSinkWorker(Sink& sink) noexcept;
+
+        // Deliver one sink's result to a pending flush - the last one in calls onFlushed.
+        static void CompleteFlush(PendingFlush& flush, const bool bFlushed) noexcept;
+
+        // Build the sinks from their settings.
+        static std::vector<std::shared_ptr<Sink>> BuildSinks(std::vector<SinkSettings>&& settings);
+
+    public:
+        /// Constructor \\\
+
+        // Sinks Constructor - starts a worker for each sink with a delivery queue.
+        explicit SinkWorkerLogger(std::vector<SinkSettings> sinks);
+
+        /// Destructor \\\
+
+        // Write out what's left in each delivery queue, stop the workers and report any drops.
+        ~SinkWorkerLogger( );
+
+        /// Public Methods \\\
+
+        // Submit log message to sink(s) (variadic arguments).
+        bool Log(const VerbosityLevel& lvl, const utf8* pFormat, ...) const;
+        bool Log(const VerbosityLevel& lvl, const utf16* pFormat, ...) const;
+
+        // Submit log message to sink(s) (va_list).
+        bool Log(const VerbosityLevel& lvl, const utf8* pFormat, va_list pArgs) const;
+        bool Log(const VerbosityLevel& lvl, const utf16* pFormat, va_list pArgs) const;
+
+        // Submit log message to sink(s) (variadic arguments, explicit thread ID).
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, ...) const;
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, ...) const;
+
+        // Submit log message to sink(s) (va_list, explicit thread ID).
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, va_list pArgs) const;
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const;
+
+        // Submit log message to sink(s) (variadic arguments, explicit thread ID and event time).
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, ...) const;
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, ...) const;
+
+        // Submit log message to sink(s) (va_list, explicit thread ID and event time).
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const;
+        bool Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const;
+
+        // Submit pre-formatted log record to every sink - written in-line, or queued for the sink's worker.
+        // Returns false if an in-line sink failed to write it, or every sink dropped it.
+        bool WriteRecord(const LogRecord& record) const;
+
+        // Flush every sink, waiting for each queued sink's worker to write and flush everything queued so far.
+        // - Note: A stuck queued sink holds this up - other sinks' workers carry on regardless.
+        bool Flush( ) const;
+
+        // Flush only the sinks written in-line - queued sinks flush themselves after each pass.
+        bool FlushInlineSinks( ) const;
+
+        // Stop making writers wait for queue space - from now on, records that don't fit are dropped.
+        // - Note: e.g., once AsyncLogger::Shutdown runs out of time, so a stuck sink can't hold up its worker.
+        void StopBlocking( ) const noexcept;
+
+        // Flush every sink without waiting on the queued ones - in-line sinks are flushed now, queued sinks by their worker
+        // once it has written everything queued so far.  onFlushed gets the combined result once every sink is done
+        // (maybe before we return, maybe on a sink's worker thread).
+        // - Note: onFlushed is called exactly once, unless we throw (before anything was asked of the sinks).
+        void FlushAsync(std::function<void(bool)> onFlushed) const;
+
+        // Crash hook for AsyncLogger (see CrashDrain) - takes each queued sink over from its worker, and writes what's still
+        // queued for it straight to the sink.  From then on, records and flushes go straight to the sinks taken over, and
+        // skip the other queued sinks.
+        // - Note: A pass in progress is waited out until the deadline - a sink whose worker is the calling thread is skipped.
+        void TakeOverSinks(const std::chrono::steady_clock::time_point& deadline) const noexcept;
+
+        // Returns every sink's statistics added together, plus delivery queue drops, depth and high-watermark (lock-free).
+        LogStats GetStats( ) const;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#pragma once
+
+// CC Types
+#include <CCTypes.h>
+
+// SLL
+#include "LogRecord.h"
+#include "VerbosityLevel.h"
+
+// STL
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <type_traits>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - SpillFile
+    //
+    //  Purpose - Append-only binary overflow file for AsyncLogger's queue.
+    //            Records are appended at the write offset and read back, oldest first, from the
+    //            read offset; once every record has been read the file is rewound and reused,
+    //            so a burst only costs the space it actually needed.
+    //            The file is preallocated when it's created, so appends within that space don't
+    //            have to grow it.
+    //            Records hold raw pointers (e.g., deferred format strings) and thread IDs, so they
+    //            are only meaningful to the process that wrote them - this is scratch space, not a log.
+    //            Each path can only be used by one spill file at a time in the process (e.g., loggers built from
+    //            copies of one config must be given their own paths).
+    //            Not thread-safe - AsyncLogger guards it with a lock of its own, so file I/O never holds up its queue.
+    //
+    ///
+    class SpillFile
+    {
+        /// No copy or move.
+        SpillFile(const SpillFile&) = delete;
+        SpillFile(SpillFile&&) = delete;
+        SpillFile& operator=(const SpillFile&) = delete;
+        SpillFile& operator=(SpillFile&&) = delete;
+
+    public:
+        // Fixed-size part of a record - followed by len characters of payload.
+        struct Header
+        {
+            VerbosityLevel lvl;
+            std::thread::id tid;
+            LogClock::rep ticks;
+            uint64_t seq;
+            size_t len;
+            const utf8* pNarrowFormat;
+            const utf16* pWideFormat;
+        };
+
+        static_assert(std::is_trivially_copyable_v<Header>, "SpillFile::Header must be trivially copyable.");
+
+    private:
+        /// Private Types \\\
+
+        // What the stream was last used for - switching between reading and writing requires a seek.
+        enum class Access : uint8_t
+        {
+            None,
+            Write,
+            Read,
+        };
+
+        /// Private Data Members \\\
+
+        const std::filesystem::path mPath;
+        const std::filesystem::path mClaimPath;
+        std::fstream mStream;
+
+        uint64_t mWriteOffset;
+        uint64_t mReadOffset;
+        size_t mCount;
+        Access mLastAccess;
+
+        /// Private Helper Methods \\\
+
+        // Returns the path the file is claimed under - absolute, so relative and absolute spellings of one file match.
+        static std::filesystem::path GetClaimPath(const std::filesystem::path& file);
+
+        // Claim the path for this file - throws if another spill file in the process already has it.
+        void ClaimPath( );
+
+        // Release the path claimed by ClaimPath.
+        void ReleasePath( ) noexcept;
+
+        // Position the stream for the next read or write.
+        void Seek(const Access access);
+
+        // Throw (after clearing the stream's error state) if the last stream operation failed.
+        void ThrowIfFailed(const char* pFunction);
+
+    public:
+        /// Constructor \\\
+
+        // Create (or overwrite) the file, preallocating preallocateBytes.
+        // - Note: Throws invalid_argument if another spill file in the process is using the same path.
+        SpillFile(const std::filesystem::path& file, const uint64_t preallocateBytes);
+
+        /// Destructor \\\
+
+        // Close and delete the file.
+        ~SpillFile( );
+
+        /// Public Methods \\\
+
+        // Returns number of bytes a record with len characters of payload takes up.
+        static uint64_t GetRecordSize(const size_t len) noexcept;
+
+        // Returns number of records that haven't been read back yet.
+        size_t GetCount( ) const noexcept;
+
+        // Returns true if every record has been read back.
+        bool Empty( ) const noexcept;
+
+        // Append a record - pPayload holds hdr.len characters.
+        void Append(const Header& hdr, const void* pPayload);
+
+        // Read the oldest record's header, without consuming it.
+        void PeekHeader(Header& hdr);
+
+        // Read the oldest record's payload (hdr.len characters, per PeekHeader) into pPayload, consuming the record.
+        void ReadPayload(const Header& hdr, void* pPayload);
+
+        // Drop every unread record and rewind.  Returns number of records dropped.
+        size_t Discard( ) noexcept;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+// SLL
+#include "LogStats.h"
+
+// STL
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace SLL
+{
+    ///
+    //
+    //  Class   - StatCounters
+    //
+    //  Purpose - Lock-free counters behind ILogger::GetStats.
+    //            Each thread bumps its own cache-line-sized slot, so logging threads never contend
+    //            on a shared counter; the slots are only summed up when a snapshot is taken.
+    //            Note: Threads are handed slots round-robin - with more threads than slots, some share.
+    //
+    ///
+    class StatCounters
+    {
+        /// No copy.
+        StatCounters(const StatCounters&) = delete;
+        StatCounters& operator=(const StatCounters&) = delete;
+
+    public:
+        /// Public Types \\\
+
+        enum class Counter : size_t
+        {
+            Accepted,
+            Filtered,
+            Dropped,
+            Coalesced,
+            RateLimited,
+            Written,
+            Failed,
+            BytesWritten,
+            Flushes,
+            RestoreAttempts,
+
+            Count
+        };
+
+    private:
+        /// Private Types \\\
+
+        static constexpr size_t CacheLineSize = 64;
+        static constexpr size_t SlotCount = 16;
+        static constexpr size_t CounterCount = static_cast<size_t>(Counter::Count);
+
+        // One thread's counters, padded out so neighbouring slots never share a cache line.
+        struct alignas(CacheLineSize) Slot
+        {
+            std::array<std::atomic<uint64_t>, CounterCount> counts;
+        };
+
+        /// Private Data Members \\\
+
+        std::array<Slot, SlotCount> mSlots;
+
+        /// Static Private Helper Methods \\\
+
+        // Returns the calling thread's slot index.
+        static size_t GetSlotIndex( ) noexcept;
+
+    public:
+        /// Constructors \\\
+
+        // Default Constructor - all counters start at zero.
+        StatCounters( ) noexcept;
+
+        // Move Constructor - totals are carried over, src is reset.
+        StatCounters(StatCounters&& src) noexcept;
+
+        /// Assignment Overload \\\
+
+        // Move Assignment - totals are carried over, src is reset.
+        StatCounters& operator=(StatCounters&& src) noexcept;
+
+        /// Public Methods \\\
+
+        // Add to a counter (calling thread's slot only).
+        void Add(const Counter counter, const uint64_t n = 1) noexcept;
+
+        // Returns a counter's total across all slots.
+        uint64_t Get(const Counter counter) const noexcept;
+
+        // Returns every counter's total, as a LogStats snapshot (queue fields are left at zero).
+        LogStats GetSnapshot( ) const noexcept;
+
+        // Zero every counter.
+        void Reset( ) noexcept;
+    };
+}
\ No newline at end of file
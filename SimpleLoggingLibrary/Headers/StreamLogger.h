@@ -3,10 +3,16 @@
 // Parent class
 #include "LoggerBase.h"
 
+// SLL
+#include "MessageCoalescer.h"
+
 // C++ STL Streams
 #include <fstream>
 #include <iostream>
 
+// STL
+#include <optional>
+
 namespace StreamLoggerTests
 {
     template <class LoggerType, class StreamType>
@@ -18,6 +24,9 @@ namespace SLL
     template <class StreamType>
     class StreamLogger;
 
+    // Forward declaration - see DualLogger.h.
+    class DualLogger;
+
     // Aliases for supported stream types.
     using StdOutStream = std::basic_ostream<utf16>;
     using FileStream = std::basic_ofstream<utf16>;
@@ -42,15 +51,33 @@ namespace SLL
         friend ::StreamLoggerTests::Tester<FileLogger, StreamType>;
         friend ::StreamLoggerTests::Tester<StdOutLogger, StreamType>;
 
+        // DualLogger stamps each message's sequence number once, for both of its streams.
+        friend class DualLogger;
+
         /// Construction requires ConfigPackage
         StreamLogger( ) = delete;
 
     private:
+        /// Private Types \\\
+
+        // Coalescing state (see ConfigPackage::SetCoalesceWindow) - the coalescer, and scratch space reused between messages.
+        struct Coalescing
+        {
+            MessageCoalescer coalescer;
+            std::basic_string<utf16> message;
+            std::vector<MessageCoalescer::Summary> summaries;
+
+            explicit Coalescing(_In_ const ConfigPackage&);
+        };
+
         /// Private Data Members \\\
 
         std::basic_streambuf<utf16>* mpUTF16StreamBuffer;
         mutable StreamType mStream;
 
+        // Null if coalescing is disabled.
+        std::unique_ptr<Coalescing> mpCoalescing;
+
         /// Private Helper Methods \\\
 
         // Return whether or not stream is in good state.
@@ -75,16 +102,48 @@ namespace SLL
 
         // Internal Logging Implementation.
         template <class T>
-        bool LogInternal(_In_ const VerbosityLevel&, _In_ const std::thread::id&, _In_z_ _Printf_format_string_ const T*, _In_ va_list) const;
+        bool LogInternal(_In_ const VerbosityLevel&, _In_ const std::thread::id&, _In_ const LogTime&, _In_z_ _Printf_format_string_ const T*, _In_ va_list) const;
+
+        // Internal Logging Implementation - with a sequence number stamped by the caller (none - written messages take their own).
+        template <class T>
+        bool LogInternal(_In_ const VerbosityLevel&, _In_ const std::thread::id&, _In_ const LogTime&, _In_ const std::optional<uint64_t>&, _In_z_ _Printf_format_string_ const T*, _In_ va_list) const;
 
         // Log Prefixes to Stream.
         template <class T>
-        void LogPrefixes(_In_ const VerbosityLevel&, _In_ const std::thread::id&) const;
+        void LogPrefixes(_In_ const VerbosityLevel&, _In_ const std::thread::id&, _In_ const LogTime& = LogClock::now( ), _In_ const uint64_t = 0) const;
 
         // Log User Message To Stream.
         template <class T>
         void LogMessage(_In_z_ _Printf_format_string_ const T*, _In_ va_list) const;
 
+        // Log Pre-Formatted Message To Stream.
+        void LogRawMessage(_In_ const std::basic_string_view<utf16>&) const;
+
+        // Write message terminator (and restore console color, if enabled).
+        void EndMessage( ) const;
+
+        // Count characters just written to the stream (as UTF-16 bytes), if the stream took them.
+        void CountBytesWritten(_In_ const size_t length) const noexcept;
+
+        // Count a finished write as written or failed, by the stream's state.  Returns whether it was written.
+        bool CountWriteResult( ) const noexcept;
+
+        // Write record's prefixes and text, then flush if it's due.  Returns whether it was written.
+        bool WriteText(_In_ const LogRecord&) const;
+
+        // Pass record through the coalescer, writing any summaries due ahead of it.  Returns whether record should be written.
+        // bStamped - record already carries its sequence number, so summaries ended by it take that number too.
+        bool CoalesceRecord(_In_ const LogRecord&, _In_ const utf8*, _In_ const utf16*, _In_ const bool bStamped) const;
+
+        // Write the coalescer's summaries that are due (bAll - every pending summary, e.g., on destruction).
+        void WriteDueSummaries(_In_ const bool bAll) const;
+
+        // Write summaries the coalescer has handed back, then forget them (bStamped - see CoalesceRecord).
+        void WriteSummaries(_In_ const bool bStamped) const;
+
+        // Returns coalescing state for config (null if coalescing is disabled).
+        static std::unique_ptr<Coalescing> BuildCoalescing(_In_ const ConfigPackage&);
+
     protected:
         ConfigPackage& GetConfig( ) noexcept;
 
@@ -131,5 +190,19 @@ namespace SLL
         // Submit log message to stream(s) (va_list, explicit thread ID).
         bool Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_z_ _Printf_format_string_ const utf8* pFormat, _In_ va_list pArgs) const;
         bool Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_z_ _Printf_format_string_ const utf16* pFormat, _In_ va_list pArgs) const;
+
+        // Submit log message to stream(s) (variadic arguments, explicit thread ID and event time).
+        bool Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf8* pFormat, ...) const;
+        bool Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf16* pFormat, ...) const;
+
+        // Submit log message to stream(s) (va_list, explicit thread ID and event time).
+        bool Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf8* pFormat, _In_ va_list pArgs) const;
+        bool Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf16* pFormat, _In_ va_list pArgs) const;
+
+        // Submit pre-formatted log record to stream - message text is written as-is.
+        bool WriteRecord(_In_ const LogRecord& record) const;
+
+        // Force any buffered log messages out to stream.
+        bool Flush( ) const;
     };
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+// CC Types
+#include <CCTypes.h>
+
+// STL
+#include <cstdint>
+#include <string>
+
+namespace SLL
+{
+    class WindowsThreadHelper
+    {
+        // Fully static class - no instances allowed.
+        WindowsThreadHelper( ) = delete;
+        WindowsThreadHelper(const WindowsThreadHelper&) = delete;
+        WindowsThreadHelper(WindowsThreadHelper&&) = delete;
+
+        ~WindowsThreadHelper( ) = delete;
+
+        // No instances = no copy or move assignment.
+        WindowsThreadHelper& operator=(const WindowsThreadHelper&) = delete;
+        WindowsThreadHelper& operator=(WindowsThreadHelper&&) = delete;
+
+    public:
+        /// Static Public Methods \\\
+
+        // Restrict the calling thread to the CPUs in affinityMask (bit N == CPU N).  Returns false on failure.
+        static bool SetCurrentThreadAffinity(const uint64_t affinityMask);
+
+        // Set the calling thread's priority (THREAD_PRIORITY_* value).  Returns false on failure.
+        static bool SetCurrentThreadPriority(const int priority);
+
+        // Name the calling thread.  Returns false on failure.
+        // - Note: Requires Windows 10, version 1607 or later.
+        static bool SetCurrentThreadName(const std::basic_string<utf16>& name);
+    };
+}
\ No newline at end of file
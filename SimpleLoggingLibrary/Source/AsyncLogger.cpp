@@ -1,14 +1,26 @@
 #include <AsyncLogger.h>
 
+#include <CrashDrain.h>
 #include <LoggerFactory.h>
+#include <NumaHelper.h>
+#include <SignalSafeFormat.h>
+#include <StreamLogger.h>
+#include <WindowsThreadHelper.h>
 
 #include <CCStringUtil.h>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
 namespace SLL
 {
 	using Base = CC::StringUtil::NumberConversion::Base;
 	using ReturnType = CC::StringUtil::ReturnType;
 
+    // Source of AsyncLogger instance IDs.
+    static std::atomic<uint64_t> s_NextInstanceId(1);
+
     /// Private Worker Methods \\\
 
     // Logging loop for the worker thread.
@@ -17,204 +29,2482 @@ namespace SLL
         // Ensure we have a valid logger at thread start.
         if ( !mpLogger )
         {
-            throw std::runtime_error(__FUNCTION__" - mpLogger was null at worker thread start.");
+            throw std::runtime_error(__FUNCTION__" - mpLogger was null at worker thread start.");
+        }
+
+        ApplyWorkerSettings( );
+
+        // Loop until we get signaled to terminate.
+        while ( !TerminatePredicate( ) )
+        {
+            // Wait for more log messages to queue-up.
+            // - Note: We won't actually sleep if the message queue isn't empty.
+            WaitForMsgs( );
+
+            // See if we should terminate after waking up.
+            if ( TerminatePredicate( ) )
+            {
+                break;
+            }
+
+            // Ensure the logger didn't somehow get nulled.
+            if ( !mpLogger )
+            {
+                throw std::runtime_error(__FUNCTION__" - mpLogger somehow became null during worker thread loop.");
+            }
+
+            // Log the next batch of queued messages.
+            ProcessBatch( );
+        }
+    }
+
+    // Apply the configured affinity, priority and name to the worker thread (worker only).
+    // - Note: Best effort - these are only tuning hints, so failures are logged rather than thrown.
+    void AsyncLogger::ApplyWorkerSettings( ) const
+    {
+        try
+        {
+            if ( mWorkerAffinity != 0 && !WindowsThreadHelper::SetCurrentThreadAffinity(mWorkerAffinity) )
+            {
+                mpLogger->Log(VerbosityLevel::WARN, __FUNCTION__" - Failed to set worker thread affinity (mask 0x%llX).", static_cast<unsigned long long>(mWorkerAffinity));
+            }
+
+            if ( mWorkerPriority != 0 && !WindowsThreadHelper::SetCurrentThreadPriority(mWorkerPriority) )
+            {
+                mpLogger->Log(VerbosityLevel::WARN, __FUNCTION__" - Failed to set worker thread priority (%d).", mWorkerPriority);
+            }
+
+            if ( !mWorkerName.empty( ) && !WindowsThreadHelper::SetCurrentThreadName(mWorkerName) )
+            {
+                mpLogger->Log(VerbosityLevel::WARN, __FUNCTION__" - Failed to set worker thread name.");
+            }
+        }
+        catch ( const std::exception& )
+        {
+            // Best effort - the worker runs fine without them.
+        }
+    }
+
+    // Write the next batch of queued messages and release anyone waiting on them.
+    // - Note: The sink is claimed for the length of the batch - once the crash hook has taken it, we leave it alone.
+    void AsyncLogger::ProcessBatch( ) const
+    {
+        if ( !ClaimSink( ) )
+        {
+            return;
+        }
+
+        try
+        {
+            WriteBatch( );
+        }
+        catch ( ... )
+        {
+            ReleaseSink( );
+            throw;
+        }
+
+        ReleaseSink( );
+    }
+
+    // ProcessBatch implementation - caller must have claimed the sink.
+    void AsyncLogger::WriteBatch( ) const
+    {
+        DrainSignalSafeMsgs( );
+
+        // Producer threads that went quiet can't hand off their own staged messages.
+        HandOffAllStagedMsgs(true);
+
+        const size_t lane = GetQueuedMsgs(mBatch);
+
+        // Busy - idle memory is only freed once we've been quiet for a while again.
+        if ( mTrimIdleMemory && !mBatch.empty( ) )
+        {
+            mLastBatchTime = std::chrono::steady_clock::now( );
+            mIdleTrimmed = false;
+        }
+
+        // Each lane is written in submission order, so its running count doubles as a flush barrier.
+        // - Note: Messages the spill file couldn't take are written off along with the batch.
+        mWrittenCounts[lane] += mBatch.size( );
+        mWrittenCounts[NormalLane] += mSpillLost.exchange(0);
+
+        // Priority messages are flushed right away, rather than whenever the sink would get to it.
+        LogMsgs(mBatch, mBatchLatency > std::chrono::microseconds::zero( ) || lane == PriorityLane);
+
+        CompleteFlushWaiters(mWrittenCounts, false);
+
+        // Summaries go out between batches, once the interval has passed since the last one.
+        if ( mpLatency && mLatencySummaryInterval > std::chrono::milliseconds::zero( ) && std::chrono::steady_clock::now( ) - mpLatency->lastSummary >= mLatencySummaryInterval )
+        {
+            WriteLatencySummary( );
+        }
+    }
+
+    // Claim the sink for the calling thread - returns false if someone else has it (i.e., the crash hook).
+    bool AsyncLogger::ClaimSink( ) const noexcept
+    {
+        std::thread::id none;
+        return mSinkOwner.compare_exchange_strong(none, std::this_thread::get_id( ));
+    }
+
+    // Hand back the sink claimed by ClaimSink.
+    void AsyncLogger::ReleaseSink( ) const noexcept
+    {
+        mSinkOwner = std::thread::id( );
+    }
+
+    // Let the worker know there's work - caller must hold mMsgQueueMutex.
+    void AsyncLogger::WakeWorker( ) const
+    {
+        if ( !mpExecutor )
+        {
+            mMsgCV.notify_one( );
+            return;
+        }
+
+        const bool bNow = mBatchLatency == std::chrono::microseconds::zero( ) || BatchPredicate( ) || !mFlushWaiters.empty( );
+
+        // Already posted - a delayed pass only needs replacing if the work can't wait any more.
+        if ( mDrainState == DrainState::Posted || (mDrainState == DrainState::Delayed && !bNow) )
+        {
+            return;
+        }
+
+        // The posted pass holds the shared state, not us - it does nothing if we're destroyed first.
+        auto pass = [pState = mpExecutorState] ( )
+        {
+            RunPostedPass(*pState);
+        };
+
+        if ( bNow )
+        {
+            mDrainState = DrainState::Posted;
+            mpExecutor->Post(std::move(pass));
+        }
+        else
+        {
+            // Let the partial batch fill up - the executor runs us once the latency target passes.
+            mDrainState = DrainState::Delayed;
+            mpExecutor->PostAfter(mBatchLatency, std::move(pass));
+        }
+    }
+
+    // Start the worker thread, if it isn't running - caller must hold mMsgQueueMutex.
+    void AsyncLogger::StartWorker( ) const
+    {
+        if ( !mpExecutor && !mWorkerThread.joinable( ) )
+        {
+            mWorkerThread = std::thread(&AsyncLogger::WorkerLogLoop, this);
+        }
+    }
+
+    // Have the worker write out the rest of the queue, then stop it.
+    void AsyncLogger::StopWorker( ) const
+    {
+        // Make sure the worker sees every staged message before it's told to stop.
+        HandOffAllStagedMsgs(false);
+
+        // Check if worker thread is running.
+        if ( mWorkerThread.joinable( ) )
+        {
+            // Signal the worker to terminate and wait.
+            // - Note: Set under the queue lock so the worker can't miss the wake-up.
+            {
+                std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+                mTerminate = true;
+                mMsgCV.notify_one( );
+            }
+
+            // Once Shutdown has run out of time, this only waits on the worker's last few writes (see Shutdown).
+            mWorkerThread.join( );
+        }
+        else if ( mpExecutor )
+        {
+            {
+                std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+                mTerminate = true;
+            }
+
+            // Detach from the executor (waiting out any pass in progress), then write out the rest here.
+            // - Note: Passes still sitting in the executor find no owner and do nothing.
+            {
+                std::unique_lock<std::mutex> lock(mpExecutorState->mutex);
+                mpExecutorState->pOwner = nullptr;
+
+                mpExecutorState->idleCV.wait(lock, [this] ( ) -> bool
+                {
+                    return !mpExecutorState->bRunning;
+                });
+            }
+
+            // The last pass clears bRunning under the queue lock - make sure it has let go of it, too.
+            {
+                std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+            }
+
+            while ( mMsgQueueSize != 0 )
+            {
+                ProcessBatch( );
+            }
+        }
+    }
+
+    // Take up to count more messages of the current batch - returns how many were taken (0 if Shutdown gave up on the rest of it).
+    size_t AsyncLogger::ClaimBatchMsgs(const size_t count) const noexcept
+    {
+        size_t remaining = mBatchRemaining;
+        size_t claimed = 0;
+
+        do
+        {
+            claimed = std::min(remaining, count);
+
+            if ( claimed == 0 )
+            {
+                return 0;
+            }
+        } while ( !mBatchRemaining.compare_exchange_weak(remaining, remaining - claimed) );
+
+        return claimed;
+    }
+
+    // Executor's entry point - write one batch, then post ourselves again (to the back of the line) if there's more.
+    void AsyncLogger::RunExecutorPass( ) const
+    {
+        // Anything submitted while we're running is picked up when we re-check below.
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+            mDrainState = DrainState::Posted;
+        }
+
+        ProcessBatch( );
+
+        std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+        mDrainState = DrainState::Idle;
+
+        // Done - before re-posting, or the next pass could find us still running and skip.
+        // - Note: The destructor takes the queue lock once we're done, so it can't go ahead before we've let go of it.
+        {
+            std::lock_guard<std::mutex> sl(mpExecutorState->mutex);
+            mpExecutorState->bRunning = false;
+            mpExecutorState->idleCV.notify_all( );
+        }
+
+        // Once terminating, the destructor writes out whatever is left itself.
+        if ( !mTerminate && (mMsgQueueSize != 0 || !mFlushWaiters.empty( )) )
+        {
+            WakeWorker( );
+        }
+    }
+
+    // Posted work's entry point - runs a pass for the owner, unless it's gone or already has one running.
+    void AsyncLogger::RunPostedPass(ExecutorState& state)
+    {
+        const AsyncLogger* pOwner = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lg(state.mutex);
+
+            if ( !state.pOwner || state.bRunning )
+            {
+                return;
+            }
+
+            pOwner = state.pOwner;
+            state.bRunning = true;
+        }
+
+        // The owner waits for bRunning to clear before it goes away (see StopWorker) - the pass clears it itself.
+        try
+        {
+            pOwner->RunExecutorPass( );
+        }
+        catch ( ... )
+        {
+            std::lock_guard<std::mutex> lg(state.mutex);
+            state.bRunning = false;
+            state.idleCV.notify_all( );
+            throw;
+        }
+    }
+
+    // Worker thread's wait method.
+    void AsyncLogger::WaitForMsgs( ) const
+    {
+        std::unique_lock<TrackedMutex> lock(mMsgQueueMutex);
+
+        // With a memory budget, we also wake up to free idle memory once we've been quiet for long enough.
+        const bool bTrimPending = mTrimIdleMemory && !mIdleTrimmed;
+
+        // LogSignalSafe can't wake us, and neither can staged messages going stale - poll for them instead.
+        if ( mpSignalSafeRing || mThreadStagingSize != 0 || bTrimPending )
+        {
+            std::chrono::milliseconds pollInterval = (mThreadStagingSize != 0) ? std::min(SignalSafePollInterval, StagedMsgMaxAge) : SignalSafePollInterval;
+
+            if ( bTrimPending && !mpSignalSafeRing && mThreadStagingSize == 0 )
+            {
+                pollInterval = IdleTrimDelay;
+            }
+
+            mMsgCV.wait_for(lock, pollInterval, [this] ( ) -> bool
+            {
+                return this->WaitPredicate( );
+            });
+        }
+        else
+        {
+            mMsgCV.wait(lock, [this] ( ) -> bool
+            {
+                return this->WaitPredicate( );
+            });
+        }
+
+        // Trimming frees memory, so it's done without the queue lock - producers only wait on the swaps.
+        if ( bTrimPending && !WaitPredicate( ) && std::chrono::steady_clock::now( ) - mLastBatchTime >= IdleTrimDelay )
+        {
+            lock.unlock( );
+            TrimIdleMemory( );
+            mIdleTrimmed = true;
+            lock.lock( );
+        }
+
+        // Batching disabled - write out whatever we have right away.
+        if ( mBatchLatency == std::chrono::microseconds::zero( ) )
+        {
+            return;
+        }
+
+        // Hold the partial batch until it fills up, the latency target passes, or we get told to flush/terminate.
+        mMsgCV.wait_for(lock, mBatchLatency, [this] ( ) -> bool
+        {
+            return this->BatchPredicate( );
+        });
+    }
+
+    // Worker thread's wait condition method.
+    bool AsyncLogger::WaitPredicate( ) const noexcept
+    {
+        // Wake up if we have work, someone is waiting on a flush, or we need to terminate.
+        return mMsgQueueSize != 0 || !mFlushWaiters.empty( ) || mTerminate;
+    }
+
+    // Worker thread's batch-complete condition method.
+    bool AsyncLogger::BatchPredicate( ) const noexcept
+    {
+        // Stop accumulating if the batch is full, or if someone wants the messages out now.
+        // - Note: Priority messages never wait out the batch latency.
+        // - Note: Neither do spilled messages - there's already a backlog.
+        return mLaneSizes[NormalLane] >= mBatchSize || mLaneSizes[PriorityLane] != 0 || mSpilledCount != 0 || mFlushRequested || mTerminate;
+    }
+
+    // Worker thread's termination condition method.
+    bool AsyncLogger::TerminatePredicate( ) const
+    {
+        return mTerminate && (mMsgQueueSize == 0);
+    }
+
+    // Public method helper for enqueuing new LogMessages.  Returns false if the message was dropped.
+    bool AsyncLogger::PushMsg(LogMessage&& msg) const
+    {
+        // Memory budget - shed low-priority messages past the soft limit, overflow past the hard limit.
+        if ( mpBudget )
+        {
+            const size_t footprint = msg.GetFootprint( );
+
+            switch ( mpBudget->Admit(footprint, msg.GetVerbosityLevel( )) )
+            {
+            case MemoryBudget::Admission::Admitted:
+                msg.SetCharge(*mpBudget, footprint);
+                break;
+
+            case MemoryBudget::Admission::Shed:
+                mStats.Add(StatCounters::Counter::Dropped);
+                return false;
+
+            case MemoryBudget::Admission::Overflow:
+                return OverflowMsg(std::move(msg));
+            }
+        }
+
+        // Queue wait starts here - time spent in a staging buffer counts as queued.
+        if ( mpLatency )
+        {
+            msg.SetQueuedTicks(std::chrono::steady_clock::now( ).time_since_epoch( ).count( ));
+        }
+
+        // Staging - the message goes to the queue with the rest of the thread's batch.
+        if ( mThreadStagingSize != 0 )
+        {
+            return StageMsg(std::move(msg));
+        }
+
+        bool bQueued = false;
+
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            // Shut down - no more messages.
+            if ( mShutdown )
+            {
+                mStats.Add(StatCounters::Counter::Dropped);
+                return false;
+            }
+
+            bQueued = EnqueueMsg(std::move(msg));
+        }
+
+        WriteSpillOutbox( );
+
+        return bQueued;
+    }
+
+    // Add a message to its lane's queue (or the spill outbox) - caller must hold mMsgQueueMutex.  Returns false if the message was dropped.
+    // - Note: bOverflow (memory budget's hard limit reached) keeps the message out of memory - it's spilled, or dropped.
+    // - Note: Spilled messages are only appended to the file by WriteSpillOutbox, which the caller must call once it's released the queue lock.
+    bool AsyncLogger::EnqueueMsg(LogMessage&& msg, const bool bOverflow) const
+    {
+        const size_t lane = GetLane(msg.GetVerbosityLevel( ));
+        MsgQueue& queue = GetLocalNode( ).queues[lane];
+        bool bSpilled = false;
+
+        // Numbered under the queue lock, so sequence order matches queue order within each lane.
+        msg.SetSequenceNumber(NextSequenceNumber( ));
+
+        // Past the hard limit, only the spill file has room - and priority messages are never spilled.
+        if ( bOverflow && (lane == PriorityLane || !mpSpillFile) )
+        {
+            mStats.Add(StatCounters::Counter::Dropped);
+            return false;
+        }
+
+        // Priority messages always stay in memory.  Once normal messages start spilling, they keep
+        // spilling until the file has been replayed, so they're still written in submission order.
+        if ( lane == NormalLane && (bOverflow || (mQueueCapacity != 0 && (mLaneSizes[lane] >= mQueueCapacity || mSpilledCount != 0))) )
+        {
+            if ( !mpSpillFile )
+            {
+                mStats.Add(StatCounters::Counter::Dropped);
+                return false;
+            }
+
+            mSpillOutbox.push_back(std::forward<LogMessage>(msg));
+            mSpilledCount++;
+            mSpillPending = true;
+            bSpilled = true;
+        }
+        else
+        {
+            const size_t capacity = queue.capacity( );
+
+            queue.push_back(std::forward<LogMessage>(msg));
+            mLaneSizes[lane]++;
+
+            ChargeStorage(capacity, queue.capacity( ));
+        }
+
+        mMsgQueueSize++;
+        mEnqueuedCounts[lane]++;
+        mStats.Add(StatCounters::Counter::Accepted);
+
+        // Only ever raised under the queue lock, so a plain load-and-store is enough.
+        if ( mMsgQueueSize > mMsgQueueHighWatermark.load(std::memory_order_relaxed) )
+        {
+            mMsgQueueHighWatermark.store(mMsgQueueSize, std::memory_order_relaxed);
+        }
+
+        StartWorker( );
+
+        // Only wake the worker when there's new work, a batch just filled up, or the message can't wait.
+        // - Note: Waking it for every normal message would defeat batching.
+        if ( lane == PriorityLane || bSpilled || mLaneSizes[lane] == 1 || mLaneSizes[lane] >= mBatchSize )
+        {
+            WakeWorker( );
+        }
+
+        return true;
+    }
+
+    // Public method helper for messages the memory budget has no room for - spills them, or drops them.  Returns false if the message was dropped.
+    // - Note: The thread's staged messages are handed to the queue first, so its messages stay in order.
+    bool AsyncLogger::OverflowMsg(LogMessage&& msg) const
+    {
+        std::unique_lock<TrackedMutex> stagingLock;
+
+        if ( mThreadStagingSize != 0 )
+        {
+            ThreadStaging& staging = GetThreadStaging( );
+            stagingLock = std::unique_lock<TrackedMutex>(staging.mutex);
+
+            if ( !staging.msgs.empty( ) )
+            {
+                HandOffStagedMsgs(staging);
+            }
+        }
+
+        bool bQueued = false;
+
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            // Shut down - no more messages.
+            if ( mShutdown )
+            {
+                mStats.Add(StatCounters::Counter::Dropped);
+                return false;
+            }
+
+            bQueued = EnqueueMsg(std::move(msg), true);
+        }
+
+        WriteSpillOutbox( );
+
+        return bQueued;
+    }
+
+    // Add a message to the calling thread's staging buffer, handing the buffer to the queue if the message fills it
+    // or is WARN or above.  Returns false if the message was dropped.
+    bool AsyncLogger::StageMsg(LogMessage&& msg) const
+    {
+        ThreadStaging& staging = GetThreadStaging( );
+        std::lock_guard<TrackedMutex> lg(staging.mutex);
+
+        // Shut down - no more messages.
+        // - Note: Checked under the staging lock, so Shutdown's hand-off can't miss a message staged just before it.
+        if ( mShutdown )
+        {
+            mStats.Add(StatCounters::Counter::Dropped);
+            return false;
+        }
+
+        if ( staging.msgs.empty( ) )
+        {
+            staging.firstStaged = std::chrono::steady_clock::now( );
+        }
+
+        const bool bHandOff = msg.GetVerbosityLevel( ) >= VerbosityLevel::WARN || staging.msgs.size( ) + 1 >= mThreadStagingSize;
+        const size_t capacity = staging.msgs.capacity( );
+
+        staging.msgs.push_back(std::move(msg));
+
+        ChargeStorage(capacity, staging.msgs.capacity( ));
+
+        return (bHandOff) ? HandOffStagedMsgs(staging) : true;
+    }
+
+    // Move a thread's staged messages into the queue, under a single queue lock - caller must hold staging.mutex.
+    // Returns false if any of them were dropped.
+    bool AsyncLogger::HandOffStagedMsgs(ThreadStaging& staging) const
+    {
+        bool bQueued = true;
+
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            for ( LogMessage& msg : staging.msgs )
+            {
+                bQueued &= EnqueueMsg(std::move(msg));
+            }
+        }
+
+        staging.msgs.clear( );
+
+        WriteSpillOutbox( );
+
+        return bQueued;
+    }
+
+    // Hand every thread's staged messages to the queue - or, with bStaleOnly, just those staged for longer than StagedMsgMaxAge.
+    // Also forgets the (emptied) staging buffers of threads that have exited.
+    void AsyncLogger::HandOffAllStagedMsgs(const bool bStaleOnly) const
+    {
+        if ( mThreadStagingSize == 0 )
+        {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now( );
+
+        std::lock_guard<TrackedMutex> lg(mStagingMutex);
+
+        auto it = mStagingBuffers.begin( );
+
+        while ( it != mStagingBuffers.end( ) )
+        {
+            ThreadStaging& staging = **it;
+            bool bForget = false;
+
+            {
+                std::lock_guard<TrackedMutex> sl(staging.mutex);
+
+                if ( !staging.msgs.empty( ) && (!bStaleOnly || now - staging.firstStaged >= StagedMsgMaxAge) )
+                {
+                    HandOffStagedMsgs(staging);
+                }
+
+                bForget = staging.bOrphaned && staging.msgs.empty( );
+
+                // The buffer goes away with its thread - give its storage back.
+                if ( bForget )
+                {
+                    ChargeStorage(staging.msgs.capacity( ), 0);
+                }
+            }
+
+            it = (bForget) ? mStagingBuffers.erase(it) : it + 1;
+        }
+    }
+
+    // Thread exit - let the loggers know they can forget this thread's buffers, once they've handed off what's left in them.
+    AsyncLogger::ThreadStagingCache::~ThreadStagingCache( )
+    {
+        for ( const auto& entry : entries )
+        {
+            if ( const std::shared_ptr<ThreadStaging> pStaging = entry.second.lock( ) )
+            {
+                pStaging->bOrphaned = true;
+            }
+        }
+    }
+
+    // Returns the calling thread's staging buffer for this logger, creating it on first use.
+    AsyncLogger::ThreadStaging& AsyncLogger::GetThreadStaging( ) const
+    {
+        static thread_local ThreadStagingCache t_Cache;
+
+        std::shared_ptr<ThreadStaging> pStaging;
+
+        for ( auto it = t_Cache.entries.begin( ); it != t_Cache.entries.end( ); )
+        {
+            if ( it->first == mInstanceId && (pStaging = it->second.lock( )) )
+            {
+                return *pStaging;
+            }
+
+            // Drop entries of loggers that are gone, so the cache doesn't grow with logger churn.
+            it = (it->second.expired( )) ? t_Cache.entries.erase(it) : it + 1;
+        }
+
+        // First message from this thread - the logger keeps the buffer alive, the thread just remembers it.
+        pStaging = std::make_shared<ThreadStaging>( );
+        pStaging->msgs.reserve(mThreadStagingSize);
+        ChargeStorage(0, pStaging->msgs.capacity( ));
+
+        {
+            std::lock_guard<TrackedMutex> lg(mStagingMutex);
+            mStagingBuffers.push_back(pStaging);
+        }
+
+        t_Cache.entries.emplace_back(mInstanceId, pStaging);
+
+        return *pStaging;
+    }
+
+    // Worker thread's obtain-next-batch method - takes from the priority lane first.  Returns the batch's lane.
+    // - Note: msgs is expected to be empty; its capacity is handed back to the producers on swap.
+    size_t AsyncLogger::GetQueuedMsgs(MsgQueue& msgs) const
+    {
+        // Once the in-memory backlog has cleared, the next batch is replayed from the spill file.
+        if ( mpSpillFile && ReplaySpilledMsgs(msgs) )
+        {
+            return NormalLane;
+        }
+
+        std::lock_guard<TrackedMutex> lock(mMsgQueueMutex);
+
+        const size_t lane = (mLaneSizes[PriorityLane] != 0) ? PriorityLane : NormalLane;
+        const size_t capacity = msgs.capacity( );
+
+        if ( mNodes.size( ) == 1 && mLaneSizes[lane] <= mBatchSize )
+        {
+            // Single queue that fits in one batch - just trade storage with it (no change to what's charged).
+            msgs.swap(mNodes.front( )->queues[lane]);
+            mLaneSizes[lane] = 0;
+        }
+        else
+        {
+            // Only take one batch worth of messages, leave the remainder for the next pass.
+            MergeNodeMsgs(lane, msgs);
+            ChargeStorage(capacity, msgs.capacity( ));
+        }
+
+        mMsgQueueSize -= msgs.size( );
+        mBatchRemaining = msgs.size( );
+
+        // Any pending flush request is satisfied once every lane has been fully drained.
+        if ( mMsgQueueSize == 0 )
+        {
+            mFlushRequested = false;
+        }
+
+        return lane;
+    }
+
+    // Move up to a batch worth of a lane's messages from the node queues into msgs, oldest first - caller must hold mMsgQueueMutex.
+    // - Note: Sequence numbers are assigned under the queue lock, so they give the lane's submission order across nodes.
+    void AsyncLogger::MergeNodeMsgs(const size_t lane, MsgQueue& msgs) const
+    {
+        size_t merged = 0;
+
+        std::fill(mMergePositions.begin( ), mMergePositions.end( ), 0);
+
+        while ( merged < mBatchSize )
+        {
+            // Find the node whose next message was submitted first.
+            size_t next = mNodes.size( );
+            uint64_t nextSeq = 0;
+
+            for ( size_t node = 0; node < mNodes.size( ); node++ )
+            {
+                const MsgQueue& queue = mNodes[node]->queues[lane];
+
+                if ( mMergePositions[node] < queue.size( ) && (next == mNodes.size( ) || queue[mMergePositions[node]].GetSequenceNumber( ) < nextSeq) )
+                {
+                    next = node;
+                    nextSeq = queue[mMergePositions[node]].GetSequenceNumber( );
+                }
+            }
+
+            // Every node queue has been taken in full.
+            if ( next == mNodes.size( ) )
+            {
+                break;
+            }
+
+            msgs.push_back(std::move(mNodes[next]->queues[lane][mMergePositions[next]++]));
+            merged++;
+        }
+
+        // Drop the moved-from messages from the front of each node's queue.
+        for ( size_t node = 0; node < mNodes.size( ); node++ )
+        {
+            MsgQueue& queue = mNodes[node]->queues[lane];
+            queue.erase(queue.begin( ), queue.begin( ) + mMergePositions[node]);
+        }
+
+        mLaneSizes[lane] -= merged;
+    }
+
+    // Append a message to the spill file - caller must hold mSpillMutex.  Returns false if it couldn't be written.
+    bool AsyncLogger::SpillMsg(const LogMessage& msg) const
+    {
+        const SpillFile::Header hdr
+        {
+            msg.GetVerbosityLevel( ),
+            msg.GetThreadID( ),
+            msg.GetTime( ).time_since_epoch( ).count( ),
+            msg.GetSequenceNumber( ),
+            msg.GetLength( ),
+            msg.GetNarrowFormat( ),
+            msg.GetWideFormat( )
+        };
+
+        try
+        {
+            // Raw payload - text, or a deferred message's captured arguments.
+            mpSpillFile->Append(hdr, msg.GetString( ));
+        }
+        catch ( const std::exception& )
+        {
+            // E.g., disk full - the message is dropped.
+            return false;
+        }
+
+        return true;
+    }
+
+    // Append the messages waiting in the spill outbox to the spill file - caller mustn't hold mMsgQueueMutex.
+    // - Note: Whoever queued a message to the outbox appends it - or someone else already has, along with their own.
+    void AsyncLogger::WriteSpillOutbox( ) const
+    {
+        if ( !mpSpillFile || !mSpillPending.load(std::memory_order_relaxed) )
+        {
+            return;
+        }
+
+        std::lock_guard<TrackedMutex> sl(mSpillMutex);
+
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            // The batch is empty between appends - trading storage keeps both vectors' capacity.
+            mSpillBatch.swap(mSpillOutbox);
+            mSpillPending = false;
+        }
+
+        AppendSpillBatch( );
+    }
+
+    // Append the messages taken from the spill outbox to the spill file, in the order they were queued - caller must hold mSpillMutex.
+    // - Note: Messages that can't be appended (e.g., disk full) are lost - they count as failed, and as written so flush waiters
+    //         aren't left hanging (the worker writes them off, see ProcessBatch).
+    void AsyncLogger::AppendSpillBatch( ) const
+    {
+        size_t lost = 0;
+
+        for ( const LogMessage& msg : mSpillBatch )
+        {
+            lost += (SpillMsg(msg)) ? 0 : 1;
+        }
+
+        // Release payloads (and their budget charges) now that the file has them.
+        mSpillBatch.clear( );
+
+        if ( lost != 0 )
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            mSpilledCount -= lost;
+            mMsgQueueSize -= lost;
+            mSpillLost += lost;
+            mStats.Add(StatCounters::Counter::Failed, lost);
+
+            WakeWorker( );
+        }
+    }
+
+    // Worker's spill file replay - if the in-memory backlog has cleared, moves the next batch of spilled messages into msgs.
+    // Returns false (without touching msgs) if there's something in memory to write first, or nothing spilled.
+    // - Note: The file is read under mSpillMutex alone, so producers can keep queueing (and spilling) while it's read.
+    bool AsyncLogger::ReplaySpilledMsgs(MsgQueue& msgs) const
+    {
+        std::lock_guard<TrackedMutex> sl(mSpillMutex);
+
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            if ( mLaneSizes[PriorityLane] != 0 || mLaneSizes[NormalLane] != 0 || mSpilledCount == 0 )
+            {
+                return false;
+            }
+
+            // Append whatever's still in the outbox first, so the file has every spilled message in order.
+            mSpillBatch.swap(mSpillOutbox);
+            mSpillPending = false;
+        }
+
+        AppendSpillBatch( );
+
+        const size_t capacity = msgs.capacity( );
+        const size_t dropped = ReadSpilledMsgs(msgs);
+
+        ChargeStorage(capacity, msgs.capacity( ));
+
+        std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+        // Dropped messages still count as written, so flush waiters aren't left hanging.
+        mSpilledCount -= msgs.size( ) + dropped;
+        mMsgQueueSize -= msgs.size( ) + dropped;
+        mWrittenCounts[NormalLane] += dropped;
+        mBatchRemaining = msgs.size( );
+
+        // Any pending flush request is satisfied once every lane has been fully drained.
+        if ( mMsgQueueSize == 0 )
+        {
+            mFlushRequested = false;
+        }
+
+        return true;
+    }
+
+    // Move the next batch of spilled messages into msgs - caller must hold mSpillMutex.  Returns number of messages dropped.
+    size_t AsyncLogger::ReadSpilledMsgs(MsgQueue& msgs) const
+    {
+        PayloadPool& pool = GetLocalNode( ).pool;
+        size_t dropped = 0;
+
+        try
+        {
+            while ( msgs.size( ) < mBatchSize && !mpSpillFile->Empty( ) )
+            {
+                SpillFile::Header hdr;
+                mpSpillFile->PeekHeader(hdr);
+
+                const LogTime time(LogClock::duration(hdr.ticks));
+                LogMessage msg = (hdr.pNarrowFormat) ? LogMessage(hdr.lvl, hdr.tid, time, pool, hdr.len, hdr.pNarrowFormat)
+                    : (hdr.pWideFormat) ? LogMessage(hdr.lvl, hdr.tid, time, pool, hdr.len, hdr.pWideFormat)
+                    : LogMessage(hdr.lvl, hdr.tid, time, pool, hdr.len);
+
+                mpSpillFile->ReadPayload(hdr, msg.GetBuffer( ));
+                msg.SetSequenceNumber(hdr.seq);
+
+                msgs.push_back(std::move(msg));
+            }
+        }
+        catch ( const std::exception& )
+        {
+            // Spill file can't be read back - drop the rest of it rather than replay garbage.
+            dropped = mpSpillFile->Discard( );
+            mStats.Add(StatCounters::Counter::Failed, dropped);
+        }
+
+        return dropped;
+    }
+
+    // Main part of worker thread's work-flow.
+    // Attempts to log queued message using the owned logger object, flushing it afterwards if bFlush is set.
+    void AsyncLogger::LogMsgs(MsgQueue& msgs, const bool bFlush) const
+    {
+        // The whole batch left the queue together.
+        const std::chrono::steady_clock::time_point dequeued = (mpLatency) ? std::chrono::steady_clock::now( ) : std::chrono::steady_clock::time_point( );
+        size_t claimed = 0;
+
+        for ( const LogMessage& msg : msgs )
+        {
+            bool success = false;
+            bool coalesced = false;
+
+            // Messages are claimed a few at a time - once Shutdown runs out of time, the rest of the batch has already
+            // been counted as discarded.
+            if ( claimed == 0 && (claimed = ClaimBatchMsgs(BatchClaimSize)) == 0 )
+            {
+                break;
+            }
+
+            claimed--;
+
+            try
+            {
+                const LogRecord record { msg.GetVerbosityLevel( ), msg.GetThreadID( ), msg.GetTime( ), RenderMsg(msg, mRenderBuffer), msg.GetSequenceNumber( ) };
+
+                // Repeats are counted rather than written.
+                coalesced = mpCoalescer && !CoalesceMsg(record, msg);
+
+                // Hand the finished text straight to the logger - no second printf pass.
+                // - Note: Only the write itself is timed, not the rendering/coalescing before it.
+                if ( !coalesced )
+                {
+                    const std::chrono::steady_clock::time_point writeStarted = (mpLatency) ? std::chrono::steady_clock::now( ) : std::chrono::steady_clock::time_point( );
+
+                    success = mpLogger->WriteRecord(record);
+
+                    if ( mpLatency )
+                    {
+                        mpLatency->sinkWrite.Record(std::chrono::steady_clock::now( ) - writeStarted);
+                    }
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                try
+                {
+                    static const utf8* errFormat = __FUNCTION__" - Failed to log message: exception \"%s\", msg \"%ls\".";
+                    static const utf16* deferredMsg = UTF16_LITERAL_STR("<deferred message>");
+                    // Try to log that we failed with exception string and original message.
+                    // - Note: A deferred message's payload holds captured arguments, not text.
+                    mpLogger->Log(VerbosityLevel::WARN, errFormat, e.what( ), (msg.IsDeferred( )) ? deferredMsg : msg.GetString( ));
+                }
+                catch ( const std::exception& )
+                {
+                    // Best effort - counted as a failure below.
+                }
+            }
+
+            // Spilled messages weren't stamped when they were queued - only the sink write is known for them.
+            if ( mpLatency && msg.GetQueuedTicks( ) != 0 )
+            {
+                mpLatency->queueWait.Record(dequeued - std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(msg.GetQueuedTicks( ))));
+            }
+
+            // Record success/failure of log with counter.
+            // We attempt to log these stats upon destruction.
+            if ( coalesced )
+            {
+                mStats.Add(StatCounters::Counter::Coalesced);
+            }
+            else if ( success )
+            {
+                mStats.Add(StatCounters::Counter::Written);
+            }
+            else
+            {
+                mStats.Add(StatCounters::Counter::Failed);
+            }
+        }
+
+        // Release payloads back to the pool, but keep the vector's capacity for the next batch.
+        msgs.clear( );
+
+        // Runs whose window has passed get their summary before the batch is flushed.
+        if ( mpCoalescer && !mDiscard )
+        {
+            WriteDueSummaries(false);
+        }
+
+        // When batching, the sink's periodic flushing is disabled - flush once per batch instead.
+        // - Note: Sinks with a delivery queue flush themselves after each pass, so only the in-line ones are flushed here.
+        if ( bFlush && !mDiscard )
+        {
+            try
+            {
+                if ( mpSinkWorkers )
+                {
+                    mpSinkWorkers->FlushInlineSinks( );
+                }
+                else
+                {
+                    mpLogger->Flush( );
+                }
+            }
+            catch ( const std::exception& )
+            {
+                // Best effort - the sink will attempt to restore its stream on the next write.
+            }
+        }
+    }
+
+    // Returns message text - deferred messages are formatted here (into buf), on the worker thread.
+    // - Note: The returned string is only valid until buf is next used.
+    std::basic_string_view<utf16> AsyncLogger::RenderMsg(const LogMessage& msg, std::basic_string<utf16>& buf) const
+    {
+        if ( !msg.IsDeferred( ) )
+        {
+            // Stored length includes the null-terminator.
+            return std::basic_string_view<utf16>(msg.GetString( ), msg.GetLength( ) - 1);
+        }
+
+        // Reuse the render buffer's capacity between messages.
+        buf.clear( );
+
+        if ( msg.GetNarrowFormat( ) )
+        {
+            DeferredFormat::Render<utf8>(msg.GetNarrowFormat( ), msg.GetCapture( ), msg.GetCaptureSize( ), buf);
+        }
+        else
+        {
+            DeferredFormat::Render<utf16>(msg.GetWideFormat( ), msg.GetCapture( ), msg.GetCaptureSize( ), buf);
+        }
+
+        return buf;
+    }
+
+    // Pre-size the queues and the batch (constructor only) - see mQueueReserve.
+    void AsyncLogger::ReserveQueueStorage( ) const
+    {
+        for ( const std::unique_ptr<NodeQueues>& pNode : mNodes )
+        {
+            for ( MsgQueue& queue : pNode->queues )
+            {
+                queue.reserve(mQueueReserve);
+                ChargeStorage(0, queue.capacity( ));
+            }
+        }
+
+        mBatch.reserve(GetBatchReserve( ));
+        ChargeStorage(0, mBatch.capacity( ));
+    }
+
+    // Returns how many messages the batch is sized for - a lone queue trades storage with it, node queues are merged into it a batch at a time.
+    size_t AsyncLogger::GetBatchReserve( ) const noexcept
+    {
+        return (mNodes.size( ) == 1) ? mQueueReserve : mBatchSize;
+    }
+
+    // Free payload slabs with nothing in use, and queue storage grown past its usual size - caller mustn't hold mMsgQueueMutex (worker only).
+    // - Note: Called once the worker has been idle for IdleTrimDelay, so the queues are usually empty.
+    // - Note: Replacement storage is allocated before taking the queue lock, and the grown storage freed after it.
+    void AsyncLogger::TrimIdleMemory( ) const noexcept
+    {
+        try
+        {
+            std::vector<MsgQueue> spares;
+            spares.reserve(mNodes.size( ) * LaneCount);
+
+            for ( const std::unique_ptr<NodeQueues>& pNode : mNodes )
+            {
+                // Lock-free - safe alongside producers.
+                pNode->pool.Trim( );
+
+                for ( const MsgQueue& queue : pNode->queues )
+                {
+                    spares.emplace_back(queue.get_allocator( ));
+                    spares.back( ).reserve(mQueueReserve);
+                }
+            }
+
+            {
+                std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+                size_t spare = 0;
+
+                for ( const std::unique_ptr<NodeQueues>& pNode : mNodes )
+                {
+                    for ( MsgQueue& queue : pNode->queues )
+                    {
+                        MsgQueue& replacement = spares[spare++];
+
+                        if ( queue.empty( ) && queue.capacity( ) > replacement.capacity( ) )
+                        {
+                            ChargeStorage(queue.capacity( ), replacement.capacity( ));
+                            queue.swap(replacement);
+                        }
+                    }
+                }
+            }
+
+            // The batch is only ever swapped with the queue by this thread, and is empty between batches.
+            if ( mBatch.capacity( ) > GetBatchReserve( ) )
+            {
+                MsgQueue replacement(mBatch.get_allocator( ));
+                replacement.reserve(GetBatchReserve( ));
+
+                ChargeStorage(mBatch.capacity( ), replacement.capacity( ));
+                mBatch.swap(replacement);
+            }
+
+            // Leaving scope frees the grown storage (and any unused spares) - outside the queue lock.
+        }
+        catch ( const std::exception& )
+        {
+            // Best effort - the memory is freed next time.
+        }
+    }
+
+    // Charge (or give back) the change in a queue, batch or staging buffer's capacity to the memory budget (if any).
+    void AsyncLogger::ChargeStorage(const size_t slotsBefore, const size_t slotsAfter) const noexcept
+    {
+        if ( !mpBudget || slotsBefore == slotsAfter )
+        {
+            return;
+        }
+
+        if ( slotsAfter > slotsBefore )
+        {
+            const size_t bytes = (slotsAfter - slotsBefore) * sizeof(LogMessage);
+
+            mpBudget->Charge(bytes);
+            mStorageCharge.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+        else
+        {
+            const size_t bytes = (slotsBefore - slotsAfter) * sizeof(LogMessage);
+
+            mpBudget->Release(bytes);
+            mStorageCharge.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    // Write a summary of the latency histograms to the log - covering the messages written since the last summary (worker only).
+    void AsyncLogger::WriteLatencySummary( ) const
+    {
+        LatencyStats latest = GetLatencyStats( );
+        LatencyStats interval = latest;
+
+        interval.queueWait -= mpLatency->summarized.queueWait;
+        interval.sinkWrite -= mpLatency->summarized.sinkWrite;
+        interval.logCall -= mpLatency->summarized.logCall;
+
+        mpLatency->summarized = std::move(latest);
+        mpLatency->lastSummary = std::chrono::steady_clock::now( );
+
+        // Nothing new since the last summary.
+        if ( interval.sinkWrite.count == 0 && interval.logCall.count == 0 )
+        {
+            return;
+        }
+
+        const auto us = [ ] (const std::chrono::nanoseconds& ns) -> unsigned long long
+        {
+            return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::microseconds>(ns).count( ));
+        };
+
+        try
+        {
+            mpLogger->Log(
+                VerbosityLevel::INFO,
+                __FUNCTION__" - latency (us, p50/p99/max) - queue wait %llu/%llu/%llu, sink write %llu/%llu/%llu, Log call %llu/%llu/%llu (%llu messages written).",
+                us(interval.queueWait.GetPercentile(50.0)), us(interval.queueWait.GetPercentile(99.0)), us(interval.queueWait.GetMax( )),
+                us(interval.sinkWrite.GetPercentile(50.0)), us(interval.sinkWrite.GetPercentile(99.0)), us(interval.sinkWrite.GetMax( )),
+                us(interval.logCall.GetPercentile(50.0)), us(interval.logCall.GetPercentile(99.0)), us(interval.logCall.GetMax( )),
+                static_cast<unsigned long long>(interval.sinkWrite.count)
+            );
+        }
+        catch ( const std::exception& )
+        {
+            // Best effort - the histograms themselves are unaffected.
+        }
+    }
+
+    // Pass a message's record through the coalescer, writing any summaries due ahead of it - returns whether it should be written (worker only).
+    // - Note: Only deferred messages still know their format string, so other messages are coalesced by their text.
+    bool AsyncLogger::CoalesceMsg(const LogRecord& record, const LogMessage& msg) const
+    {
+        const bool bWrite = mpCoalescer->Submit(record, msg.GetNarrowFormat( ), msg.GetWideFormat( ), mCoalesceSummaries);
+
+        WriteCoalesceSummaries( );
+
+        return bWrite;
+    }
+
+    // Write the coalescer's summaries that are due (bAll - every pending summary, e.g., on destruction) (worker only).
+    void AsyncLogger::WriteDueSummaries(const bool bAll) const
+    {
+        mpCoalescer->Expire(LogClock::now( ), bAll, mCoalesceSummaries);
+
+        WriteCoalesceSummaries( );
+    }
+
+    // Write summaries the coalescer has handed back, then forget them (worker only).
+    // - Note: Summaries aren't messages in their own right, so they aren't counted as written - and they take the sequence
+    //         number of the message that ended their run, since the worker's own numbers would sort after newer messages.
+    void AsyncLogger::WriteCoalesceSummaries( ) const
+    {
+        for ( const MessageCoalescer::Summary& summary : mCoalesceSummaries )
+        {
+            try
+            {
+                mpLogger->WriteRecord(LogRecord { summary.lvl, summary.tid, summary.time, summary.message, summary.seq });
+            }
+            catch ( const std::exception& )
+            {
+                // Best effort - the repeats were counted either way.
+            }
+        }
+
+        mCoalesceSummaries.clear( );
+    }
+
+    // Returns whether the call site is over its rate limit, counting the message if so - checked before anything is formatted.
+    // - Note: Messages no sink would log don't count against the call site.
+    bool AsyncLogger::IsRateLimited(const VerbosityLevel& lvl, const void* pSite) const noexcept
+    {
+        if ( !mpRateLimiter || lvl < mRateLimitThreshold || mpRateLimiter->Allow(pSite, lvl) )
+        {
+            return false;
+        }
+
+        mStats.Add(StatCounters::Counter::RateLimited);
+
+        return true;
+    }
+
+    // Returns the start time of a Log call, for StopLogCallTimer (default time point if latency histograms are disabled).
+    std::chrono::steady_clock::time_point AsyncLogger::StartLogCallTimer( ) const noexcept
+    {
+        return (mpLatency) ? std::chrono::steady_clock::now( ) : std::chrono::steady_clock::time_point( );
+    }
+
+    // Record how long a Log call took, from StartLogCallTimer's time.
+    void AsyncLogger::StopLogCallTimer(const std::chrono::steady_clock::time_point& start) const noexcept
+    {
+        if ( mpLatency )
+        {
+            mpLatency->logCall.Record(std::chrono::steady_clock::now( ) - start);
+        }
+    }
+
+    // Flush the underlying logger and release flush waiters whose messages have all been written.
+    // - Note: bAll releases every waiter regardless of target (e.g., once the worker has exited).
+    void AsyncLogger::CompleteFlushWaiters(const LaneCounts& written, const bool bAll) const
+    {
+        std::vector<FlushWaiter> ready;
+        std::shared_ptr<std::vector<FlushWaiter>> pReady;
+        bool flushed = false;
+
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            if ( mFlushWaiters.empty( ) )
+            {
+                return;
+            }
+
+            // Waiters are appended in submission order, so their targets never decrease (in any lane).
+            auto it = mFlushWaiters.begin( );
+            while ( it != mFlushWaiters.end( ) && (bAll || (it->targets[NormalLane] <= written[NormalLane] && it->targets[PriorityLane] <= written[PriorityLane])) )
+            {
+                ++it;
+            }
+
+            std::move(mFlushWaiters.begin( ), it, std::back_inserter(ready));
+            mFlushWaiters.erase(mFlushWaiters.begin( ), it);
+        }
+
+        if ( ready.empty( ) )
+        {
+            return;
+        }
+
+        try
+        {
+            // Queued sinks finish the flush on their own workers - we don't wait on a slow sink here.
+            // - Note: FlushAsync only throws before it has asked anything of the sinks, so the waiters are still ours then.
+            if ( mpSinkWorkers )
+            {
+                pReady = std::make_shared<std::vector<FlushWaiter>>(std::move(ready));
+
+                mpSinkWorkers->FlushAsync([pReady] (const bool bFlushed)
+                {
+                    for ( FlushWaiter& waiter : *pReady )
+                    {
+                        CompleteFlushWaiter(waiter, bFlushed);
+                    }
+                });
+
+                return;
+            }
+
+            flushed = mpLogger && mpLogger->Flush( );
+        }
+        catch ( const std::exception& )
+        {
+            flushed = false;
+        }
+
+        for ( FlushWaiter& waiter : (pReady) ? *pReady : ready )
+        {
+            CompleteFlushWaiter(waiter, flushed);
+        }
+    }
+
+    // Register a flush barrier for everything submitted so far (or complete it now, if nothing ever was).
+    void AsyncLogger::AddFlushWaiter(FlushWaiter&& waiter) const
+    {
+        bool flushed = false;
+
+        // Staged messages were submitted before the barrier too.
+        HandOffAllStagedMsgs(false);
+
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            // Shut down - the worker is stopped (or abandoned to a stuck sink), so leave the sink alone.
+            // Everything was written and flushed, unless Shutdown ran out of time.
+            if ( mTerminate )
+            {
+                flushed = !mDiscard;
+            }
+            // Worker thread is started by the first message - if it isn't running (and there's no executor), nothing was ever queued.
+            else if ( mpExecutor || mWorkerThread.joinable( ) )
+            {
+                // Wait for everything submitted so far, and don't let a partial batch sit out its latency target.
+                waiter.targets = mEnqueuedCounts;
+                mFlushWaiters.push_back(std::move(waiter));
+                mFlushRequested = true;
+                WakeWorker( );
+
+                return;
+            }
+            else
+            {
+                // Nothing is queued - just flush the underlying logger ourselves.
+                // - Note: Holding the queue lock keeps a worker from starting up and writing to it concurrently.
+                try
+                {
+                    flushed = mpLogger && mpLogger->Flush( );
+                }
+                catch ( const std::exception& )
+                {
+                    flushed = false;
+                }
+            }
+        }
+
+        // Complete outside the lock - a callback is free to log again.
+        CompleteFlushWaiter(waiter, flushed);
+    }
+
+    // Deliver a flush barrier's result to its callback or promise.
+    void AsyncLogger::CompleteFlushWaiter(FlushWaiter& waiter, const bool bFlushed) noexcept
+    {
+        if ( waiter.onFlushed )
+        {
+            try
+            {
+                waiter.onFlushed(bFlushed);
+            }
+            catch ( ... )
+            {
+                // Best effort - a throwing callback must not take the worker down with it.
+            }
+        }
+        else if ( bFlushed )
+        {
+            waiter.promise.set_value( );
+        }
+        else
+        {
+            waiter.promise.set_exception(std::make_exception_ptr(std::runtime_error(__FUNCTION__" - Underlying logger failed to flush.")));
+        }
+    }
+
+    // Returns the lane a message of the given verbosity level is queued in.
+    size_t AsyncLogger::GetLane(const VerbosityLevel& lvl) noexcept
+    {
+        return (lvl >= VerbosityLevel::ERROR) ? PriorityLane : NormalLane;
+    }
+
+    // Returns the queues and payload pool of the NUMA node the calling thread is running on.
+    // - Note: Threads can migrate at any time - this only picks the likeliest local node, correctness doesn't depend on it.
+    AsyncLogger::NodeQueues& AsyncLogger::GetLocalNode( ) const noexcept
+    {
+        if ( mNodes.size( ) == 1 )
+        {
+            return *mNodes.front( );
+        }
+
+        return *mNodes[std::min(NumaHelper::GetCurrentNode( ), mNodes.size( ) - 1)];
+    }
+
+    // Returns placement of queue memory that isn't tied to a NUMA node (e.g., the batch vector).
+    NumaHelper::Placement AsyncLogger::GetQueuePlacement(const ConfigPackage& config) noexcept
+    {
+        NumaHelper::Placement placement;
+
+        placement.bLargePages = config.GetAsyncLargePages( );
+        placement.bPrefault = config.GetAsyncPrefaultMemory( );
+
+        return placement;
+    }
+
+    // Build one set of queues per NUMA node (or a single set, not tied to any node, when not NUMA-aware).
+    std::vector<std::unique_ptr<AsyncLogger::NodeQueues>> AsyncLogger::BuildNodes(const ConfigPackage& config)
+    {
+        std::vector<std::unique_ptr<NodeQueues>> nodes;
+        const size_t nodeCount = (config.GetAsyncNumaAware( )) ? NumaHelper::GetNodeCount( ) : 1;
+        NumaHelper::Placement placement = GetQueuePlacement(config);
+
+        // A lone set is placed like the batch vector, so the two can keep trading storage.
+        if ( nodeCount == 1 )
+        {
+            nodes.push_back(std::make_unique<NodeQueues>(placement));
+            return nodes;
+        }
+
+        nodes.reserve(nodeCount);
+
+        for ( placement.node = 0; placement.node < nodeCount; placement.node++ )
+        {
+            nodes.push_back(std::make_unique<NodeQueues>(placement));
+        }
+
+        return nodes;
+    }
+
+    // Build the latency histograms, if they're enabled (null otherwise).
+    std::unique_ptr<AsyncLogger::LatencyHistograms> AsyncLogger::BuildLatencyHistograms(const ConfigPackage& config)
+    {
+        if ( !config.GetAsyncLatencyHistograms( ) )
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<LatencyHistograms> pLatency = std::make_unique<LatencyHistograms>( );
+        pLatency->lastSummary = std::chrono::steady_clock::now( );
+
+        return pLatency;
+    }
+
+    // Build the spill file, if the queue is bounded and a path is configured (null otherwise).
+    // - Note: Preallocates a full queue's worth of inline-sized records, up to SpillPreallocationLimit - clamped before
+    //         multiplying, so a huge capacity can't wrap around to a tiny size.
+    std::unique_ptr<SpillFile> AsyncLogger::BuildSpillFile(const ConfigPackage& config, const size_t queueCapacity)
+    {
+        if ( queueCapacity == 0 || config.GetAsyncSpillFile( ).empty( ) )
+        {
+            return nullptr;
+        }
+
+        const uint64_t recordSize = SpillFile::GetRecordSize(LogMessage::InlineLength);
+        const uint64_t preallocateBytes = (queueCapacity > SpillPreallocationLimit / recordSize) ? SpillPreallocationLimit : queueCapacity * recordSize;
+
+        return std::make_unique<SpillFile>(config.GetAsyncSpillFile( ), preallocateBytes);
+    }
+
+    // Build the coalescer, if either ConfigPackage enables coalescing (null otherwise).
+    // - Note: One coalescer serves both sinks - if both ConfigPackages enable it, their settings must match.
+    std::unique_ptr<MessageCoalescer> AsyncLogger::BuildCoalescer(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig)
+    {
+        const bool bStdOut = stdOutConfig.GetCoalesceWindow( ) != std::chrono::milliseconds::zero( );
+        const bool bFile = fileConfig.GetCoalesceWindow( ) != std::chrono::milliseconds::zero( );
+
+        if ( !bStdOut && !bFile )
+        {
+            return nullptr;
+        }
+
+        if ( bStdOut && bFile && (stdOutConfig.GetCoalesceWindow( ) != fileConfig.GetCoalesceWindow( ) || stdOutConfig.GetCoalesceByFormat( ) != fileConfig.GetCoalesceByFormat( )) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - ConfigPackages have different coalescing settings.");
+        }
+
+        const ConfigPackage& config = (bStdOut) ? stdOutConfig : fileConfig;
+
+        return std::make_unique<MessageCoalescer>(config.GetCoalesceWindow( ), config.GetCoalesceByFormat( ));
+    }
+
+    // Returns the rate limiter both ConfigPackages share - call sites are limited once, before the message is queued for either sink.
+    const std::shared_ptr<RateLimiter>& AsyncLogger::GetSharedRateLimiter(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig)
+    {
+        if ( stdOutConfig.GetRateLimiter( ) != fileConfig.GetRateLimiter( ) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - ConfigPackages have different rate limiters.");
+        }
+
+        return stdOutConfig.GetRateLimiter( );
+    }
+
+    // Build the sinks with their own delivery queues and workers - null if no sink asked for one (see ConfigPackage::SetAsyncSinkQueueCapacity).
+    // - Note: Same sink selection as BuildLogger - stdout takes stdOutConfig, the file takes fileConfig.
+    std::shared_ptr<SinkWorkerLogger> AsyncLogger::BuildSinkWorkers(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig)
+    {
+        const OptionFlag compositeMask = stdOutConfig.GetOptionFlags( ) | fileConfig.GetOptionFlags( );
+        const bool bStdOut = (compositeMask & OptionFlag::LogToStdout) == OptionFlag::LogToStdout;
+        const bool bFile = (compositeMask & OptionFlag::LogToFile) == OptionFlag::LogToFile;
+        std::vector<SinkWorkerLogger::SinkSettings> sinks;
+
+        if ( (!bStdOut || stdOutConfig.GetAsyncSinkQueueCapacity( ) == 0) && (!bFile || fileConfig.GetAsyncSinkQueueCapacity( ) == 0) )
+        {
+            return nullptr;
+        }
+
+        if ( bStdOut )
+        {
+            sinks.push_back(SinkWorkerLogger::SinkSettings { std::make_shared<StdOutLogger>(stdOutConfig), stdOutConfig.GetAsyncSinkQueueCapacity( ), stdOutConfig.GetAsyncSinkBlockWhenFull( ) });
+        }
+
+        if ( bFile )
+        {
+            sinks.push_back(SinkWorkerLogger::SinkSettings { std::make_shared<FileLogger>(fileConfig), fileConfig.GetAsyncSinkQueueCapacity( ), fileConfig.GetAsyncSinkBlockWhenFull( ) });
+        }
+
+        return std::make_shared<SinkWorkerLogger>(std::move(sinks));
+    }
+
+    // Crash hook - stop accepting messages and write out whatever is still queued, until the deadline (see CrashDrain).
+    // - Note: Runs on the crashing thread, so it never blocks on a lock that thread may hold.  The sink is taken over from
+    //         the worker first (waiting out the batch it's writing, for up to CrashSinkWait), and never handed back.
+    // - Note: Queued messages are written in place, and the buffers used otherwise were sized when we registered.  After a
+    //         signal (bSignal), deferred messages and the spill file are skipped, since rendering or reading them allocates.
+    void AsyncLogger::DrainOnCrash(const std::chrono::steady_clock::time_point& deadline, const bool bSignal) const noexcept
+    {
+        const std::thread::id self = std::this_thread::get_id( );
+        const std::chrono::steady_clock::time_point sinkDeadline = std::min(deadline, std::chrono::steady_clock::now( ) + CrashSinkWait);
+        std::thread::id owner;
+
+        // If the crashing thread was in the middle of a batch itself, the sink is in no state to take any more.
+        while ( !mSinkOwner.compare_exchange_weak(owner, self) )
+        {
+            if ( owner == self || std::chrono::steady_clock::now( ) >= sinkDeadline )
+            {
+                return;
+            }
+
+            owner = std::thread::id( );
+            std::this_thread::yield( );
+        }
+
+        if ( !TryLockOnCrash(mMsgQueueMutex, deadline) )
+        {
+            return;
+        }
+
+        // The queue lock is never released - producers (and the worker's next batch) stay blocked while the process goes down.
+        mTerminate = true;
+
+        // Sink workers won't get to anything queued for them now - have it all written straight to the sinks instead.
+        if ( mpSinkWorkers )
+        {
+            mpSinkWorkers->TakeOverSinks(deadline);
+        }
+
+        bool bInTime = WriteLaneOnCrash(PriorityLane, deadline, bSignal) && WriteLaneOnCrash(NormalLane, deadline, bSignal);
+
+        // Spilled messages come after everything in the normal lane - the file's, then the outbox's (not appended yet).
+        // - Note: The spill lock is only tried, since we hold the queue lock - and like it, it's kept.  If it's held
+        //         (e.g., the crashing thread was appending), the file is skipped.
+        if ( bInTime && !bSignal && mpSpillFile && TryLockOnCrash(mSpillMutex, deadline) )
+        {
+            try
+            {
+                while ( bInTime && !mpSpillFile->Empty( ) )
+                {
+                    ReadSpilledMsgs(mCrashBatch);
+
+                    for ( const LogMessage& msg : mCrashBatch )
+                    {
+                        bInTime = bInTime && WriteMsgOnCrash(msg, msg.GetSequenceNumber( ), deadline, bSignal);
+                    }
+
+                    mCrashBatch.clear( );
+                }
+            }
+            catch ( ... )
+            {
+                // Best effort - move on to the outbox.
+            }
+        }
+
+        for ( const LogMessage& msg : mSpillOutbox )
+        {
+            bInTime = bInTime && WriteMsgOnCrash(msg, msg.GetSequenceNumber( ), deadline, bSignal);
+        }
+
+        // Staged messages haven't reached the queue yet - they're the newest of all, and aren't numbered until now.
+        // - Note: Like the queue lock, staging locks are kept, and buffers whose lock is held (e.g., by the crashing thread) are skipped.
+        if ( bInTime && mThreadStagingSize != 0 && TryLockOnCrash(mStagingMutex, deadline) )
+        {
+            for ( const std::shared_ptr<ThreadStaging>& pStaging : mStagingBuffers )
+            {
+                if ( !bInTime || !TryLockOnCrash(pStaging->mutex, deadline) )
+                {
+                    continue;
+                }
+
+                for ( const LogMessage& msg : pStaging->msgs )
+                {
+                    bInTime = bInTime && WriteMsgOnCrash(msg, NextSequenceNumber( ), deadline, bSignal);
+                }
+            }
+        }
+
+        // Also pushes out anything the worker already wrote that's still sitting in the sink's buffer.
+        try
+        {
+            mpLogger->Flush( );
+        }
+        catch ( ... )
+        {
+            // Best effort - nothing more we can do.
+        }
+    }
+
+    // Write a lane's queued messages for the crash hook, in submission order - straight from the node queues, so nothing
+    // is moved or allocated.  Returns false if the deadline passed first.
+    bool AsyncLogger::WriteLaneOnCrash(const size_t lane, const std::chrono::steady_clock::time_point& deadline, const bool bSignal) const noexcept
+    {
+        std::fill(mMergePositions.begin( ), mMergePositions.end( ), 0);
+
+        for ( ;; )
+        {
+            // Find the node whose next message was submitted first.
+            size_t next = mNodes.size( );
+            uint64_t nextSeq = 0;
+
+            for ( size_t node = 0; node < mNodes.size( ); node++ )
+            {
+                const MsgQueue& queue = mNodes[node]->queues[lane];
+
+                if ( mMergePositions[node] < queue.size( ) && (next == mNodes.size( ) || queue[mMergePositions[node]].GetSequenceNumber( ) < nextSeq) )
+                {
+                    next = node;
+                    nextSeq = queue[mMergePositions[node]].GetSequenceNumber( );
+                }
+            }
+
+            // Every node queue has been written in full.
+            if ( next == mNodes.size( ) )
+            {
+                return true;
+            }
+
+            if ( !WriteMsgOnCrash(mNodes[next]->queues[lane][mMergePositions[next]++], nextSeq, deadline, bSignal) )
+            {
+                return false;
+            }
+        }
+    }
+
+    // Write one message for the crash hook.  Returns false (without writing it) if the deadline has passed.
+    // - Note: After a signal, deferred messages are skipped (and counted as dropped) - rendering them allocates.
+    bool AsyncLogger::WriteMsgOnCrash(const LogMessage& msg, const uint64_t seq, const std::chrono::steady_clock::time_point& deadline, const bool bSignal) const noexcept
+    {
+        if ( std::chrono::steady_clock::now( ) >= deadline )
+        {
+            return false;
+        }
+
+        if ( bSignal && msg.IsDeferred( ) )
+        {
+            mStats.Add(StatCounters::Counter::Dropped);
+            return true;
+        }
+
+        try
+        {
+            mpLogger->WriteRecord(LogRecord { msg.GetVerbosityLevel( ), msg.GetThreadID( ), msg.GetTime( ), RenderMsg(msg, mCrashRenderBuffer), seq });
+        }
+        catch ( ... )
+        {
+            // Best effort - keep going with the rest.
+        }
+
+        return true;
+    }
+
+    // Try (until the deadline) to take a lock for the crash hook - gives up right away if the crashing thread holds it.
+    bool AsyncLogger::TryLockOnCrash(TrackedMutex& mutex, const std::chrono::steady_clock::time_point& deadline) noexcept
+    {
+        if ( mutex.HeldByCurrentThread( ) )
+        {
+            return false;
+        }
+
+        while ( !mutex.try_lock( ) )
+        {
+            if ( std::chrono::steady_clock::now( ) >= deadline )
+            {
+                return false;
+            }
+
+            std::this_thread::yield( );
+        }
+
+        return true;
+    }
+
+    // Write out messages submitted via LogSignalSafe (worker only).
+    void AsyncLogger::DrainSignalSafeMsgs( ) const
+    {
+        if ( !mpSignalSafeRing )
+        {
+            return;
+        }
+
+        for ( const SignalSafeRing::Entry* pEntry = mpSignalSafeRing->Front( ); pEntry; pEntry = mpSignalSafeRing->Front( ) )
+        {
+            bool success = false;
+
+            // Signal-safe messages are counted here rather than by LogSignalSafe, which mustn't touch the per-thread counters.
+            mStats.Add(StatCounters::Counter::Accepted);
+
+            // Shutdown ran out of time - drop them rather than hold up the worker any longer.
+            if ( mDiscard )
+            {
+                mStats.Add(StatCounters::Counter::Dropped);
+                mpSignalSafeRing->Pop( );
+                continue;
+            }
+
+            try
+            {
+                success = mpLogger->WriteRecord(LogRecord { pEntry->lvl, pEntry->tid, LogTime(LogClock::duration(pEntry->ticks)), std::basic_string_view<utf16>(pEntry->text, pEntry->len), pEntry->seq });
+            }
+            catch ( const std::exception& )
+            {
+                // Best effort - counted as a failure below.
+            }
+
+            if ( success )
+            {
+                mStats.Add(StatCounters::Counter::Written);
+            }
+            else
+            {
+                mStats.Add(StatCounters::Counter::Failed);
+            }
+
+            mpSignalSafeRing->Pop( );
+        }
+    }
+
+    // LogSignalSafe implementation - allocation-free and lock-free.
+    template <class T>
+    bool AsyncLogger::LogSignalSafeInternal(const VerbosityLevel& lvl, const T* pFormat, va_list pArgs) const noexcept
+    {
+        uint64_t ticket = 0;
+
+        if ( !mpSignalSafeRing || mShutdown || !pFormat || lvl < VerbosityLevel::BEGIN || lvl >= VerbosityLevel::MAX )
+        {
+            return false;
+        }
+
+        SignalSafeRing::Entry* pEntry = mpSignalSafeRing->TryClaim(ticket);
+        if ( !pEntry )
+        {
+            return false;
+        }
+
+        pEntry->lvl = lvl;
+        pEntry->tid = std::this_thread::get_id( );
+        pEntry->ticks = LogClock::now( ).time_since_epoch( ).count( );
+        pEntry->seq = NextSequenceNumber( );
+        pEntry->len = SignalSafeFormat::Format<T>(pEntry->text, SignalSafeRing::TextLength, pFormat, pArgs);
+
+        mpSignalSafeRing->Publish(ticket);
+
+        return true;
+    }
+
+    // Producer helper for LogDeferredFormat - captures arguments without formatting them.
+    template <class T>
+    bool AsyncLogger::LogDeferred(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const T* pFormat, va_list pArgs) const
+    {
+        // Size the capture, then copy the arguments directly into the message's own storage (inline or pooled).
+        const size_t captureSize = DeferredFormat::GetCaptureSize<T>(pFormat, pArgs);
+        LogMessage msg(lvl, tid, time, GetLocalNode( ).pool, (captureSize + sizeof(utf16) - 1) / sizeof(utf16), pFormat);
+        DeferredFormat::Capture<T>(pFormat, pArgs, reinterpret_cast<uint8_t*>(msg.GetBuffer( )), msg.GetCaptureSize( ));
+
+        // Push the message into the queue.
+        return PushMsg(std::move(msg));
+    }
+
+    // Producer helper - formats the message on the calling thread.
+    bool AsyncLogger::LogFormatted(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const
+    {
+        // Size the message, then build it directly in the message's own storage (inline or pooled).
+        LogMessage msg(lvl, tid, time, GetLocalNode( ).pool, LoggerBase::GetFormattedMessageLength<utf16>(pFormat, pArgs));
+        LoggerBase::PrintFormattedMessage<utf16>(msg.GetBuffer( ), msg.GetLength( ), pFormat, pArgs);
+
+        // Push the message into the queue.
+        return PushMsg(std::move(msg));
+    }
+
+    /// Constructors \\\
+
+    // Single-ConfigPackage Constructor [C]
+    AsyncLogger::AsyncLogger(const ConfigPackage& config) :
+        LoggerBase(ConfigPackage( )),
+        mOptionMask(config.GetOptionFlags( )),
+        mpLogger(nullptr),
+        mpSinkWorkers(nullptr),
+        mBatchLatency(config.GetAsyncBatchLatency( )),
+        mBatchSize(config.GetAsyncBatchSize( )),
+        mFlushRequested(false),
+        mDeferFormatting(config.OptionEnabled(OptionFlag::LogDeferredFormat)),
+        mDrainOnCrash(config.GetAsyncDrainOnCrash( )),
+        mSinkOwner(std::thread::id( )),
+        mpSignalSafeRing((config.GetAsyncSignalSafeCapacity( ) != 0) ? std::make_unique<SignalSafeRing>(config.GetAsyncSignalSafeCapacity( )) : nullptr),
+        mNodes(BuildNodes(config)),
+        mMsgQueueSize(0),
+        mMsgQueueHighWatermark(0),
+        mLaneSizes{ },
+        mEnqueuedCounts{ },
+        mQueueCapacity(config.GetAsyncQueueCapacity( )),
+        mQueueReserve((config.GetAsyncPrefaultMemory( ) || mNodes.size( ) > 1) ? std::max(mBatchSize, mQueueCapacity) : mBatchSize),
+        mpSpillFile(BuildSpillFile(config, mQueueCapacity)),
+        mSpilledCount(0),
+        mSpillPending(false),
+        mSpillLost(0),
+        mThreadStagingSize(config.GetAsyncThreadStagingSize( )),
+        mInstanceId(s_NextInstanceId++),
+        mpBudget(config.GetAsyncMemoryBudget( )),
+        mStorageCharge(mpBudget.get( )),
+        mTrimIdleMemory(mpBudget && !config.GetAsyncPrefaultMemory( )),
+        mLastBatchTime(std::chrono::steady_clock::now( )),
+        mIdleTrimmed(false),
+        mpLatency(BuildLatencyHistograms(config)),
+        mLatencySummaryInterval(config.GetAsyncLatencySummaryInterval( )),
+        mpCoalescer(BuildCoalescer(config, config)),
+        mpRateLimiter(config.GetRateLimiter( )),
+        mRateLimitThreshold(config.GetVerbosityThreshold( )),
+        mBatch(NumaAllocator<LogMessage>(GetQueuePlacement(config))),
+        mMergePositions(mNodes.size( ), 0),
+        mWrittenCounts{ },
+        mpExecutor(config.GetAsyncExecutor( )),
+        mpExecutorState(std::make_shared<ExecutorState>( )),
+        mDrainState(DrainState::Idle),
+        mWorkerAffinity(config.GetAsyncWorkerAffinity( )),
+        mWorkerPriority(config.GetAsyncWorkerPriority( )),
+        mWorkerName(config.GetAsyncWorkerName( )),
+        mTerminate(false),
+        mShutdown(false),
+        mDiscard(false),
+        mBatchRemaining(0)
+    {
+        // Disable LogAsynchronous option when calling BuildLogger to avoid infinite recursion.
+        ConfigPackage cp = config;
+        cp.Disable(OptionFlag::LogAsynchronous);
+
+        // When batching, we flush once per batch - disable the sink's own periodic flushing.
+        if ( mBatchLatency > std::chrono::microseconds::zero( ) )
+        {
+            cp.SetFlushInterval(0);
+        }
+
+        // Repeats are coalesced by the worker, so the sink never sees them.
+        cp.SetCoalesceWindow(std::chrono::milliseconds::zero( ));
+
+        // Call sites are rate limited before messages are queued - the sink would only see the worker's call site.
+        cp.SetRateLimiter(nullptr);
+
+        // Pre-size the queues (and the batch) so steady-state logging doesn't reallocate them.
+        ReserveQueueStorage( );
+
+        // Get logger object via BuildLogger - or, if a sink has a delivery queue, via BuildSinkWorkers.
+        mpSinkWorkers = BuildSinkWorkers(cp, cp);
+        mpLogger = (mpSinkWorkers) ? mpSinkWorkers : BuildLogger(std::move(cp));
+
+        // Fully built - the crash hook and executor passes may now run against us.
+        // - Note: Past CrashDrain::MaxLoggers we aren't registered - we still log as usual, we just aren't drained on a crash.
+        if ( mDrainOnCrash )
+        {
+            mCrashBatch.reserve(mBatchSize);
+            mCrashRenderBuffer.reserve(CrashRenderReserve);
+            CrashDrain::Register(this);
+        }
+
+        mpExecutorState->pOwner = this;
+
+        // Start the worker now if asked to - LogSignalSafe and thread staging also need it, since they can't start the worker themselves.
+        if ( config.GetAsyncEagerStart( ) || mpSignalSafeRing || mThreadStagingSize != 0 )
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+            StartWorker( );
+        }
+    }
+
+    // Multiple-ConfigPackage Constructor [C]
+    // - Note: Async worker settings (e.g., batching) are taken from the first ConfigPackage.
+    AsyncLogger::AsyncLogger(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig) :
+        LoggerBase(ConfigPackage( )),
+        mOptionMask(stdOutConfig.GetOptionFlags( ) | fileConfig.GetOptionFlags( )),
+        mpLogger(nullptr),
+        mpSinkWorkers(nullptr),
+        mBatchLatency(stdOutConfig.GetAsyncBatchLatency( )),
+        mBatchSize(stdOutConfig.GetAsyncBatchSize( )),
+        mFlushRequested(false),
+        mDeferFormatting(stdOutConfig.OptionEnabled(OptionFlag::LogDeferredFormat) || fileConfig.OptionEnabled(OptionFlag::LogDeferredFormat)),
+        mDrainOnCrash(stdOutConfig.GetAsyncDrainOnCrash( ) || fileConfig.GetAsyncDrainOnCrash( )),
+        mSinkOwner(std::thread::id( )),
+        mpSignalSafeRing((stdOutConfig.GetAsyncSignalSafeCapacity( ) != 0) ? std::make_unique<SignalSafeRing>(stdOutConfig.GetAsyncSignalSafeCapacity( )) : nullptr),
+        mNodes(BuildNodes(stdOutConfig)),
+        mMsgQueueSize(0),
+        mMsgQueueHighWatermark(0),
+        mLaneSizes{ },
+        mEnqueuedCounts{ },
+        mQueueCapacity(stdOutConfig.GetAsyncQueueCapacity( )),
+        mQueueReserve((stdOutConfig.GetAsyncPrefaultMemory( ) || mNodes.size( ) > 1) ? std::max(mBatchSize, mQueueCapacity) : mBatchSize),
+        mpSpillFile(BuildSpillFile(stdOutConfig, mQueueCapacity)),
+        mSpilledCount(0),
+        mSpillPending(false),
+        mSpillLost(0),
+        mThreadStagingSize(stdOutConfig.GetAsyncThreadStagingSize( )),
+        mInstanceId(s_NextInstanceId++),
+        mpBudget(stdOutConfig.GetAsyncMemoryBudget( )),
+        mStorageCharge(mpBudget.get( )),
+        mTrimIdleMemory(mpBudget && !stdOutConfig.GetAsyncPrefaultMemory( )),
+        mLastBatchTime(std::chrono::steady_clock::now( )),
+        mIdleTrimmed(false),
+        mpLatency(BuildLatencyHistograms(stdOutConfig)),
+        mLatencySummaryInterval(stdOutConfig.GetAsyncLatencySummaryInterval( )),
+        mpCoalescer(BuildCoalescer(stdOutConfig, fileConfig)),
+        mpRateLimiter(GetSharedRateLimiter(stdOutConfig, fileConfig)),
+        mRateLimitThreshold(std::min(stdOutConfig.GetVerbosityThreshold( ), fileConfig.GetVerbosityThreshold( ))),
+        mBatch(NumaAllocator<LogMessage>(GetQueuePlacement(stdOutConfig))),
+        mMergePositions(mNodes.size( ), 0),
+        mWrittenCounts{ },
+        mpExecutor(stdOutConfig.GetAsyncExecutor( )),
+        mpExecutorState(std::make_shared<ExecutorState>( )),
+        mDrainState(DrainState::Idle),
+        mWorkerAffinity(stdOutConfig.GetAsyncWorkerAffinity( )),
+        mWorkerPriority(stdOutConfig.GetAsyncWorkerPriority( )),
+        mWorkerName(stdOutConfig.GetAsyncWorkerName( )),
+        mTerminate(false),
+        mShutdown(false),
+        mDiscard(false),
+        mBatchRemaining(0)
+    {
+        // Disable LogAsynchronous option when calling BuildLogger to avoid infinite recursion.
+        ConfigPackage sCP = stdOutConfig;
+        ConfigPackage fCP = fileConfig;
+        sCP.Disable(OptionFlag::LogAsynchronous);
+        fCP.Disable(OptionFlag::LogAsynchronous);
+
+        // When batching, we flush once per batch - disable the sinks' own periodic flushing.
+        if ( mBatchLatency > std::chrono::microseconds::zero( ) )
+        {
+            sCP.SetFlushInterval(0);
+            fCP.SetFlushInterval(0);
+        }
+
+        // Repeats are coalesced by the worker (as set in either ConfigPackage), so the sinks never see them.
+        sCP.SetCoalesceWindow(std::chrono::milliseconds::zero( ));
+        fCP.SetCoalesceWindow(std::chrono::milliseconds::zero( ));
+
+        // Call sites are rate limited (by the limiter both ConfigPackages share) before messages are queued.
+        sCP.SetRateLimiter(nullptr);
+        fCP.SetRateLimiter(nullptr);
+
+        // Pre-size the queues (and the batch) so steady-state logging doesn't reallocate them.
+        ReserveQueueStorage( );
+
+        // Get logger object via BuildLogger - or, if a sink has a delivery queue, via BuildSinkWorkers.
+        mpSinkWorkers = BuildSinkWorkers(sCP, fCP);
+        mpLogger = (mpSinkWorkers) ? mpSinkWorkers : BuildLogger(sCP, fCP);
+
+        // Fully built - the crash hook and executor passes may now run against us.
+        // - Note: Past CrashDrain::MaxLoggers we aren't registered - we still log as usual, we just aren't drained on a crash.
+        if ( mDrainOnCrash )
+        {
+            mCrashBatch.reserve(mBatchSize);
+            mCrashRenderBuffer.reserve(CrashRenderReserve);
+            CrashDrain::Register(this);
+        }
+
+        mpExecutorState->pOwner = this;
+
+        // Start the worker now if asked to - LogSignalSafe and thread staging also need it, since they can't start the worker themselves.
+        if ( stdOutConfig.GetAsyncEagerStart( ) || mpSignalSafeRing || mThreadStagingSize != 0 )
+        {
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+            StartWorker( );
+        }
+    }
+
+    /// Destructor \\\
+
+    AsyncLogger::~AsyncLogger( )
+    {
+        // Stop the crash hook from touching us first - we write out the queue ourselves below.
+        if ( mDrainOnCrash )
+        {
+            CrashDrain::Unregister(this);
+        }
+
+        // Write out the rest of the queue, and stop the worker.
+        StopWorker( );
+
+        // Pick up any LogSignalSafe messages the worker didn't get to.
+        DrainSignalSafeMsgs( );
+
+        // Repeats still being counted get their summary now.
+        if ( mpCoalescer && !mDiscard )
+        {
+            try
+            {
+                WriteDueSummaries(true);
+            }
+            catch ( const std::exception& )
+            {
+                // Best effort - nothing else to do.
+            }
+        }
+
+        // The worker has written everything - release any flush waiters it didn't get to.
+        CompleteFlushWaiters(mWrittenCounts, true);
+
+        if ( mpLogger )
+        {
+            // Attempt to log one last message - report statistics.
+            try
+            {
+                mpLogger->Log(
+                    VerbosityLevel::INFO,
+                    __FUNCTION__" - successful logs = %llu, failed logs = %llu.\r\n",
+                    static_cast<unsigned long long>(mStats.Get(StatCounters::Counter::Written)),
+                    static_cast<unsigned long long>(mStats.Get(StatCounters::Counter::Failed))
+                );
+            }
+            catch ( ... )
+            {
+                // Best effort - nothing else to do.
+            }
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Submit log message to stream(s) (variadic arguments, narrow).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (variadic arguments, wide).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (variadic arguments, narrow, explicit thread ID).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (variadic arguments, wide, explicit thread ID).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (variadic arguments, narrow, explicit thread ID and event time).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (variadic arguments, wide, explicit thread ID and event time).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (va_list, narrow).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf8* pFormat, va_list pArgs) const
+    {
+        return Log(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, wide).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf16* pFormat, va_list pArgs) const
+    {
+        return Log(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, narrow, explicit thread ID).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, va_list pArgs) const
+    {
+        // Capture the event time up front - the worker may not get to this message for a while.
+        return Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, wide, explicit thread ID).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const
+    {
+        // Capture the event time up front - the worker may not get to this message for a while.
+        return Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, narrow, explicit thread ID and event time).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const
+    {
+        if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
+        }
+
+        if ( IsRateLimited(lvl, pFormat) )
+        {
+            return true;
+        }
+
+        return SubmitMsg(lvl, tid, time, pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, wide, explicit thread ID and event time).
+    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const
+    {
+        if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
         }
 
-        // Loop until we get signaled to terminate.
-        while ( !TerminatePredicate( ) )
+        if ( IsRateLimited(lvl, pFormat) )
         {
-            // Wait for more log messages to queue-up.
-            // - Note: We won't actually sleep if the message queue isn't empty.
-            WaitForMsgs( );
+            return true;
+        }
 
-            // See if we should terminate after waking up.
-            if ( TerminatePredicate( ) )
-            {
-                break;
-            }
+        return SubmitMsg(lvl, tid, time, pFormat, pArgs);
+    }
 
-            // Ensure the logger didn't somehow get nulled.
-            if ( !mpLogger )
-            {
-                throw std::runtime_error(__FUNCTION__" - mpLogger somehow became null during worker thread loop.");
-            }
+    // Queue a log message that's already past the rate limiter (narrow).
+    bool AsyncLogger::SubmitMsg(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const
+    {
+        const std::chrono::steady_clock::time_point start = StartLogCallTimer( );
+        bool ret = false;
 
-            // Log the next batch of queued messages.
-            LogMsgs(GetQueuedMsgs( ));
+        // Deferred - keep the caller's format as-is, the worker converts it when rendering.
+        // Otherwise messages are stored as UTF-16 - convert the format and format it as wide.
+        if ( mDeferFormatting )
+        {
+            ret = LogDeferred<utf8>(lvl, tid, time, pFormat, pArgs);
         }
+        else
+        {
+            ret = LogFormatted(lvl, tid, time, CC::StringUtil::UTFConversion<ReturnType::SmartCString, utf16, utf8>(pFormat).get( ), pArgs);
+        }
+
+        StopLogCallTimer(start);
+
+        return ret;
     }
 
-    // Worker thread's wait method.
-    void AsyncLogger::WaitForMsgs( ) const
+    // Queue a log message that's already past the rate limiter (wide).
+    bool AsyncLogger::SubmitMsg(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const
     {
-        std::unique_lock<std::mutex> lock(mMsgQueueMutex);
+        const std::chrono::steady_clock::time_point start = StartLogCallTimer( );
+        const bool ret = (mDeferFormatting) ? LogDeferred<utf16>(lvl, tid, time, pFormat, pArgs) : LogFormatted(lvl, tid, time, pFormat, pArgs);
 
-        mMsgCV.wait(lock, [this] ( ) -> bool
-        {
-            return this->WaitPredicate( );
-        });
+        StopLogCallTimer(start);
+
+        return ret;
     }
 
-    // Worker thread's wait condition method.
-    bool AsyncLogger::WaitPredicate( ) const noexcept
+    // Submit pre-formatted log record to stream(s) - message text is copied and written as-is.
+    bool AsyncLogger::WriteRecord(const LogRecord& record) const
     {
-        // Wake up if we have work or if we need to terminate.
-        return !mMsgQueue.empty( ) || mTerminate;
+        const std::chrono::steady_clock::time_point start = StartLogCallTimer( );
+
+        // Copy the text into the message's own storage (inline or pooled), null-terminated like formatted messages.
+        LogMessage msg(record.lvl, record.tid, record.time, GetLocalNode( ).pool, record.message.size( ) + 1);
+        utf16* pBuf = msg.GetBuffer( );
+
+        if ( !record.message.empty( ) )
+        {
+            memcpy(pBuf, record.message.data( ), record.message.size( ) * sizeof(utf16));
+        }
+
+        pBuf[record.message.size( )] = L'\0';
+
+        // Push the message into the queue.
+        const bool ret = PushMsg(std::move(msg));
+
+        StopLogCallTimer(start);
+
+        return ret;
     }
 
-    // Worker thread's termination condition method.
-    bool AsyncLogger::TerminatePredicate( ) const
+    // Reserve storage for a message of up to maxLength characters, to be filled in place and then committed.
+    AsyncLogger::Reservation AsyncLogger::Reserve(const VerbosityLevel& lvl, const size_t maxLength, const void* pSite) const
     {
-        return mTerminate && (mMsgQueueSize == 0);
+        if ( lvl < VerbosityLevel::BEGIN || lvl >= VerbosityLevel::MAX )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid verbosity level argument (" + std::to_string(static_cast<VerbosityLevelType>(lvl)) + ").");
+        }
+
+        if ( maxLength == std::numeric_limits<size_t>::max( ) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid maxLength argument (" + std::to_string(maxLength) + ").");
+        }
+
+        if ( IsRateLimited(lvl, pSite) )
+        {
+            return Reservation( );
+        }
+
+        return Reservation(*this, lvl, std::this_thread::get_id( ), LogClock::now( ), GetLocalNode( ).pool, maxLength);
     }
 
-    // Public method helper for enqueuing new LogMessages.
-    void AsyncLogger::PushMsg(LogMessage&& msg) const
+    // Queue the first length characters of the buffer as the message (null-terminated for you).
+    bool AsyncLogger::Reservation::Commit(const size_t length)
     {
-        std::lock_guard<std::mutex> lg(mMsgQueueMutex);
-
-        mMsgQueue.push(std::forward<LogMessage>(msg));
+        const AsyncLogger* pOwner = mpOwner;
 
-        mMsgQueueSize++;
+        if ( !pOwner )
+        {
+            throw std::logic_error(__FUNCTION__" - Reservation is empty (rate limited, already committed, or moved from).");
+        }
 
-        if ( !mWorkerThread.joinable( ) )
+        if ( length > mCapacity )
         {
-            mWorkerThread = std::thread(&AsyncLogger::WorkerLogLoop, this);
+            throw std::invalid_argument(__FUNCTION__" - Invalid length argument (" + std::to_string(length) + " > " + std::to_string(mCapacity) + ").");
         }
 
-        mMsgCV.notify_one( );
+        mMsg.GetBuffer( )[length] = L'\0';
+        mMsg.SetLength(length + 1);
+
+        mpOwner = nullptr;
+        mCapacity = 0;
+
+        // Push the message into the queue - a pooled payload changes hands without being copied.
+        return pOwner->PushMsg(std::move(mMsg));
     }
 
-    // Worker thread's obtain-next-message method.
-    std::queue<AsyncLogger::LogMessage> AsyncLogger::GetQueuedMsgs( ) const
+    // Hand the calling thread's staged messages to the queue now, rather than waiting for its staging buffer to fill up.
+    bool AsyncLogger::FlushThread( ) const
     {
-        std::queue<LogMessage> msgs;
+        if ( mThreadStagingSize == 0 )
+        {
+            return true;
+        }
 
-        std::lock_guard<std::mutex> lock(mMsgQueueMutex);
-        
-        msgs.swap(mMsgQueue);
+        ThreadStaging& staging = GetThreadStaging( );
+        std::lock_guard<TrackedMutex> lg(staging.mutex);
 
-        mMsgQueueSize = mMsgQueue.size( );
-        
-        return msgs;
+        return staging.msgs.empty( ) || HandOffStagedMsgs(staging);
     }
 
-    // Main part of worker thread's work-flow.
-    // Attempts to log queued message using the owned logger object.
-    void AsyncLogger::LogMsgs(std::queue<LogMessage>&& msgs) const
+    // Wait until every message submitted before the call has been written and flushed.
+    bool AsyncLogger::Flush( ) const
     {
-        bool success = false;
-
-        while ( !msgs.empty( ) )
+        try
+        {
+            FlushAsync( ).get( );
+        }
+        catch ( const std::exception& )
         {
-            // Pop message from the local LogMessage queue arg.
-            LogMessage msg(std::move(msgs.front( )));
-            msgs.pop( );
+            return false;
+        }
 
-            try
-            {
-                // Log the queued message, capture success/failure.
-                success = mpLogger->Log(msg.GetVerbosityLevel( ), msg.GetThreadID( ), UTF16_LITERAL_STR("%ls"), msg.GetString( ));
-            }
-            catch ( const std::exception& e )
-            {
-                try
-                {
-                    static const utf8* errFormat = __FUNCTION__" - Failed to log message: exception \"%s\", msg \"%ls\".";
-                    // Try to log that we failed with exception string and original message.
-                    mpLogger->Log(VerbosityLevel::WARN, errFormat, e.what( ), msg.GetString( ));
-                }
-                catch ( const std::exception& )
-                {
-                    // Best effort - nothing to do here aside from incrementing failure count.
-                    mFailCounter++;
-                }
-            }
+        return true;
+    }
 
-            // Record success/failure of log with counter.
-            // We attempt to log these stats upon destruction.
-            if ( success )
-            {
-                mSuccessCounter++;
-            }
-            else
-            {
-                mFailCounter++;
-            }
+    // Same as Flush( ), but gives up after the specified timeout.  Returns false on timeout or failure.
+    bool AsyncLogger::Flush(const std::chrono::milliseconds& timeout) const
+    {
+        std::future<void> barrier = FlushAsync( );
+
+        if ( barrier.wait_for(timeout) != std::future_status::ready )
+        {
+            return false;
         }
-    }
 
-    /// Constructors \\\
+        try
+        {
+            barrier.get( );
+        }
+        catch ( const std::exception& )
+        {
+            return false;
+        }
 
-    // Single-ConfigPackage Constructor [C]
-    AsyncLogger::AsyncLogger(const ConfigPackage& config) :
-        LoggerBase(ConfigPackage( )),
-        mOptionMask(config.GetOptionFlags( )),
-        mpLogger(nullptr),
-        mSuccessCounter(0),
-        mFailCounter(0)
+        return true;
+    }
+
+    // Non-blocking Flush( ) - the returned future becomes ready once the barrier is reached.
+    std::future<void> AsyncLogger::FlushAsync( ) const
     {
-        // Disable LogAsynchronous option when calling BuildLogger to avoid infinite recursion.
-        ConfigPackage cp = config;
-        cp.Disable(OptionFlag::LogAsynchronous);
+        FlushWaiter waiter;
+        std::future<void> barrier = waiter.promise.get_future( );
+
+        AddFlushWaiter(std::move(waiter));
 
-        // Get logger object via BuildLogger.
-        mpLogger = BuildLogger(std::move(cp));
+        return barrier;
     }
 
-    // Multiple-ConfigPackage Constructor [C]
-    AsyncLogger::AsyncLogger(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig) :
-        LoggerBase(ConfigPackage( )),
-        mOptionMask(stdOutConfig.GetOptionFlags( ) | fileConfig.GetOptionFlags( )),
-        mpLogger(nullptr),
-        mSuccessCounter(0),
-        mFailCounter(0)
+    // Non-blocking Flush( ) - onFlushed(success) is called once the barrier is reached.
+    void AsyncLogger::FlushAsync(std::function<void(bool)> onFlushed) const
     {
-        // Disable LogAsynchronous option when calling BuildLogger to avoid infinite recursion.
-        ConfigPackage sCP = stdOutConfig;
-        ConfigPackage fCP = fileConfig;
-        sCP.Disable(OptionFlag::LogAsynchronous);
-        fCP.Disable(OptionFlag::LogAsynchronous);
+        FlushWaiter waiter;
 
-        // Get logger object via BuildLogger.  
-        mpLogger = BuildLogger(sCP, fCP);
-    }
+        if ( !onFlushed )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid callback argument (empty).");
+        }
 
-    /// Destructor \\\
+        waiter.onFlushed = std::move(onFlushed);
+        AddFlushWaiter(std::move(waiter));
+    }
 
-    AsyncLogger::~AsyncLogger( )
+    // LogAsync implementation - onDurable is called right away unless the message is queued.
+    template <class T>
+    bool AsyncLogger::LogAsyncInternal(std::function<void(LogAsyncResult)>&& onDurable, const VerbosityLevel& lvl, const T* pFormat, va_list pArgs) const
     {
-        // Check if worker thread is running.
-        if ( mWorkerThread.joinable( ) )
+        if ( !onDurable )
         {
-            // Signal the worker to terminate and wait.
-            mTerminate = true;
-            mWorkerThread.join( );
+            throw std::invalid_argument(__FUNCTION__" - Invalid callback argument (empty).");
         }
 
-        if ( mpLogger )
+        if ( !pFormat )
         {
-            // Attempt to log one last message - report statistics.
-            try
-            {
-                mpLogger->Log(
-                    VerbosityLevel::INFO,
-                    __FUNCTION__" - successful logs = %zu, failed logs = %zu.\r\n",
-                    mSuccessCounter,
-                    mFailCounter
-                );
-            }
-            catch ( ... )
-            {
-                // Best effort - nothing else to do.
-            }
+            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
         }
-    }
 
-    /// Public Methods \\\
+        // Rate limited - never queued, so there's nothing to wait for.
+        if ( IsRateLimited(lvl, pFormat) )
+        {
+            onDurable(LogAsyncResult::Suppressed);
+            return true;
+        }
 
-    // Submit log message to stream(s) (variadic arguments, narrow).
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf8* pFormat, ...) const
+        // Not queued (e.g., shut down, or the queue was full) - it will never be written.
+        if ( !SubmitMsg(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs) )
+        {
+            onDurable(LogAsyncResult::NotWritten);
+            return false;
+        }
+
+        // Below every sink's threshold - queued (so it's counted as filtered), but it won't be written.
+        if ( lvl < mRateLimitThreshold )
+        {
+            onDurable(LogAsyncResult::Suppressed);
+            return true;
+        }
+
+        // Queue order is submission order, so a barrier placed now covers the message we just submitted.
+        FlushAsync([onDurable = std::move(onDurable)] (const bool bFlushed)
+        {
+            onDurable((bFlushed) ? LogAsyncResult::Durable : LogAsyncResult::NotWritten);
+        });
+
+        return true;
+    }
+
+    // Submit log message to stream(s), then call onDurable(result) once it has been written and flushed (narrow).
+    bool AsyncLogger::LogAsync(std::function<void(LogAsyncResult)> onDurable, const VerbosityLevel& lvl, const utf8* pFormat, ...) const
     {
         bool ret = false;
         va_list pArgs;
@@ -222,7 +2512,7 @@ namespace SLL
 
         try
         {
-            ret = Log(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+            ret = LogAsyncInternal(std::move(onDurable), lvl, pFormat, pArgs);
         }
         catch ( const std::exception& )
         {
@@ -234,8 +2524,8 @@ namespace SLL
         return ret;
     }
 
-    // Submit log message to stream(s) (variadic arguments, wide).
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf16* pFormat, ...) const
+    // Submit log message to stream(s), then call onDurable(result) once it has been written and flushed (wide).
+    bool AsyncLogger::LogAsync(std::function<void(LogAsyncResult)> onDurable, const VerbosityLevel& lvl, const utf16* pFormat, ...) const
     {
         bool ret = false;
         va_list pArgs;
@@ -243,7 +2533,7 @@ namespace SLL
 
         try
         {
-            ret = Log(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+            ret = LogAsyncInternal(std::move(onDurable), lvl, pFormat, pArgs);
         }
         catch ( const std::exception& )
         {
@@ -255,120 +2545,162 @@ namespace SLL
         return ret;
     }
 
-    // Submit log message to stream(s) (variadic arguments, narrow, explicit thread ID).
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, ...) const
+    // Submit log message from a signal handler - never allocates, locks, or throws (narrow).
+    bool AsyncLogger::LogSignalSafe(const VerbosityLevel& lvl, const utf8* pFormat, ...) const noexcept
     {
         bool ret = false;
         va_list pArgs;
         va_start(pArgs, pFormat);
 
-        try
-        {
-            ret = Log(lvl, tid, pFormat, pArgs);
-        }
-        catch ( const std::exception& )
-        {
-            va_end(pArgs);
-            throw;
-        }
+        ret = LogSignalSafeInternal<utf8>(lvl, pFormat, pArgs);
 
         va_end(pArgs);
         return ret;
     }
 
-    // Submit log message to stream(s) (variadic arguments, wide, explicit thread ID).
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, ...) const
+    // Submit log message from a signal handler - never allocates, locks, or throws (wide).
+    bool AsyncLogger::LogSignalSafe(const VerbosityLevel& lvl, const utf16* pFormat, ...) const noexcept
     {
         bool ret = false;
         va_list pArgs;
         va_start(pArgs, pFormat);
 
-        try
-        {
-            ret = Log(lvl, tid, pFormat, pArgs);
-        }
-        catch ( const std::exception& )
-        {
-            va_end(pArgs);
-            throw;
-        }
+        ret = LogSignalSafeInternal<utf16>(lvl, pFormat, pArgs);
 
         va_end(pArgs);
         return ret;
     }
 
-    // Submit log message to stream(s) (va_list, narrow).
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf8* pFormat, va_list pArgs) const
+    // Returns a snapshot of the logger's statistics (lock-free).
+    LogStats AsyncLogger::GetStats( ) const
     {
-        std::unique_ptr<utf16[ ]> str;
+        LogStats stats = mStats.GetSnapshot( );
 
-        if ( !pFormat )
+        stats.queueDepth = mMsgQueueSize.load(std::memory_order_relaxed);
+        stats.queueHighWatermark = mMsgQueueHighWatermark.load(std::memory_order_relaxed);
+
+        if ( mpLogger )
         {
-            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
+            const LogStats sinkStats = mpLogger->GetStats( );
+
+            stats.dropped += sinkStats.dropped;
+            stats.filtered = sinkStats.filtered;
+            stats.written = sinkStats.written;
+            stats.bytesWritten = sinkStats.bytesWritten;
+            stats.flushes = sinkStats.flushes;
+            stats.restoreAttempts = sinkStats.restoreAttempts;
         }
 
-        // Build the log message.
-        str = LoggerBase::BuildFormattedMessage<utf16>(CC::StringUtil::UTFConversion<ReturnType::SmartCString, utf16, utf8>(pFormat).get( ), pArgs);
-
-        // Push the message into the queue.
-        PushMsg(LogMessage(lvl, std::move(str), std::this_thread::get_id( )));
-
-        return true;
+        return stats;
     }
 
-    // Submit log message to stream(s) (va_list, wide).
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const utf16* pFormat, va_list pArgs) const
+    // Returns a snapshot of the logger's latency histograms (lock-free).
+    LatencyStats AsyncLogger::GetLatencyStats( ) const
     {
-        std::unique_ptr<utf16[ ]> str;
+        LatencyStats stats;
 
-        if ( !pFormat )
+        if ( mpLatency )
         {
-            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
+            stats.queueWait = mpLatency->queueWait.GetSnapshot( );
+            stats.sinkWrite = mpLatency->sinkWrite.GetSnapshot( );
+            stats.logCall = mpLatency->logCall.GetSnapshot( );
         }
 
-        // Build the log message.
-        str = LoggerBase::BuildFormattedMessage<utf16>(pFormat, pArgs);
+        return stats;
+    }
+
+    // Start the worker thread now, rather than with the first message.
+    void AsyncLogger::Start( )
+    {
+        std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
 
-        // Push the message into the queue.
-        PushMsg(LogMessage(lvl, std::move(str), std::this_thread::get_id( )));
+        if ( mShutdown )
+        {
+            throw std::runtime_error(__FUNCTION__" - Logger has been shut down.");
+        }
 
-        return true;
+        StartWorker( );
     }
 
-    // Submit log message to stream(s) (va_list, explicit thread ID).
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, va_list pArgs) const
+    // Stop accepting messages, and write out the ones already submitted until the deadline passes.
+    size_t AsyncLogger::Shutdown(const std::chrono::steady_clock::time_point& deadline)
     {
-        std::unique_ptr<utf16[ ]> str;
+        std::vector<FlushWaiter> abandoned;
+        size_t discarded = 0;
 
-        if ( !pFormat )
+        // Stop taking new messages first, so the barrier below covers everything that will ever be queued.
         {
-            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
+
+            if ( mShutdown )
+            {
+                return 0;
+            }
+
+            mShutdown = true;
         }
 
-        // Build the log message.
-		str = LoggerBase::BuildFormattedMessage<utf16>(CC::StringUtil::UTFConversion<ReturnType::SmartCString, utf16, utf8>(pFormat).get( ), pArgs);
+        if ( FlushAsync( ).wait_until(deadline) == std::future_status::ready )
+        {
+            // Everything made it out in time.
+            StopWorker( );
+            return 0;
+        }
 
-        // Push the message into the queue.
-        PushMsg(LogMessage(lvl, std::move(str), tid));
+        // Out of time - count and drop whatever the worker hasn't started on, and let it go.
+        {
+            std::lock_guard<TrackedMutex> sl(mSpillMutex);
+            std::lock_guard<TrackedMutex> lg(mMsgQueueMutex);
 
-        return true;
-    }
+            mDiscard = true;
+            discarded = mMsgQueueSize + mBatchRemaining.exchange(0);
+            mStats.Add(StatCounters::Counter::Dropped, discarded);
 
-    bool AsyncLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const
-    {
-        std::unique_ptr<utf16[ ]> str;
+            for ( const std::unique_ptr<NodeQueues>& pNode : mNodes )
+            {
+                for ( MsgQueue& queue : pNode->queues )
+                {
+                    queue.clear( );
+                }
+            }
 
-        if ( !pFormat )
+            if ( mpSpillFile )
+            {
+                mpSpillFile->Discard( );
+            }
+
+            // Messages the spill file couldn't take were already counted as failed - they aren't written off with the rest.
+            mSpillOutbox.clear( );
+            mSpilledCount = 0;
+            mSpillPending = false;
+            mSpillLost = 0;
+            mMsgQueueSize = 0;
+            mLaneSizes = { };
+            mFlushRequested = false;
+            mTerminate = true;
+            mMsgCV.notify_one( );
+
+            abandoned.swap(mFlushWaiters);
+        }
+
+        // A stuck queued sink mustn't hold up the worker's last few writes (or the destructor waiting on them).
+        if ( mpSinkWorkers )
         {
-            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
+            mpSinkWorkers->StopBlocking( );
         }
 
-        // Build the log message.
-        str = LoggerBase::BuildFormattedMessage<utf16>(pFormat, pArgs);
+        // Fail the abandoned flush barriers (including our own) without flushing - the sink may be what's stuck.
+        for ( FlushWaiter& waiter : abandoned )
+        {
+            CompleteFlushWaiter(waiter, false);
+        }
 
-        // Push the message into the queue.
-        PushMsg(LogMessage(lvl, std::move(str), tid));
+        return discarded;
+    }
 
-        return true;
+    // Same as Shutdown(deadline), with the deadline timeout from now.
+    size_t AsyncLogger::Shutdown(const std::chrono::milliseconds& timeout)
+    {
+        return Shutdown(std::chrono::steady_clock::now( ) + timeout);
     }
 }
\ No newline at end of file
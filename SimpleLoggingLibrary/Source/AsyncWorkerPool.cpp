@@ -0,0 +1,168 @@
+// Class Header
+#include <AsyncWorkerPool.h>
+
+// STL
+#include <algorithm>
+#include <stdexcept>
+
+namespace SLL
+{
+    /// Private Helper Methods \\\
+
+    // Worker thread main loop.
+    void AsyncWorkerPool::WorkerLoop( )
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        while ( !mTerminate )
+        {
+            PromoteDueWork(Clock::now( ));
+
+            if ( mReady.empty( ) )
+            {
+                // Nothing ready - sleep until new work arrives or the earliest delayed work comes due.
+                if ( mDelayed.empty( ) )
+                {
+                    mWorkCV.wait(lock);
+                }
+                else
+                {
+                    const auto earliest = std::min_element(mDelayed.begin( ), mDelayed.end( ), [ ] (const DelayedWork& l, const DelayedWork& r) -> bool
+                    {
+                        return l.due < r.due;
+                    });
+
+                    mWorkCV.wait_until(lock, earliest->due);
+                }
+
+                continue;
+            }
+
+            std::function<void( )> work = std::move(mReady.front( ));
+            mReady.pop_front( );
+
+            // Run the work without the pool lock, so other workers (and posters) aren't held up.
+            lock.unlock( );
+
+            try
+            {
+                work( );
+            }
+            catch ( ... )
+            {
+                // Best effort - failing work must not take a shared worker down with it.
+            }
+
+            // Release anything the work captured before going back under the lock.
+            work = nullptr;
+
+            lock.lock( );
+        }
+    }
+
+    // Move delayed work whose due time has passed into the ready queue.  Caller must hold mMutex.
+    void AsyncWorkerPool::PromoteDueWork(const Clock::time_point& now)
+    {
+        auto it = mDelayed.begin( );
+
+        while ( it != mDelayed.end( ) )
+        {
+            if ( it->due <= now )
+            {
+                mReady.push_back(std::move(it->work));
+                it = mDelayed.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    /// Constructor \\\
+
+    // Start workerCount threads (0 selects one per hardware thread).
+    AsyncWorkerPool::AsyncWorkerPool(const size_t workerCount) :
+        mTerminate(false)
+    {
+        const size_t count = (workerCount != 0) ? workerCount : std::max<size_t>(std::thread::hardware_concurrency( ), 1);
+
+        mWorkers.reserve(count);
+
+        try
+        {
+            for ( size_t i = 0; i < count; i++ )
+            {
+                mWorkers.emplace_back(&AsyncWorkerPool::WorkerLoop, this);
+            }
+        }
+        catch ( const std::exception& )
+        {
+            // Don't leave already-started workers running against a half-built pool.
+            {
+                std::lock_guard<std::mutex> lg(mMutex);
+                mTerminate = true;
+                mWorkCV.notify_all( );
+            }
+
+            for ( std::thread& worker : mWorkers )
+            {
+                worker.join( );
+            }
+
+            throw;
+        }
+    }
+
+    /// Destructor \\\
+
+    AsyncWorkerPool::~AsyncWorkerPool( )
+    {
+        {
+            std::lock_guard<std::mutex> lg(mMutex);
+            mTerminate = true;
+            mWorkCV.notify_all( );
+        }
+
+        for ( std::thread& worker : mWorkers )
+        {
+            worker.join( );
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Returns number of worker threads.
+    size_t AsyncWorkerPool::GetWorkerCount( ) const noexcept
+    {
+        return mWorkers.size( );
+    }
+
+    // Run work as soon as a worker is free.
+    void AsyncWorkerPool::Post(std::function<void( )> work)
+    {
+        if ( !work )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid work argument (empty).");
+        }
+
+        std::lock_guard<std::mutex> lg(mMutex);
+        mReady.push_back(std::move(work));
+        mWorkCV.notify_one( );
+    }
+
+    // Run work once delay has passed.
+    void AsyncWorkerPool::PostAfter(const std::chrono::microseconds& delay, std::function<void( )> work)
+    {
+        if ( !work )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid work argument (empty).");
+        }
+
+        std::lock_guard<std::mutex> lg(mMutex);
+        mDelayed.push_back(DelayedWork { Clock::now( ) + delay, std::move(work) });
+
+        // Wake a worker so it can shorten its sleep, if this is now the earliest due work.
+        mWorkCV.notify_one( );
+    }
+}
\ No newline at end of file
@@ -1,6 +1,11 @@
 // Class Header and Other Includes
 #include <ConfigPackage.h>
 
+// STL
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
 namespace SLL
 {
     /// PRIVATE HELPERS \\\
@@ -32,13 +37,93 @@ namespace SLL
         }
     }
 
+    // Private Helper - Validate Async Batch Latency
+    void ConfigPackage::ValidateAsyncBatchLatency(const std::chrono::microseconds latency, const std::string& f)
+    {
+        if ( latency < std::chrono::microseconds::zero( ) )
+        {
+            throw std::invalid_argument(f + " - Invalid async batch latency (" + std::to_string(latency.count( )) + "us).");
+        }
+    }
+
+    // Private Helper - Validate Async Batch Size
+    void ConfigPackage::ValidateAsyncBatchSize(const size_t size, const std::string& f)
+    {
+        if ( size == 0 )
+        {
+            throw std::invalid_argument(f + " - Invalid async batch size (" + std::to_string(size) + ").");
+        }
+    }
+
+    // Private Helper - Validate Async Worker Affinity
+    void ConfigPackage::ValidateAsyncWorkerAffinity(const uint64_t affinityMask, const std::string& f)
+    {
+        // The mask is handed to Windows as a DWORD_PTR, so 32-bit builds can only select CPUs 0-31.
+        if ( affinityMask > std::numeric_limits<uintptr_t>::max( ) )
+        {
+            throw std::invalid_argument(f + " - Invalid async worker affinity (" + std::to_string(affinityMask) + ").");
+        }
+    }
+
+    // Sanity checker for async worker thread priority arguments.
+    void ConfigPackage::ValidateAsyncWorkerPriority(const int priority, const std::string& f)
+    {
+        // THREAD_PRIORITY_IDLE, LOWEST, BELOW_NORMAL, NORMAL, ABOVE_NORMAL, HIGHEST and TIME_CRITICAL.
+        static constexpr int validPriorities[ ] = { -15, -2, -1, 0, 1, 2, 15 };
+
+        if ( std::find(std::begin(validPriorities), std::end(validPriorities), priority) == std::end(validPriorities) )
+        {
+            throw std::invalid_argument(f + " - Invalid async worker priority (" + std::to_string(priority) + ").");
+        }
+    }
+
+    // Private Helper - Validate Async Latency Summary Interval
+    void ConfigPackage::ValidateAsyncLatencySummaryInterval(const std::chrono::milliseconds interval, const std::string& f)
+    {
+        if ( interval < std::chrono::milliseconds::zero( ) )
+        {
+            throw std::invalid_argument(f + " - Invalid async latency summary interval (" + std::to_string(interval.count( )) + "ms).");
+        }
+    }
+
+    // Private Helper - Validate Coalesce Window
+    void ConfigPackage::ValidateCoalesceWindow(const std::chrono::milliseconds window, const std::string& f)
+    {
+        if ( window < std::chrono::milliseconds::zero( ) )
+        {
+            throw std::invalid_argument(f + " - Invalid coalesce window (" + std::to_string(window.count( )) + "ms).");
+        }
+    }
+
     /// CTORS \\\
 
     // Default Ctor
     ConfigPackage::ConfigPackage( ) :
         mVerbosityColors(static_cast<size_t>(VerbosityLevel::MAX), Color::DEFAULT),
         mOptionMask(OptionFlag::NONE),
-        mVerbosityThreshold(VerbosityLevel::INFO)
+        mVerbosityThreshold(VerbosityLevel::INFO),
+        mFlushInterval(3),
+        mAsyncBatchLatency(std::chrono::microseconds::zero( )),
+        mAsyncBatchSize(256),
+        mAsyncExecutor(nullptr),
+        mAsyncDrainOnCrash(false),
+        mAsyncSignalSafeCapacity(0),
+        mAsyncQueueCapacity(0),
+        mAsyncEagerStart(false),
+        mAsyncWorkerAffinity(0),
+        mAsyncWorkerPriority(0),
+        mAsyncNumaAware(false),
+        mAsyncLargePages(false),
+        mAsyncPrefaultMemory(false),
+        mAsyncThreadStagingSize(0),
+        mAsyncSinkQueueCapacity(0),
+        mAsyncSinkBlockWhenFull(false),
+        mAsyncLatencyHistograms(false),
+        mAsyncLatencySummaryInterval(std::chrono::milliseconds::zero( )),
+        mAsyncMemoryBudget(nullptr),
+        mCoalesceWindow(std::chrono::milliseconds::zero( )),
+        mCoalesceByFormat(false),
+        mRateLimiter(nullptr)
     { }
 
     // Copy Ctor
@@ -66,6 +151,30 @@ namespace SLL
             mVerbosityColors    = src.mVerbosityColors;
             mOptionMask         = src.mOptionMask;
             mVerbosityThreshold = src.mVerbosityThreshold;
+            mFlushInterval      = src.mFlushInterval;
+            mAsyncBatchLatency  = src.mAsyncBatchLatency;
+            mAsyncBatchSize     = src.mAsyncBatchSize;
+            mAsyncExecutor      = src.mAsyncExecutor;
+            mAsyncDrainOnCrash  = src.mAsyncDrainOnCrash;
+            mAsyncSignalSafeCapacity = src.mAsyncSignalSafeCapacity;
+            mAsyncQueueCapacity = src.mAsyncQueueCapacity;
+            mAsyncSpillFile     = src.mAsyncSpillFile;
+            mAsyncEagerStart    = src.mAsyncEagerStart;
+            mAsyncWorkerAffinity = src.mAsyncWorkerAffinity;
+            mAsyncWorkerPriority = src.mAsyncWorkerPriority;
+            mAsyncWorkerName    = src.mAsyncWorkerName;
+            mAsyncNumaAware     = src.mAsyncNumaAware;
+            mAsyncLargePages    = src.mAsyncLargePages;
+            mAsyncPrefaultMemory = src.mAsyncPrefaultMemory;
+            mAsyncThreadStagingSize = src.mAsyncThreadStagingSize;
+            mAsyncSinkQueueCapacity = src.mAsyncSinkQueueCapacity;
+            mAsyncSinkBlockWhenFull = src.mAsyncSinkBlockWhenFull;
+            mAsyncLatencyHistograms = src.mAsyncLatencyHistograms;
+            mAsyncLatencySummaryInterval = src.mAsyncLatencySummaryInterval;
+            mAsyncMemoryBudget = src.mAsyncMemoryBudget;
+            mCoalesceWindow = src.mCoalesceWindow;
+            mCoalesceByFormat = src.mCoalesceByFormat;
+            mRateLimiter = src.mRateLimiter;
         }
 
         return *this;
@@ -80,6 +189,30 @@ namespace SLL
             mVerbosityColors    = std::move(src.mVerbosityColors);
             mOptionMask         = src.mOptionMask;
             mVerbosityThreshold = src.mVerbosityThreshold;
+            mFlushInterval      = src.mFlushInterval;
+            mAsyncBatchLatency  = src.mAsyncBatchLatency;
+            mAsyncBatchSize     = src.mAsyncBatchSize;
+            mAsyncExecutor      = std::move(src.mAsyncExecutor);
+            mAsyncDrainOnCrash  = src.mAsyncDrainOnCrash;
+            mAsyncSignalSafeCapacity = src.mAsyncSignalSafeCapacity;
+            mAsyncQueueCapacity = src.mAsyncQueueCapacity;
+            mAsyncSpillFile     = std::move(src.mAsyncSpillFile);
+            mAsyncEagerStart    = src.mAsyncEagerStart;
+            mAsyncWorkerAffinity = src.mAsyncWorkerAffinity;
+            mAsyncWorkerPriority = src.mAsyncWorkerPriority;
+            mAsyncWorkerName    = std::move(src.mAsyncWorkerName);
+            mAsyncNumaAware     = src.mAsyncNumaAware;
+            mAsyncLargePages    = src.mAsyncLargePages;
+            mAsyncPrefaultMemory = src.mAsyncPrefaultMemory;
+            mAsyncThreadStagingSize = src.mAsyncThreadStagingSize;
+            mAsyncSinkQueueCapacity = src.mAsyncSinkQueueCapacity;
+            mAsyncSinkBlockWhenFull = src.mAsyncSinkBlockWhenFull;
+            mAsyncLatencyHistograms = src.mAsyncLatencyHistograms;
+            mAsyncLatencySummaryInterval = src.mAsyncLatencySummaryInterval;
+            mAsyncMemoryBudget = std::move(src.mAsyncMemoryBudget);
+            mCoalesceWindow = src.mCoalesceWindow;
+            mCoalesceByFormat = src.mCoalesceByFormat;
+            mRateLimiter = std::move(src.mRateLimiter);
         }
 
         return *this;
@@ -124,6 +257,108 @@ namespace SLL
             return false;
         }
 
+        // Compare flush intervals.
+        if ( mFlushInterval != other.mFlushInterval )
+        {
+            return false;
+        }
+
+        // Compare async batching settings.
+        if ( mAsyncBatchLatency != other.mAsyncBatchLatency || mAsyncBatchSize != other.mAsyncBatchSize )
+        {
+            return false;
+        }
+
+        // Compare async executors (same executor object, or both none).
+        if ( mAsyncExecutor != other.mAsyncExecutor )
+        {
+            return false;
+        }
+
+        // Compare crash-drain settings.
+        if ( mAsyncDrainOnCrash != other.mAsyncDrainOnCrash )
+        {
+            return false;
+        }
+
+        // Compare LogSignalSafe capacities.
+        if ( mAsyncSignalSafeCapacity != other.mAsyncSignalSafeCapacity )
+        {
+            return false;
+        }
+
+        // Compare async queue capacities.
+        if ( mAsyncQueueCapacity != other.mAsyncQueueCapacity )
+        {
+            return false;
+        }
+
+        // Compare async spill files.
+        if ( mAsyncSpillFile != other.mAsyncSpillFile )
+        {
+            return false;
+        }
+
+        // Compare eager-start settings.
+        if ( mAsyncEagerStart != other.mAsyncEagerStart )
+        {
+            return false;
+        }
+
+        // Compare async worker thread settings.
+        if ( mAsyncWorkerAffinity != other.mAsyncWorkerAffinity || mAsyncWorkerPriority != other.mAsyncWorkerPriority || mAsyncWorkerName != other.mAsyncWorkerName )
+        {
+            return false;
+        }
+
+        // Compare NUMA settings.
+        if ( mAsyncNumaAware != other.mAsyncNumaAware )
+        {
+            return false;
+        }
+
+        // Compare queue memory settings.
+        if ( mAsyncLargePages != other.mAsyncLargePages || mAsyncPrefaultMemory != other.mAsyncPrefaultMemory )
+        {
+            return false;
+        }
+
+        // Compare thread staging settings.
+        if ( mAsyncThreadStagingSize != other.mAsyncThreadStagingSize )
+        {
+            return false;
+        }
+
+        // Compare sink delivery queue settings.
+        if ( mAsyncSinkQueueCapacity != other.mAsyncSinkQueueCapacity || mAsyncSinkBlockWhenFull != other.mAsyncSinkBlockWhenFull )
+        {
+            return false;
+        }
+
+        // Compare latency histogram settings.
+        if ( mAsyncLatencyHistograms != other.mAsyncLatencyHistograms || mAsyncLatencySummaryInterval != other.mAsyncLatencySummaryInterval )
+        {
+            return false;
+        }
+
+        // Compare memory budgets (same budget object, not just the same limits).
+        if ( mAsyncMemoryBudget != other.mAsyncMemoryBudget )
+        {
+            return false;
+        }
+
+        // Compare coalescing settings.
+        if ( mCoalesceWindow != other.mCoalesceWindow || mCoalesceByFormat != other.mCoalesceByFormat )
+        {
+            return false;
+        }
+
+        // Compare rate limiters (same limiter object, not just the same limits).
+        if ( mRateLimiter != other.mRateLimiter )
+        {
+            return false;
+        }
+
         // All data members matched.
         return true;
     }
@@ -161,6 +396,150 @@ namespace SLL
         return mLogFile;
     }
 
+    // Getter - Periodic Flush Interval
+    size_t ConfigPackage::GetFlushInterval( ) const noexcept
+    {
+        return mFlushInterval;
+    }
+
+    // Getter - Async Batch Latency Target
+    std::chrono::microseconds ConfigPackage::GetAsyncBatchLatency( ) const noexcept
+    {
+        return mAsyncBatchLatency;
+    }
+
+    // Getter - Async Maximum Batch Size
+    size_t ConfigPackage::GetAsyncBatchSize( ) const noexcept
+    {
+        return mAsyncBatchSize;
+    }
+
+    // Getter - Async Executor
+    const std::shared_ptr<IAsyncExecutor>& ConfigPackage::GetAsyncExecutor( ) const noexcept
+    {
+        return mAsyncExecutor;
+    }
+
+    // Getter - Async Drain On Crash
+    bool ConfigPackage::GetAsyncDrainOnCrash( ) const noexcept
+    {
+        return mAsyncDrainOnCrash;
+    }
+
+    // Getter - Async LogSignalSafe Capacity
+    size_t ConfigPackage::GetAsyncSignalSafeCapacity( ) const noexcept
+    {
+        return mAsyncSignalSafeCapacity;
+    }
+
+    // Getter - Async Queue Capacity
+    size_t ConfigPackage::GetAsyncQueueCapacity( ) const noexcept
+    {
+        return mAsyncQueueCapacity;
+    }
+
+    // Getter - Async Spill File
+    const std::filesystem::path& ConfigPackage::GetAsyncSpillFile( ) const noexcept
+    {
+        return mAsyncSpillFile;
+    }
+
+    // Getter - Async Eager Start
+    bool ConfigPackage::GetAsyncEagerStart( ) const noexcept
+    {
+        return mAsyncEagerStart;
+    }
+
+    // Getter - Async Worker Affinity
+    uint64_t ConfigPackage::GetAsyncWorkerAffinity( ) const noexcept
+    {
+        return mAsyncWorkerAffinity;
+    }
+
+    // Getter - Async Worker Priority
+    int ConfigPackage::GetAsyncWorkerPriority( ) const noexcept
+    {
+        return mAsyncWorkerPriority;
+    }
+
+    // Getter - Async Worker Name
+    const std::basic_string<utf16>& ConfigPackage::GetAsyncWorkerName( ) const noexcept
+    {
+        return mAsyncWorkerName;
+    }
+
+    // Getter - Async NUMA Aware
+    bool ConfigPackage::GetAsyncNumaAware( ) const noexcept
+    {
+        return mAsyncNumaAware;
+    }
+
+    // Getter - Async Large Pages
+    bool ConfigPackage::GetAsyncLargePages( ) const noexcept
+    {
+        return mAsyncLargePages;
+    }
+
+    // Getter - Async Prefault Memory
+    bool ConfigPackage::GetAsyncPrefaultMemory( ) const noexcept
+    {
+        return mAsyncPrefaultMemory;
+    }
+
+    // Getter - Async Thread Staging Size
+    size_t ConfigPackage::GetAsyncThreadStagingSize( ) const noexcept
+    {
+        return mAsyncThreadStagingSize;
+    }
+
+    // Getter - Async Sink Queue Capacity
+    size_t ConfigPackage::GetAsyncSinkQueueCapacity( ) const noexcept
+    {
+        return mAsyncSinkQueueCapacity;
+    }
+
+    // Getter - Async Sink Block When Full
+    bool ConfigPackage::GetAsyncSinkBlockWhenFull( ) const noexcept
+    {
+        return mAsyncSinkBlockWhenFull;
+    }
+
+    // Getter - Async Latency Histograms
+    bool ConfigPackage::GetAsyncLatencyHistograms( ) const noexcept
+    {
+        return mAsyncLatencyHistograms;
+    }
+
+    // Getter - Async Latency Summary Interval
+    std::chrono::milliseconds ConfigPackage::GetAsyncLatencySummaryInterval( ) const noexcept
+    {
+        return mAsyncLatencySummaryInterval;
+    }
+
+    // Getter - Async Memory Budget
+    const std::shared_ptr<MemoryBudget>& ConfigPackage::GetAsyncMemoryBudget( ) const noexcept
+    {
+        return mAsyncMemoryBudget;
+    }
+
+    // Getter - Coalesce Window
+    std::chrono::milliseconds ConfigPackage::GetCoalesceWindow( ) const noexcept
+    {
+        return mCoalesceWindow;
+    }
+
+    // Getter - Coalesce By Format
+    bool ConfigPackage::GetCoalesceByFormat( ) const noexcept
+    {
+        return mCoalesceByFormat;
+    }
+
+    // Getter - Rate Limiter
+    const std::shared_ptr<RateLimiter>& ConfigPackage::GetRateLimiter( ) const noexcept
+    {
+        return mRateLimiter;
+    }
+
     /// SETTERS \\\
 
     // Setter - Log Color for VerbosityLevel
@@ -192,6 +571,168 @@ namespace SLL
         mLogFile = std::move(file);
     }
 
+    // Setter - Periodic Flush Interval
+    void ConfigPackage::SetFlushInterval(const size_t interval)
+    {
+        mFlushInterval = interval;
+    }
+
+    // Setter - Async Batch Latency Target
+    void ConfigPackage::SetAsyncBatchLatency(const std::chrono::microseconds latency)
+    {
+        ValidateAsyncBatchLatency(latency, __FUNCTION__);
+
+        mAsyncBatchLatency = latency;
+    }
+
+    // Setter - Async Maximum Batch Size
+    void ConfigPackage::SetAsyncBatchSize(const size_t size)
+    {
+        ValidateAsyncBatchSize(size, __FUNCTION__);
+
+        mAsyncBatchSize = size;
+    }
+
+    // Setter - Async Executor
+    void ConfigPackage::SetAsyncExecutor(const std::shared_ptr<IAsyncExecutor>& pExecutor)
+    {
+        mAsyncExecutor = pExecutor;
+    }
+
+    // Setter - Async Drain On Crash
+    void ConfigPackage::SetAsyncDrainOnCrash(const bool bDrain)
+    {
+        mAsyncDrainOnCrash = bDrain;
+    }
+
+    // Setter - Async LogSignalSafe Capacity
+    void ConfigPackage::SetAsyncSignalSafeCapacity(const size_t capacity)
+    {
+        mAsyncSignalSafeCapacity = capacity;
+    }
+
+    // Setter - Async Queue Capacity
+    void ConfigPackage::SetAsyncQueueCapacity(const size_t capacity)
+    {
+        mAsyncQueueCapacity = capacity;
+    }
+
+    // Setter - Async Spill File
+    void ConfigPackage::SetAsyncSpillFile(const std::filesystem::path& file)
+    {
+        mAsyncSpillFile = file;
+    }
+
+    // Setter - Async Eager Start
+    void ConfigPackage::SetAsyncEagerStart(const bool bEager)
+    {
+        mAsyncEagerStart = bEager;
+    }
+
+    // Setter - Async Worker Affinity
+    void ConfigPackage::SetAsyncWorkerAffinity(const uint64_t affinityMask)
+    {
+        ValidateAsyncWorkerAffinity(affinityMask, __FUNCTION__);
+
+        mAsyncWorkerAffinity = affinityMask;
+    }
+
+    // Setter - Async Worker Priority
+    void ConfigPackage::SetAsyncWorkerPriority(const int priority)
+    {
+        ValidateAsyncWorkerPriority(priority, __FUNCTION__);
+
+        mAsyncWorkerPriority = priority;
+    }
+
+    // Setter - Async Worker Name
+    void ConfigPackage::SetAsyncWorkerName(const std::basic_string<utf16>& name)
+    {
+        mAsyncWorkerName = name;
+    }
+
+    // Setter - Async NUMA Aware
+    void ConfigPackage::SetAsyncNumaAware(const bool bNumaAware)
+    {
+        mAsyncNumaAware = bNumaAware;
+    }
+
+    // Setter - Async Large Pages
+    void ConfigPackage::SetAsyncLargePages(const bool bLargePages)
+    {
+        mAsyncLargePages = bLargePages;
+    }
+
+    // Setter - Async Prefault Memory
+    void ConfigPackage::SetAsyncPrefaultMemory(const bool bPrefault)
+    {
+        mAsyncPrefaultMemory = bPrefault;
+    }
+
+    // Setter - Async Thread Staging Size
+    void ConfigPackage::SetAsyncThreadStagingSize(const size_t size)
+    {
+        mAsyncThreadStagingSize = size;
+    }
+
+    // Setter - Async Sink Queue Capacity
+    void ConfigPackage::SetAsyncSinkQueueCapacity(const size_t capacity)
+    {
+        mAsyncSinkQueueCapacity = capacity;
+    }
+
+    // Setter - Async Sink Block When Full
+    void ConfigPackage::SetAsyncSinkBlockWhenFull(const bool bBlock)
+    {
+        mAsyncSinkBlockWhenFull = bBlock;
+    }
+
+    // Setter - Async Latency Histograms
+    void ConfigPackage::SetAsyncLatencyHistograms(const bool bEnable)
+    {
+        mAsyncLatencyHistograms = bEnable;
+    }
+
+    // Setter - Async Latency Summary Interval
+    // - Note: Summaries are built from the histograms, so a non-zero interval enables them too.
+    void ConfigPackage::SetAsyncLatencySummaryInterval(const std::chrono::milliseconds interval)
+    {
+        ValidateAsyncLatencySummaryInterval(interval, __FUNCTION__);
+
+        mAsyncLatencySummaryInterval = interval;
+
+        if ( interval > std::chrono::milliseconds::zero( ) )
+        {
+            mAsyncLatencyHistograms = true;
+        }
+    }
+
+    // Setter - Async Memory Budget
+    void ConfigPackage::SetAsyncMemoryBudget(const std::shared_ptr<MemoryBudget>& pBudget)
+    {
+        mAsyncMemoryBudget = pBudget;
+    }
+
+    // Setter - Coalesce Window
+    void ConfigPackage::SetCoalesceWindow(const std::chrono::milliseconds window)
+    {
+        ValidateCoalesceWindow(window, __FUNCTION__);
+
+        mCoalesceWindow = window;
+    }
+
+    // Setter - Coalesce By Format
+    void ConfigPackage::SetCoalesceByFormat(const bool bEnable)
+    {
+        mCoalesceByFormat = bEnable;
+    }
+
+    // Setter - Rate Limiter
+    void ConfigPackage::SetRateLimiter(const std::shared_ptr<RateLimiter>& pLimiter)
+    {
+        mRateLimiter = pLimiter;
+    }
+
     /// PUBLIC METHODS \\\
 
     // Public Method - Enable OptionFlag
@@ -0,0 +1,190 @@
+// For the watchdog's events and process termination.
+#include <Windows.h>
+
+// Class Header
+#include <CrashDrain.h>
+
+// SLL
+#include <AsyncLogger.h>
+
+// STL
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace SLL
+{
+    /// Non-Member Static Data \\\
+
+    using SignalHandler = void (*)(int);
+
+    // Registered loggers - plain atomic slots, so the handlers never need to take a lock.
+    static std::atomic<const AsyncLogger*> s_Loggers[CrashDrain::MaxLoggers];
+
+    // Set once a crash drain starts (never cleared) / while one is running.
+    static std::atomic<bool> s_bDrainStarted(false);
+    static std::atomic<bool> s_bDrainInProgress(false);
+
+    // Signaled when a drain starts / finishes - events, since the signal handlers can't use a condition variable.
+    static HANDLE s_hDrainStarted = nullptr;
+    static HANDLE s_hDrainFinished = nullptr;
+
+    // Handlers we replaced, restored before handing the crash back.
+    static std::once_flag s_InstallOnce;
+    static std::terminate_handler s_PrevTerminate = nullptr;
+    static const int s_Signals[ ] = { SIGABRT, SIGSEGV, SIGILL, SIGFPE };
+    static SignalHandler s_PrevSignalHandlers[std::size(s_Signals)];
+
+    /// Private Helper Methods \\\
+
+    // Install the terminate and signal handlers (once per process).
+    // - Note: The watchdog is started first - the handlers are only installed once it's there to back them up.
+    void CrashDrain::InstallHandlers( )
+    {
+        s_hDrainStarted = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        s_hDrainFinished = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+        if ( !s_hDrainStarted || !s_hDrainFinished )
+        {
+            throw std::runtime_error(__FUNCTION__" - Failed to create crash drain events.");
+        }
+
+        std::thread(Watchdog).detach( );
+
+        s_PrevTerminate = std::set_terminate(OnTerminate);
+
+        for ( size_t i = 0; i < std::size(s_Signals); i++ )
+        {
+            const SignalHandler prev = std::signal(s_Signals[i], OnSignal);
+            s_PrevSignalHandlers[i] = (prev == SIG_ERR) ? SIG_DFL : prev;
+        }
+    }
+
+    // Drain every registered logger (only the first call does anything).
+    // - Note: e.g., the default terminate handler calls abort, which then raises SIGABRT.
+    // - Note: Every logger shares the one budget - a logger that's still writing when it runs out leaves the rest unwritten.
+    void CrashDrain::DrainAll(const bool bSignal) noexcept
+    {
+        if ( s_bDrainStarted.exchange(true) )
+        {
+            return;
+        }
+
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now( ) + DrainBudget;
+
+        s_bDrainInProgress = true;
+        ::SetEvent(s_hDrainStarted);
+
+        for ( std::atomic<const AsyncLogger*>& slot : s_Loggers )
+        {
+            const AsyncLogger* pLogger = slot.load( );
+
+            if ( pLogger )
+            {
+                pLogger->DrainOnCrash(deadline, bSignal);
+            }
+        }
+
+        ::SetEvent(s_hDrainFinished);
+        s_bDrainInProgress = false;
+    }
+
+    // Watchdog thread - ends the process if a drain outlasts DrainTimeout.
+    // - Note: e.g., the crash happened inside the allocator, and a sink's write is now waiting on the heap lock the crashed
+    //         thread holds.  The process is ended with abort's exit code, without running anything else that could hang.
+    void CrashDrain::Watchdog( ) noexcept
+    {
+        if ( ::WaitForSingleObject(s_hDrainStarted, INFINITE) != WAIT_OBJECT_0 )
+        {
+            return;
+        }
+
+        if ( ::WaitForSingleObject(s_hDrainFinished, static_cast<DWORD>(DrainTimeout.count( ))) == WAIT_TIMEOUT )
+        {
+            ::TerminateProcess(::GetCurrentProcess( ), 3);
+        }
+    }
+
+    // std::terminate handler.
+    void CrashDrain::OnTerminate( )
+    {
+        DrainAll(false);
+
+        if ( s_PrevTerminate )
+        {
+            s_PrevTerminate( );
+        }
+
+        // Terminate handlers must not return.
+        std::abort( );
+    }
+
+    // Signal handler.
+    void CrashDrain::OnSignal(int sig)
+    {
+        DrainAll(true);
+
+        // Put the original handler back and re-raise, so the process goes down the way it would have without us.
+        for ( size_t i = 0; i < std::size(s_Signals); i++ )
+        {
+            if ( s_Signals[i] == sig )
+            {
+                std::signal(sig, s_PrevSignalHandlers[i]);
+                break;
+            }
+        }
+
+        std::raise(sig);
+    }
+
+    /// Public Methods \\\
+
+    // Drain pLogger if the process crashes.  Installs the handlers on first use.
+    // Returns false if all MaxLoggers slots are taken - pLogger works as usual, it just isn't drained.
+    bool CrashDrain::Register(const AsyncLogger* pLogger)
+    {
+        if ( !pLogger )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid logger argument (nullptr).");
+        }
+
+        std::call_once(s_InstallOnce, InstallHandlers);
+
+        for ( std::atomic<const AsyncLogger*>& slot : s_Loggers )
+        {
+            const AsyncLogger* pExpected = nullptr;
+
+            if ( slot.compare_exchange_strong(pExpected, pLogger) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Stop draining pLogger - must be called before it's destroyed.
+    void CrashDrain::Unregister(const AsyncLogger* pLogger) noexcept
+    {
+        for ( std::atomic<const AsyncLogger*>& slot : s_Loggers )
+        {
+            const AsyncLogger* pExpected = pLogger;
+
+            if ( slot.compare_exchange_strong(pExpected, nullptr) )
+            {
+                break;
+            }
+        }
+
+        // A crash drain may be writing this logger out right now - don't let it be destroyed underneath it.
+        while ( s_bDrainInProgress )
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,701 @@
+// Class Header
+#include <DeferredFormat.h>
+
+// CC
+#include <CCStringUtil.h>
+
+// STL
+#include <cstddef>
+#include <cstring>
+#include <cwchar>
+#include <limits>
+#include <stdexcept>
+
+namespace SLL
+{
+    using ReturnType = CC::StringUtil::ReturnType;
+
+    // Length recorded for a null string argument.
+    static constexpr size_t NullStringLength = std::numeric_limits<size_t>::max( );
+
+    // Longest conversion specification we're willing to replay (including null-terminator).
+    static constexpr size_t MaxSpecLength = 64;
+
+    /// Private Helper Methods \\\
+
+    // Parse the conversion specification starting at pSpec (which points at a '%').
+    template <class T>
+    DeferredFormat::Spec DeferredFormat::ParseSpec(const T* pSpec)
+    {
+        enum class LengthModifier { None, hh, h, l, ll, L, j, z, t, I, I32, I64, w };
+
+        Spec spec { 0, 0, false, ArgType::Int };
+        LengthModifier lm = LengthModifier::None;
+        size_t i = 1;
+
+        // Escaped percent sign - no argument.
+        if ( pSpec[i] == static_cast<T>('%') )
+        {
+            spec.length = 2;
+            spec.bLiteral = true;
+            return spec;
+        }
+
+        // Flags
+        while ( pSpec[i] == static_cast<T>('-') || pSpec[i] == static_cast<T>('+') || pSpec[i] == static_cast<T>(' ') ||
+                pSpec[i] == static_cast<T>('#') || pSpec[i] == static_cast<T>('0') || pSpec[i] == static_cast<T>('\'') )
+        {
+            i++;
+        }
+
+        // Width
+        if ( pSpec[i] == static_cast<T>('*') )
+        {
+            spec.starCount++;
+            i++;
+        }
+        else
+        {
+            while ( pSpec[i] >= static_cast<T>('0') && pSpec[i] <= static_cast<T>('9') )
+            {
+                i++;
+            }
+        }
+
+        // Precision
+        if ( pSpec[i] == static_cast<T>('.') )
+        {
+            i++;
+
+            if ( pSpec[i] == static_cast<T>('*') )
+            {
+                spec.starCount++;
+                i++;
+            }
+            else
+            {
+                while ( pSpec[i] >= static_cast<T>('0') && pSpec[i] <= static_cast<T>('9') )
+                {
+                    i++;
+                }
+            }
+        }
+
+        // Length Modifier
+        switch ( pSpec[i] )
+        {
+        case static_cast<T>('h'):
+            lm = (pSpec[i + 1] == static_cast<T>('h')) ? LengthModifier::hh : LengthModifier::h;
+            i += (lm == LengthModifier::hh) ? 2 : 1;
+            break;
+
+        case static_cast<T>('l'):
+            lm = (pSpec[i + 1] == static_cast<T>('l')) ? LengthModifier::ll : LengthModifier::l;
+            i += (lm == LengthModifier::ll) ? 2 : 1;
+            break;
+
+        case static_cast<T>('I'):
+            if ( pSpec[i + 1] == static_cast<T>('3') && pSpec[i + 2] == static_cast<T>('2') )
+            {
+                lm = LengthModifier::I32;
+                i += 3;
+            }
+            else if ( pSpec[i + 1] == static_cast<T>('6') && pSpec[i + 2] == static_cast<T>('4') )
+            {
+                lm = LengthModifier::I64;
+                i += 3;
+            }
+            else
+            {
+                lm = LengthModifier::I;
+                i++;
+            }
+            break;
+
+        case static_cast<T>('L'):
+            lm = LengthModifier::L;
+            i++;
+            break;
+
+        case static_cast<T>('j'):
+            lm = LengthModifier::j;
+            i++;
+            break;
+
+        case static_cast<T>('z'):
+            lm = LengthModifier::z;
+            i++;
+            break;
+
+        case static_cast<T>('t'):
+            lm = LengthModifier::t;
+            i++;
+            break;
+
+        case static_cast<T>('w'):
+            lm = LengthModifier::w;
+            i++;
+            break;
+
+        default:
+            break;
+        }
+
+        // Conversion
+        switch ( pSpec[i] )
+        {
+        case static_cast<T>('d'):
+        case static_cast<T>('i'):
+        case static_cast<T>('u'):
+        case static_cast<T>('o'):
+        case static_cast<T>('x'):
+        case static_cast<T>('X'):
+            switch ( lm )
+            {
+            case LengthModifier::None:
+            case LengthModifier::hh:
+            case LengthModifier::h:
+            case LengthModifier::I32:
+                spec.type = ArgType::Int;
+                break;
+
+            case LengthModifier::l:
+                spec.type = ArgType::Long;
+                break;
+
+            case LengthModifier::ll:
+            case LengthModifier::I64:
+                spec.type = ArgType::LongLong;
+                break;
+
+            case LengthModifier::j:
+                spec.type = ArgType::IntMax;
+                break;
+
+            case LengthModifier::z:
+            case LengthModifier::I:
+                spec.type = ArgType::SizeT;
+                break;
+
+            case LengthModifier::t:
+                spec.type = ArgType::PtrDiff;
+                break;
+
+            default:
+                throw std::invalid_argument(__FUNCTION__" - Invalid length modifier for integer conversion.");
+            }
+            break;
+
+        // Characters are promoted to int whether they're narrow or wide.
+        case static_cast<T>('c'):
+        case static_cast<T>('C'):
+            spec.type = ArgType::Int;
+            break;
+
+        // Wide printf rules - %s is wide unless 'h' is given, %S is narrow unless 'l' or 'w' is given.
+        case static_cast<T>('s'):
+            spec.type = (lm == LengthModifier::h) ? ArgType::NarrowString : ArgType::WideString;
+            break;
+
+        case static_cast<T>('S'):
+            spec.type = (lm == LengthModifier::l || lm == LengthModifier::w) ? ArgType::WideString : ArgType::NarrowString;
+            break;
+
+        case static_cast<T>('f'):
+        case static_cast<T>('F'):
+        case static_cast<T>('e'):
+        case static_cast<T>('E'):
+        case static_cast<T>('g'):
+        case static_cast<T>('G'):
+        case static_cast<T>('a'):
+        case static_cast<T>('A'):
+            spec.type = (lm == LengthModifier::L) ? ArgType::LongDouble : ArgType::Double;
+            break;
+
+        case static_cast<T>('p'):
+            spec.type = ArgType::Pointer;
+            break;
+
+        case static_cast<T>('\0'):
+            throw std::invalid_argument(__FUNCTION__" - Incomplete conversion specification at end of format string.");
+
+        default:
+            throw std::invalid_argument(
+                __FUNCTION__" - Unsupported conversion specifier (" +
+                std::to_string(static_cast<uint32_t>(pSpec[i])) +
+                ")."
+            );
+        }
+
+        spec.length = i + 1;
+        return spec;
+    }
+
+    // Copy a value into the capture buffer (or just count its bytes, if pBuf is null).
+    void DeferredFormat::Store(uint8_t* pBuf, const size_t bufLen, size_t& offset, const void* pSrc, const size_t bytes)
+    {
+        if ( pBuf )
+        {
+            if ( bytes > bufLen || offset > bufLen - bytes )
+            {
+                throw std::runtime_error(__FUNCTION__" - Capture buffer is too small for the argument list.");
+            }
+
+            memcpy(pBuf + offset, pSrc, bytes);
+        }
+
+        offset += bytes;
+    }
+
+    // Copy a value out of the capture buffer.
+    void DeferredFormat::Load(const uint8_t* pBuf, const size_t bufLen, size_t& offset, void* pDst, const size_t bytes)
+    {
+        if ( bytes > bufLen || offset > bufLen - bytes )
+        {
+            throw std::runtime_error(__FUNCTION__" - Captured arguments don't match the format string.");
+        }
+
+        memcpy(pDst, pBuf + offset, bytes);
+        offset += bytes;
+    }
+
+    // Capture (or size, if pBuf is null) the arguments referenced by pFormat.
+    template <class T>
+    size_t DeferredFormat::CaptureArgs(const T* pFormat, va_list pArgs, uint8_t* pBuf, const size_t bufLen)
+    {
+        size_t offset = 0;
+        va_list args;
+
+        if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format string (nullptr).");
+        }
+
+        // Work on a copy so the caller's argument list can be walked again.
+        va_copy(args, pArgs);
+
+        try
+        {
+            for ( const T* p = pFormat; *p != static_cast<T>('\0'); p++ )
+            {
+                if ( *p != static_cast<T>('%') )
+                {
+                    continue;
+                }
+
+                const Spec spec = ParseSpec(p);
+                p += spec.length - 1;
+
+                if ( spec.bLiteral )
+                {
+                    continue;
+                }
+
+                // Width/precision arguments come first.
+                for ( size_t s = 0; s < spec.starCount; s++ )
+                {
+                    const int star = va_arg(args, int);
+                    Store(pBuf, bufLen, offset, &star, sizeof(star));
+                }
+
+                switch ( spec.type )
+                {
+                case ArgType::Int:
+                {
+                    const int val = va_arg(args, int);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::Long:
+                {
+                    const long val = va_arg(args, long);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::LongLong:
+                {
+                    const long long val = va_arg(args, long long);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::IntMax:
+                {
+                    const intmax_t val = va_arg(args, intmax_t);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::SizeT:
+                {
+                    const size_t val = va_arg(args, size_t);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::PtrDiff:
+                {
+                    const ptrdiff_t val = va_arg(args, ptrdiff_t);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::Double:
+                {
+                    const double val = va_arg(args, double);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::LongDouble:
+                {
+                    const long double val = va_arg(args, long double);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                case ArgType::Pointer:
+                {
+                    const void* val = va_arg(args, const void*);
+                    Store(pBuf, bufLen, offset, &val, sizeof(val));
+                    break;
+                }
+
+                // Strings are copied by value (including null-terminator), prefixed by their length.
+                case ArgType::NarrowString:
+                {
+                    const utf8* pStr = va_arg(args, const utf8*);
+                    const size_t len = (pStr) ? strlen(pStr) + 1 : NullStringLength;
+
+                    Store(pBuf, bufLen, offset, &len, sizeof(len));
+                    if ( pStr )
+                    {
+                        Store(pBuf, bufLen, offset, pStr, len * sizeof(utf8));
+                    }
+                    break;
+                }
+
+                case ArgType::WideString:
+                {
+                    const utf16* pStr = va_arg(args, const utf16*);
+                    const size_t len = (pStr) ? wcslen(reinterpret_cast<const wchar_t*>(pStr)) + 1 : NullStringLength;
+
+                    Store(pBuf, bufLen, offset, &len, sizeof(len));
+                    if ( pStr )
+                    {
+                        // Keep wide characters aligned, so Render can hand out a pointer straight into the buffer.
+                        offset += offset % sizeof(utf16);
+                        Store(pBuf, bufLen, offset, pStr, len * sizeof(utf16));
+                    }
+                    break;
+                }
+                }
+            }
+        }
+        catch ( const std::exception& )
+        {
+            va_end(args);
+            throw;
+        }
+
+        va_end(args);
+        return offset;
+    }
+
+    // Render a single conversion specification with its value and append the result.
+    template <class V>
+    void DeferredFormat::AppendSpec(std::basic_string<utf16>& out, const utf16* pSpec, const int* pStars, const size_t starCount, const V& val)
+    {
+        const wchar_t* pWideSpec = reinterpret_cast<const wchar_t*>(pSpec);
+        int len = -1;
+
+        switch ( starCount )
+        {
+        case 0:
+            len = _scwprintf(pWideSpec, val);
+            break;
+
+        case 1:
+            len = _scwprintf(pWideSpec, pStars[0], val);
+            break;
+
+        case 2:
+            len = _scwprintf(pWideSpec, pStars[0], pStars[1], val);
+            break;
+
+        default:
+            break;
+        }
+
+        if ( len < 0 )
+        {
+            throw std::runtime_error(__FUNCTION__" - Failed to determine length of formatted argument.");
+        }
+        else if ( len == 0 )
+        {
+            return;
+        }
+
+        const size_t offset = out.size( );
+        int writeLen = -1;
+
+        // Make room for the null-terminator swprintf insists on writing, then trim it back off.
+        out.resize(offset + static_cast<size_t>(len) + 1);
+        wchar_t* pDst = reinterpret_cast<wchar_t*>(&out[offset]);
+
+        switch ( starCount )
+        {
+        case 0:
+            writeLen = swprintf(pDst, static_cast<size_t>(len) + 1, pWideSpec, val);
+            break;
+
+        case 1:
+            writeLen = swprintf(pDst, static_cast<size_t>(len) + 1, pWideSpec, pStars[0], val);
+            break;
+
+        case 2:
+            writeLen = swprintf(pDst, static_cast<size_t>(len) + 1, pWideSpec, pStars[0], pStars[1], val);
+            break;
+
+        default:
+            break;
+        }
+
+        if ( writeLen != len )
+        {
+            out.resize(offset);
+            throw std::runtime_error(
+                __FUNCTION__" - swprintf wrote " +
+                std::to_string(writeLen) +
+                " characters - expected " +
+                std::to_string(len) +
+                "."
+            );
+        }
+
+        out.resize(offset + static_cast<size_t>(len));
+    }
+
+    /// Public Methods \\\
+
+    // Returns number of bytes needed to capture the arguments referenced by pFormat.
+    template <class T>
+    size_t DeferredFormat::GetCaptureSize(const T* pFormat, va_list pArgs)
+    {
+        return CaptureArgs<T>(pFormat, pArgs, nullptr, 0);
+    }
+
+    // Copy the arguments referenced by pFormat into pBuf.  Returns number of bytes written.
+    template <class T>
+    size_t DeferredFormat::Capture(const T* pFormat, va_list pArgs, uint8_t* pBuf, const size_t bufLen)
+    {
+        if ( !pBuf && bufLen != 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid capture buffer (nullptr).");
+        }
+
+        return CaptureArgs<T>(pFormat, pArgs, pBuf, bufLen);
+    }
+
+    // Replay pFormat against previously captured arguments, appending the formatted text to out (wide).
+    template <>
+    void DeferredFormat::Render<utf16>(const utf16* pFormat, const uint8_t* pBuf, const size_t bufLen, std::basic_string<utf16>& out)
+    {
+        utf16 specBuf[MaxSpecLength];
+        int stars[2] = { 0, 0 };
+        size_t offset = 0;
+
+        if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format string (nullptr).");
+        }
+        else if ( !pBuf && bufLen != 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid capture buffer (nullptr).");
+        }
+
+        const utf16* pLiteral = pFormat;
+        const utf16* p = pFormat;
+
+        while ( *p != L'\0' )
+        {
+            if ( *p != L'%' )
+            {
+                p++;
+                continue;
+            }
+
+            // Flush the literal text leading up to this specification.
+            out.append(pLiteral, p - pLiteral);
+
+            const Spec spec = ParseSpec(p);
+
+            if ( spec.bLiteral )
+            {
+                out.push_back(L'%');
+            }
+            else
+            {
+                if ( spec.length >= MaxSpecLength )
+                {
+                    throw std::invalid_argument(__FUNCTION__" - Conversion specification is too long (" + std::to_string(spec.length) + ").");
+                }
+
+                memcpy(specBuf, p, spec.length * sizeof(utf16));
+                specBuf[spec.length] = L'\0';
+
+                for ( size_t s = 0; s < spec.starCount; s++ )
+                {
+                    Load(pBuf, bufLen, offset, &stars[s], sizeof(int));
+                }
+
+                switch ( spec.type )
+                {
+                case ArgType::Int:
+                {
+                    int val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::Long:
+                {
+                    long val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::LongLong:
+                {
+                    long long val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::IntMax:
+                {
+                    intmax_t val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::SizeT:
+                {
+                    size_t val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::PtrDiff:
+                {
+                    ptrdiff_t val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::Double:
+                {
+                    double val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::LongDouble:
+                {
+                    long double val = 0;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::Pointer:
+                {
+                    const void* val = nullptr;
+                    Load(pBuf, bufLen, offset, &val, sizeof(val));
+                    AppendSpec(out, specBuf, stars, spec.starCount, val);
+                    break;
+                }
+
+                case ArgType::NarrowString:
+                {
+                    size_t len = 0;
+                    const utf8* pStr = nullptr;
+
+                    Load(pBuf, bufLen, offset, &len, sizeof(len));
+                    if ( len != NullStringLength )
+                    {
+                        if ( len == 0 || len > bufLen - offset )
+                        {
+                            throw std::runtime_error(__FUNCTION__" - Captured narrow string runs past end of capture buffer.");
+                        }
+
+                        pStr = reinterpret_cast<const utf8*>(pBuf + offset);
+                        offset += len * sizeof(utf8);
+                    }
+
+                    AppendSpec(out, specBuf, stars, spec.starCount, pStr);
+                    break;
+                }
+
+                case ArgType::WideString:
+                {
+                    size_t len = 0;
+                    const utf16* pStr = nullptr;
+
+                    Load(pBuf, bufLen, offset, &len, sizeof(len));
+                    if ( len != NullStringLength )
+                    {
+                        offset += offset % sizeof(utf16);
+                        if ( len == 0 || offset > bufLen || len > (bufLen - offset) / sizeof(utf16) )
+                        {
+                            throw std::runtime_error(__FUNCTION__" - Captured wide string runs past end of capture buffer.");
+                        }
+
+                        pStr = reinterpret_cast<const utf16*>(pBuf + offset);
+                        offset += len * sizeof(utf16);
+                    }
+
+                    AppendSpec(out, specBuf, stars, spec.starCount, pStr);
+                    break;
+                }
+                }
+            }
+
+            p += spec.length;
+            pLiteral = p;
+        }
+
+        // Trailing literal text.
+        out.append(pLiteral, p - pLiteral);
+    }
+
+    // Replay pFormat against previously captured arguments, appending the formatted text to out (narrow).
+    // - Note: Conversion specifications are plain ASCII, so the wide format lines up spec-for-spec with the narrow one.
+    template <>
+    void DeferredFormat::Render<utf8>(const utf8* pFormat, const uint8_t* pBuf, const size_t bufLen, std::basic_string<utf16>& out)
+    {
+        if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format string (nullptr).");
+        }
+
+        Render<utf16>(CC::StringUtil::UTFConversion<ReturnType::SmartCString, utf16, utf8>(pFormat).get( ), pBuf, bufLen, out);
+    }
+
+    /// Explicit Template Instantiation \\\
+
+    template size_t DeferredFormat::GetCaptureSize<utf8>(const utf8*, va_list);
+    template size_t DeferredFormat::GetCaptureSize<utf16>(const utf16*, va_list);
+
+    template size_t DeferredFormat::Capture<utf8>(const utf8*, va_list, uint8_t*, const size_t);
+    template size_t DeferredFormat::Capture<utf16>(const utf16*, va_list, uint8_t*, const size_t);
+}
\ No newline at end of file
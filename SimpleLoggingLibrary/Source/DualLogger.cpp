@@ -1,5 +1,6 @@
 #include <DualLogger.h>
 
+#include <algorithm>
 #include <thread>
 
 namespace SLL
@@ -8,31 +9,37 @@ namespace SLL
 
     // Shared ConfigPackage Constructor [C] 
     DualLogger::DualLogger(const ConfigPackage& config) :
-        mStdOutLogger(config),
-        mFileLogger(config)
+        mpRateLimiter(config.GetRateLimiter( )),
+        mStdOutLogger(WithoutRateLimiter(config)),
+        mFileLogger(WithoutRateLimiter(config))
     { }
 
     // Shared ConfigPackage Constructor [M]
     // - Note: Can't move both times, so copy first time then move second time.
     DualLogger::DualLogger(ConfigPackage&& config) :
-        mStdOutLogger(config),
-        mFileLogger(std::forward<ConfigPackage>(config))
+        mpRateLimiter(config.GetRateLimiter( )),
+        mStdOutLogger(WithoutRateLimiter(config)),
+        mFileLogger(WithoutRateLimiter(std::forward<ConfigPackage>(config)))
     { }
 
     // Separate ConfigPackages Constructor [C]
     DualLogger::DualLogger(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig) :
-        mStdOutLogger(stdOutConfig),
-        mFileLogger(fileConfig)
+        mpRateLimiter(GetSharedRateLimiter(stdOutConfig, fileConfig)),
+        mStdOutLogger(WithoutRateLimiter(stdOutConfig)),
+        mFileLogger(WithoutRateLimiter(fileConfig))
     { }
 
     // Separate ConfigPackages Constructor [M]
     DualLogger::DualLogger(ConfigPackage&& stdOutConfig, ConfigPackage&& fileConfig) :
-        mStdOutLogger(std::forward<ConfigPackage>(stdOutConfig)),
-        mFileLogger(std::forward<ConfigPackage>(fileConfig))
+        mpRateLimiter(GetSharedRateLimiter(stdOutConfig, fileConfig)),
+        mStdOutLogger(WithoutRateLimiter(std::forward<ConfigPackage>(stdOutConfig))),
+        mFileLogger(WithoutRateLimiter(std::forward<ConfigPackage>(fileConfig)))
     { }
 
     // Move Constructor
     DualLogger::DualLogger(DualLogger&& src) :
+        mpRateLimiter(std::move(src.mpRateLimiter)),
+        mStats(std::move(src.mStats)),
         mStdOutLogger(std::move(src.mStdOutLogger)),
         mFileLogger(std::move(src.mFileLogger))
     { }
@@ -52,12 +59,76 @@ namespace SLL
             throw std::invalid_argument(__FUNCTION__" - Attempted self-assignment.");
         }
 
+        mpRateLimiter = std::move(src.mpRateLimiter);
+        mStats = std::move(src.mStats);
         mStdOutLogger = std::forward<StdOutLogger>(src.mStdOutLogger);
         mFileLogger = std::forward<FileLogger>(src.mFileLogger);
 
         return *this;
     }
 
+    /// Private Helper Methods \\\
+
+    // Returns whether the call site is over its rate limit, counting the message if so - checked before either stream formats it.
+    // - Note: Messages neither stream would log don't count against the call site.
+    bool DualLogger::IsRateLimited(const VerbosityLevel& lvl, const void* pSite) const noexcept
+    {
+        if ( !mpRateLimiter || !pSite )
+        {
+            return false;
+        }
+
+        if ( lvl < std::min(mStdOutLogger.GetConfig( ).GetVerbosityThreshold( ), mFileLogger.GetConfig( ).GetVerbosityThreshold( )) )
+        {
+            return false;
+        }
+
+        if ( mpRateLimiter->Allow(pSite, lvl) )
+        {
+            return false;
+        }
+
+        mStats.Add(StatCounters::Counter::RateLimited);
+
+        return true;
+    }
+
+    // Returns the sequence number both streams should write for a message at lvl (none if neither stream would write one).
+    // - Note: Taken through StdOutLogger, so it comes from the same process-wide counter as every other logger.
+    std::optional<uint64_t> DualLogger::StampSequenceNumber(const VerbosityLevel& lvl) const
+    {
+        const auto WritesSequenceNumber = [&lvl](const ConfigPackage& config)
+        {
+            return config.OptionEnabled(OptionFlag::LogSequenceNumber) && lvl >= config.GetVerbosityThreshold( );
+        };
+
+        if ( !WritesSequenceNumber(mStdOutLogger.GetConfig( )) && !WritesSequenceNumber(mFileLogger.GetConfig( )) )
+        {
+            return std::nullopt;
+        }
+
+        return StdOutLogger::NextSequenceNumber( );
+    }
+
+    // Returns the rate limiter both ConfigPackages share - call sites are limited once per message, for both streams.
+    const std::shared_ptr<RateLimiter>& DualLogger::GetSharedRateLimiter(const ConfigPackage& stdOutConfig, const ConfigPackage& fileConfig)
+    {
+        if ( stdOutConfig.GetRateLimiter( ) != fileConfig.GetRateLimiter( ) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - ConfigPackages have different rate limiters.");
+        }
+
+        return stdOutConfig.GetRateLimiter( );
+    }
+
+    // Returns a copy of the ConfigPackage with its rate limiter removed - the streams leave rate limiting to us.
+    ConfigPackage DualLogger::WithoutRateLimiter(ConfigPackage config)
+    {
+        config.SetRateLimiter(nullptr);
+
+        return config;
+    }
+
     /// Getters \\\
 
     // Get immutable ConfigPackage reference for FileLogger
@@ -172,6 +243,54 @@ namespace SLL
         return ret;
     }
 
+    // Submit log message to stream(s) (variadic arguments, explicit thread ID and event time, narrow).
+    bool DualLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
+    // Submit log message to stream(s) (variadic arguments, explicit thread ID and event time, wide).
+    bool DualLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
     // Submit log message to stream(s) (va_list, narrow).
     bool DualLogger::Log(const VerbosityLevel& lvl, const utf8* pFormat, va_list pArgs) const
     {
@@ -187,14 +306,71 @@ namespace SLL
     // Submit log message to stream(s) (va_list, explicit thread ID, narrow).
     bool DualLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, va_list pArgs) const
     {
-        // Both StreamLogger objects handle sanity checks and errors.
-        return mStdOutLogger.Log(lvl, tid, pFormat, pArgs) && mFileLogger.Log(lvl, tid, pFormat, pArgs);
+        // Stamp the event once, so both streams agree on when it happened.
+        return Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
     }
 
     // Submit log message to stream(s) (va_list, explicit thread ID, wide).
     bool DualLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const
     {
+        // Stamp the event once, so both streams agree on when it happened.
+        return Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, explicit thread ID and event time, narrow).
+    bool DualLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const
+    {
+        if ( IsRateLimited(lvl, pFormat) )
+        {
+            return true;
+        }
+
+        // Stamp the sequence number once, so both streams agree on it too.
+        const std::optional<uint64_t> seq = StampSequenceNumber(lvl);
+
+        // Both StreamLogger objects handle sanity checks and errors.
+        return mStdOutLogger.LogInternal(lvl, tid, time, seq, pFormat, pArgs) && mFileLogger.LogInternal(lvl, tid, time, seq, pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, explicit thread ID and event time, wide).
+    bool DualLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const
+    {
+        if ( IsRateLimited(lvl, pFormat) )
+        {
+            return true;
+        }
+
+        // Stamp the sequence number once, so both streams agree on it too.
+        const std::optional<uint64_t> seq = StampSequenceNumber(lvl);
+
         // Both StreamLogger objects handle sanity checks and errors.
-        return mStdOutLogger.Log(lvl, tid, pFormat, pArgs) && mFileLogger.Log(lvl, tid, pFormat, pArgs);
+        return mStdOutLogger.LogInternal(lvl, tid, time, seq, pFormat, pArgs) && mFileLogger.LogInternal(lvl, tid, time, seq, pFormat, pArgs);
+    }
+
+    // Submit pre-formatted log record to both streams - message text is written as-is.
+    bool DualLogger::WriteRecord(const LogRecord& record) const
+    {
+        // Both StreamLogger objects handle sanity checks and errors.
+        return mStdOutLogger.WriteRecord(record) && mFileLogger.WriteRecord(record);
+    }
+
+    // Force any buffered log messages out to both streams.
+    bool DualLogger::Flush( ) const
+    {
+        // Attempt both flushes, even if the first one fails.
+        const bool stdOutFlushed = mStdOutLogger.Flush( );
+        const bool fileFlushed = mFileLogger.Flush( );
+
+        return stdOutFlushed && fileFlushed;
+    }
+
+    // Returns both loggers' statistics, added together (lock-free).
+    LogStats DualLogger::GetStats( ) const
+    {
+        LogStats stats = mStdOutLogger.GetStats( );
+        stats += mFileLogger.GetStats( );
+        stats += mStats.GetSnapshot( );
+
+        return stats;
     }
 }
\ No newline at end of file
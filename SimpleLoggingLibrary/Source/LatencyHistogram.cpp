@@ -0,0 +1,187 @@
+// Class Header
+#include <LatencyHistogram.h>
+
+// STL
+#include <cmath>
+
+namespace SLL
+{
+    // Next slot to hand out (round-robin across threads).
+    static std::atomic<size_t> s_NextSlot(0);
+
+    /// Snapshot Methods \\\
+
+    // Returns the value that pct percent of recorded values are at or below.
+    std::chrono::nanoseconds LatencyHistogram::Snapshot::GetPercentile(const double pct) const noexcept
+    {
+        if ( count == 0 )
+        {
+            return std::chrono::nanoseconds::zero( );
+        }
+
+        // Rank of the value we're after (1-based), rounded up so e.g. p100 is always the last value.
+        const double clamped = (pct < 0.0) ? 0.0 : (pct > 100.0) ? 100.0 : pct;
+        uint64_t rank = static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(count)));
+        uint64_t seen = 0;
+
+        if ( rank == 0 )
+        {
+            rank = 1;
+        }
+
+        for ( size_t i = 0; i < BucketCount; i++ )
+        {
+            seen += buckets[i];
+
+            if ( seen >= rank )
+            {
+                return std::chrono::nanoseconds(GetBucketUpperBound(i));
+            }
+        }
+
+        return GetMax( );
+    }
+
+    // Returns the mean recorded value.
+    std::chrono::nanoseconds LatencyHistogram::Snapshot::GetMean( ) const noexcept
+    {
+        return (count == 0) ? std::chrono::nanoseconds::zero( ) : std::chrono::nanoseconds(totalNanoseconds / count);
+    }
+
+    // Returns the largest recorded value, to bucket precision.
+    std::chrono::nanoseconds LatencyHistogram::Snapshot::GetMax( ) const noexcept
+    {
+        for ( size_t i = BucketCount; i > 0; i-- )
+        {
+            if ( buckets[i - 1] != 0 )
+            {
+                return std::chrono::nanoseconds(GetBucketUpperBound(i - 1));
+            }
+        }
+
+        return std::chrono::nanoseconds::zero( );
+    }
+
+    // Take away an earlier snapshot of the same histogram.
+    LatencyHistogram::Snapshot& LatencyHistogram::Snapshot::operator-=(const Snapshot& rhs) noexcept
+    {
+        for ( size_t i = 0; i < BucketCount; i++ )
+        {
+            buckets[i] -= rhs.buckets[i];
+        }
+
+        count -= rhs.count;
+        totalNanoseconds -= rhs.totalNanoseconds;
+
+        return *this;
+    }
+
+    /// Static Private Helper Methods \\\
+
+    // Returns the calling thread's slot index.
+    size_t LatencyHistogram::GetSlotIndex( ) noexcept
+    {
+        // Assigned on the thread's first use, shared by every histogram.
+        static thread_local const size_t slot = s_NextSlot.fetch_add(1, std::memory_order_relaxed) % SlotCount;
+
+        return slot;
+    }
+
+    /// Constructor \\\
+
+    // Default Constructor - all buckets start empty.
+    LatencyHistogram::LatencyHistogram( ) noexcept
+    {
+        Reset( );
+    }
+
+    /// Public Methods \\\
+
+    // Record a value (calling thread's slot only).
+    void LatencyHistogram::Record(const std::chrono::nanoseconds value) noexcept
+    {
+        const uint64_t ns = (value.count( ) > 0) ? static_cast<uint64_t>(value.count( )) : 0;
+        Slot& slot = mSlots[GetSlotIndex( )];
+
+        slot.buckets[GetBucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+        slot.count.fetch_add(1, std::memory_order_relaxed);
+        slot.totalNanoseconds.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    // Returns every slot's counts added together.
+    LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot( ) const noexcept
+    {
+        Snapshot snapshot;
+
+        for ( const Slot& slot : mSlots )
+        {
+            for ( size_t i = 0; i < BucketCount; i++ )
+            {
+                snapshot.buckets[i] += slot.buckets[i].load(std::memory_order_relaxed);
+            }
+
+            snapshot.count += slot.count.load(std::memory_order_relaxed);
+            snapshot.totalNanoseconds += slot.totalNanoseconds.load(std::memory_order_relaxed);
+        }
+
+        return snapshot;
+    }
+
+    // Empty every bucket.
+    void LatencyHistogram::Reset( ) noexcept
+    {
+        for ( Slot& slot : mSlots )
+        {
+            for ( std::atomic<uint64_t>& bucket : slot.buckets )
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+
+            slot.count.store(0, std::memory_order_relaxed);
+            slot.totalNanoseconds.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /// Static Public Methods \\\
+
+    // Returns the bucket a value is counted in.
+    // - Note: Values below SubBucketCount get a bucket each; above that, the top SubBucketBits bits after the
+    //         leading one pick the bucket within the value's power of two.
+    size_t LatencyHistogram::GetBucketIndex(const uint64_t nanoseconds) noexcept
+    {
+        if ( nanoseconds < SubBucketCount )
+        {
+            return static_cast<size_t>(nanoseconds);
+        }
+
+        size_t exponent = 0;
+
+        for ( uint64_t v = nanoseconds; v > 1; v >>= 1 )
+        {
+            exponent++;
+        }
+
+        if ( exponent > MaxExponent )
+        {
+            return BucketCount - 1;
+        }
+
+        const size_t subBucket = static_cast<size_t>(nanoseconds >> (exponent - SubBucketBits)) - SubBucketCount;
+
+        return SubBucketCount + (exponent - SubBucketBits) * SubBucketCount + subBucket;
+    }
+
+    // Returns the largest value counted in a bucket.
+    uint64_t LatencyHistogram::GetBucketUpperBound(const size_t index) noexcept
+    {
+        if ( index < SubBucketCount )
+        {
+            return index;
+        }
+
+        const size_t shift = (index - SubBucketCount) / SubBucketCount;
+        const uint64_t subBucket = (index - SubBucketCount) % SubBucketCount;
+
+        return ((SubBucketCount + subBucket + 1) << shift) - 1;
+    }
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 // Class Header
 #include <LoggerBase.h>
 
+// Sequence Number Counter
+#include <atomic>
+
 // std::put_time
 #include <iomanip>
 
@@ -16,6 +19,10 @@ namespace SLL
     static const SST s_TimeFormats(MAKE_STR_TUPLE("[%D - %T]  "));
     static const SST s_ThreadIDFormats(MAKE_STR_TUPLE("TID[%08X]  "));
     static const SST s_VerbosityLevelFormats(MAKE_STR_TUPLE("Type[%5.5s]  "));
+    static const SST s_SequenceNumberFormats(MAKE_STR_TUPLE("SEQ[%016llX]  "));
+
+    // Process-wide log sequence number - shared by every logger, so records from different loggers can be ordered.
+    static std::atomic<uint64_t> s_NextSequenceNumber(0);
 
 
     /// Common Private Helper Methods \\\
@@ -41,12 +48,19 @@ namespace SLL
         return std::get<std::basic_string<T>>(s_VerbosityLevelFormats);
     }
 
+    // Prefix - Sequence Number Format Getter
+    template <class T>
+    const std::basic_string<T>& LoggerBase::GetSequenceNumberFormat( )
+    {
+        return std::get<std::basic_string<T>>(s_SequenceNumberFormats);
+    }
+
     // Get Local Time String
     template <class T>
-    static std::basic_string<T> LoggerBase::GetLocalTime( )
+    static std::basic_string<T> LoggerBase::GetLocalTime(const LogTime& time)
     {
         std::basic_ostringstream<T> oss;
-        const std::time_t t = std::time(nullptr);
+        const std::time_t t = LogClock::to_time_t(time);
         std::tm tm;
 
         if ( localtime_s(&tm, &t) != 0 )
@@ -60,9 +74,9 @@ namespace SLL
 
     // Build Time Prefix String
     template<class T>
-    std::unique_ptr<T[ ]> LoggerBase::BuildTimePrefix( )
+    std::unique_ptr<T[ ]> LoggerBase::BuildTimePrefix(const LogTime& time)
     {
-        std::basic_string<T> str(GetLocalTime<T>( ));
+        std::basic_string<T> str(GetLocalTime<T>(time));
         return CC::StringUtil::Copy<CC::StringUtil::ReturnType::SmartCString, T>(str);
     }
 
@@ -106,25 +120,11 @@ namespace SLL
         return (i < 0) ? 0 : static_cast<size_t>(i) + 1;
     }
 
-    // Fills buffer with formatted string.  Expected to be used in conjunction with GetRequiredBufferLength( ) (narrow).
+    // Fills caller-provided buffer with formatted string.  Expected to be used in conjunction with GetRequiredBufferLength( ) (narrow).
     template <>
-    std::unique_ptr<utf8[ ]> LoggerBase::StringPrintWrapper<utf8>(const size_t bufLen, const utf8* pFormat, va_list pArgs)
+    void LoggerBase::StringPrint<utf8>(utf8* pBuf, const size_t bufLen, const utf8* pFormat, va_list pArgs)
     {
-        std::unique_ptr<utf8[ ]> buf;
-        int writeLen = 0;
-
-        if ( bufLen == 0 )
-        {
-            throw std::invalid_argument(__FUNCTION__" - Invalid destination buffer length (" + std::to_string(bufLen) + ").");
-        }
-        else if ( !pFormat )
-        {
-            throw std::invalid_argument(__FUNCTION__" - Invalid format string (nullptr).");
-        }
-
-        buf = std::make_unique<utf8[ ]>(bufLen);
-
-        writeLen = vsnprintf(buf.get( ), bufLen, pFormat, pArgs);
+        const int writeLen = vsnprintf(pBuf, bufLen, pFormat, pArgs);
 
         if ( writeLen < 0 )
         {
@@ -144,29 +144,13 @@ namespace SLL
                 "."
             );
         }
-
-        return buf;
     }
 
-    // Fills buffer with formatted string.  Expected to be used in conjunction with GetRequiredBufferLength( ) (wide).
+    // Fills caller-provided buffer with formatted string.  Expected to be used in conjunction with GetRequiredBufferLength( ) (wide).
     template <>
-    std::unique_ptr<utf16[ ]> LoggerBase::StringPrintWrapper<utf16>(const size_t bufLen, const utf16* pFormat, va_list pArgs)
+    void LoggerBase::StringPrint<utf16>(utf16* pBuf, const size_t bufLen, const utf16* pFormat, va_list pArgs)
     {
-        std::unique_ptr<utf16[ ]> buf;
-        int writeLen = 0;
-
-        if ( bufLen == 0 )
-        {
-            throw std::invalid_argument(__FUNCTION__" - Invalid destination buffer length (" + std::to_string(bufLen) + ").");
-        }
-        else if ( !pFormat )
-        {
-            throw std::invalid_argument(__FUNCTION__" - Invalid format string (nullptr).");
-        }
-
-        buf = std::make_unique<utf16[ ]>(bufLen);
-
-        writeLen = vswprintf(reinterpret_cast<wchar_t*>(buf.get( )), bufLen, reinterpret_cast<const wchar_t*>(pFormat), pArgs);
+        const int writeLen = vswprintf(reinterpret_cast<wchar_t*>(pBuf), bufLen, reinterpret_cast<const wchar_t*>(pFormat), pArgs);
 
         if ( writeLen < 0 )
         {
@@ -186,13 +170,29 @@ namespace SLL
                 "."
             );
         }
-
-        return buf;
     }
 
-    /// Common Immutable Static Protected Data Members Initialization \\\
+    // Allocates buffer and fills it with formatted string.  Expected to be used in conjunction with GetRequiredBufferLength( ).
+    template <class T>
+    std::unique_ptr<T[ ]> LoggerBase::StringPrintWrapper(const size_t bufLen, const T* pFormat, va_list pArgs)
+    {
+        std::unique_ptr<T[ ]> buf;
 
-    const size_t LoggerBase::mFlushInterval = 3;
+        if ( bufLen == 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid destination buffer length (" + std::to_string(bufLen) + ").");
+        }
+        else if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format string (nullptr).");
+        }
+
+        buf = std::make_unique<T[ ]>(bufLen);
+
+        StringPrint<T>(buf.get( ), bufLen, pFormat, pArgs);
+
+        return buf;
+    }
 
 ///
 //
@@ -237,6 +237,7 @@ namespace SLL
 
         mConfig = std::move(src.mConfig);
         mFlushCounter = src.mFlushCounter;
+        mStats = std::move(src.mStats);
 
         return *this;
     }
@@ -250,10 +251,16 @@ namespace SLL
 
     /// Common Protected Helper Methods \\\
 
+    // Returns the next process-wide log sequence number.
+    uint64_t LoggerBase::NextSequenceNumber( ) noexcept
+    {
+        return s_NextSequenceNumber.fetch_add(1, std::memory_order_relaxed);
+    }
+
     // Generates vector of log-ready strings that contains all enabled message-prefix output.
     // e.g., timestamp (mm/dd/yyyy, HH:mm::ss), thread id, verbosity level, etc.
     template <class T, typename>
-    std::vector<std::unique_ptr<T[ ]>> LoggerBase::BuildMessagePrefixes(const VerbosityLevel& lvl, const std::thread::id& tid) const
+    std::vector<std::unique_ptr<T[ ]>> LoggerBase::BuildMessagePrefixes(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const uint64_t seq) const
     {
         std::vector<std::unique_ptr<T[ ]>> prefixStrings;
 
@@ -266,7 +273,7 @@ namespace SLL
         {
             if ( mConfig.OptionEnabled(OptionFlag::LogTimestamp) )
             {
-                prefixStrings.push_back(BuildTimePrefix<T>( ));
+                prefixStrings.push_back(BuildTimePrefix<T>(time));
             }
 
             if ( mConfig.OptionEnabled(OptionFlag::LogThreadID) )
@@ -278,6 +285,11 @@ namespace SLL
             {
                 prefixStrings.push_back(BuildFormattedMessage<T>(GetVerbosityLevelFormat<T>( ).c_str( ), VerbosityLevelConverter::ToString<T>(lvl).c_str( )));
             }
+
+            if ( mConfig.OptionEnabled(OptionFlag::LogSequenceNumber) )
+            {
+                prefixStrings.push_back(BuildFormattedMessage<T>(GetSequenceNumberFormat<T>( ).c_str( ), static_cast<unsigned long long>(seq)));
+            }
         }
 
         return prefixStrings;
@@ -304,6 +316,37 @@ namespace SLL
         return StringPrintWrapper<T>(reqBufLen, pFormat, pArgs);
     }
 
+    // Returns required length of buffer, including null-terminator, to hold user's formatted log message.
+    template <class T, typename>
+    size_t LoggerBase::GetFormattedMessageLength(const T* pFormat, va_list pArgs)
+    {
+        const size_t reqBufLen = GetRequiredBufferLength<T>(pFormat, pArgs);
+
+        if ( reqBufLen == 0 )
+        {
+            throw std::runtime_error(__FUNCTION__" - Failed to get required size for log message buffer.");
+        }
+
+        return reqBufLen;
+    }
+
+    // Build user's formatted log message into caller-provided buffer (w/ va_list).
+    // Expected to be used in conjunction with GetFormattedMessageLength( ).
+    template <class T, typename>
+    void LoggerBase::PrintFormattedMessage(T* pBuf, const size_t bufLen, const T* pFormat, va_list pArgs)
+    {
+        if ( !pBuf || bufLen == 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid destination buffer (nullptr or zero length).");
+        }
+        else if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format string (nullptr).");
+        }
+
+        StringPrint<T>(pBuf, bufLen, pFormat, pArgs);
+    }
+
     // Build user's formatted log message (w/o va_list).
     template <class T, typename>
     std::unique_ptr<T[ ]> LoggerBase::BuildFormattedMessage(const T* pFormat, ...)
@@ -328,17 +371,37 @@ namespace SLL
         return str;
     }
 
+    /// Public Methods \\\
+
+    // Returns a snapshot of the logger's statistics (lock-free).
+    LogStats LoggerBase::GetStats( ) const
+    {
+        return mStats.GetSnapshot( );
+    }
+
     /// Explicit Template Instantiation \\\
 
+    // String Print Wrapper
+    template std::unique_ptr<utf8[ ]> LoggerBase::StringPrintWrapper<utf8>(const size_t, const utf8*, va_list);
+    template std::unique_ptr<utf16[ ]> LoggerBase::StringPrintWrapper<utf16>(const size_t, const utf16*, va_list);
+
     // Build Time Prefix String
-    template std::unique_ptr<utf8[ ]> LoggerBase::BuildTimePrefix<utf8>( );
-    template std::unique_ptr<utf16[ ]> LoggerBase::BuildTimePrefix<utf16>( );
+    template std::unique_ptr<utf8[ ]> LoggerBase::BuildTimePrefix<utf8>(const LogTime&);
+    template std::unique_ptr<utf16[ ]> LoggerBase::BuildTimePrefix<utf16>(const LogTime&);
 
     // Build Message Prefix Strings
-    template std::vector<std::unique_ptr<utf8[ ]>> LoggerBase::BuildMessagePrefixes<utf8>(const VerbosityLevel&, const std::thread::id&) const;
-    template std::vector<std::unique_ptr<utf16[ ]>> LoggerBase::BuildMessagePrefixes<utf16>(const VerbosityLevel&, const std::thread::id&) const;
+    template std::vector<std::unique_ptr<utf8[ ]>> LoggerBase::BuildMessagePrefixes<utf8>(const VerbosityLevel&, const std::thread::id&, const LogTime&, const uint64_t) const;
+    template std::vector<std::unique_ptr<utf16[ ]>> LoggerBase::BuildMessagePrefixes<utf16>(const VerbosityLevel&, const std::thread::id&, const LogTime&, const uint64_t) const;
 
     // Build Formatted String
     template std::unique_ptr<utf8[ ]> LoggerBase::BuildFormattedMessage<utf8>(const utf8*, va_list);
     template std::unique_ptr<utf16[ ]> LoggerBase::BuildFormattedMessage<utf16>(const utf16*, va_list);
+
+    // Formatted String Length
+    template size_t LoggerBase::GetFormattedMessageLength<utf8>(const utf8*, va_list);
+    template size_t LoggerBase::GetFormattedMessageLength<utf16>(const utf16*, va_list);
+
+    // Print Formatted String To Buffer
+    template void LoggerBase::PrintFormattedMessage<utf8>(utf8*, const size_t, const utf8*, va_list);
+    template void LoggerBase::PrintFormattedMessage<utf16>(utf16*, const size_t, const utf16*, va_list);
 }
\ No newline at end of file
@@ -0,0 +1,129 @@
+// Class Header
+#include <MemoryBudget.h>
+
+// STL
+#include <stdexcept>
+#include <string>
+
+namespace SLL
+{
+    /// Constructor \\\
+
+    // Limits are in bytes - softLimit must be non-zero, and no more than hardLimit.
+    MemoryBudget::MemoryBudget(const size_t softLimit, const size_t hardLimit, const VerbosityLevel shedThreshold) :
+        mSoftLimit(softLimit),
+        mHardLimit(hardLimit),
+        mShedThreshold(shedThreshold),
+        mBytesInUse(0),
+        mPeakBytes(0),
+        mShedCount(0),
+        mOverflowCount(0)
+    {
+        if ( softLimit == 0 || softLimit > hardLimit )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid limits (soft " + std::to_string(softLimit) + ", hard " + std::to_string(hardLimit) + ").");
+        }
+
+        if ( shedThreshold < VerbosityLevel::BEGIN || shedThreshold > VerbosityLevel::MAX )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid shedding threshold (" + std::to_string(static_cast<VerbosityLevelType>(shedThreshold)) + ").");
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Ask for room for a message of the specified size - it's only charged if Admitted is returned.
+    // - Note: Charged first and checked after, so racing threads can't both squeeze into the last of the room.
+    MemoryBudget::Admission MemoryBudget::Admit(const size_t bytes, const VerbosityLevel& lvl) noexcept
+    {
+        const size_t inUse = mBytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+        if ( inUse > mSoftLimit && lvl < mShedThreshold )
+        {
+            mBytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+            mShedCount.fetch_add(1, std::memory_order_relaxed);
+            return Admission::Shed;
+        }
+
+        if ( inUse > mHardLimit )
+        {
+            mBytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+            mOverflowCount.fetch_add(1, std::memory_order_relaxed);
+            return Admission::Overflow;
+        }
+
+        RaisePeak(inUse);
+
+        return Admission::Admitted;
+    }
+
+    // Charge memory that's already been allocated (e.g., a queue's storage) - unconditionally, since there's no turning it away.
+    // - Note: Counts towards the limits all the same, so messages are shed or overflow sooner.
+    void MemoryBudget::Charge(const size_t bytes) noexcept
+    {
+        RaisePeak(mBytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    }
+
+    // Give back room charged by Admit or Charge.
+    void MemoryBudget::Release(const size_t bytes) noexcept
+    {
+        mBytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    // Returns configured soft limit, in bytes.
+    size_t MemoryBudget::GetSoftLimit( ) const noexcept
+    {
+        return mSoftLimit;
+    }
+
+    // Returns configured hard limit, in bytes.
+    size_t MemoryBudget::GetHardLimit( ) const noexcept
+    {
+        return mHardLimit;
+    }
+
+    // Returns configured shedding threshold.
+    VerbosityLevel MemoryBudget::GetShedThreshold( ) const noexcept
+    {
+        return mShedThreshold;
+    }
+
+    // Returns bytes currently charged.
+    size_t MemoryBudget::GetBytesInUse( ) const noexcept
+    {
+        return mBytesInUse.load(std::memory_order_relaxed);
+    }
+
+    // Returns most bytes ever charged at once.
+    size_t MemoryBudget::GetPeakBytes( ) const noexcept
+    {
+        return mPeakBytes.load(std::memory_order_relaxed);
+    }
+
+    // Returns number of messages shed (past the soft limit).
+    uint64_t MemoryBudget::GetShedCount( ) const noexcept
+    {
+        return mShedCount.load(std::memory_order_relaxed);
+    }
+
+    // Returns number of messages sent down the overflow path (past the hard limit).
+    uint64_t MemoryBudget::GetOverflowCount( ) const noexcept
+    {
+        return mOverflowCount.load(std::memory_order_relaxed);
+    }
+
+    /// Private Helper Methods \\\
+
+    // Raise the peak if we've gone past it.
+    void MemoryBudget::RaisePeak(const size_t inUse) noexcept
+    {
+        size_t peak = mPeakBytes.load(std::memory_order_relaxed);
+        while ( inUse > peak )
+        {
+            if ( mPeakBytes.compare_exchange_weak(peak, inUse, std::memory_order_relaxed) )
+            {
+                break;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+// Class Header
+#include <MessageCoalescer.h>
+
+// STL
+#include <algorithm>
+#include <stdexcept>
+
+// CC StringUtil - UTF Conversions
+#include <CCStringUtil.h>
+
+namespace SLL
+{
+    using CC::StringUtil;
+    using ReturnType = StringUtil::ReturnType;
+
+    /// Private Helper Methods \\\
+
+    // Count a message as a repeat.
+    void MessageCoalescer::CountRepeat(Repeats& repeats, const LogRecord& record) noexcept
+    {
+        repeats.tid = record.tid;
+        repeats.last = record.time;
+        repeats.lastSeq = record.seq;
+        repeats.count++;
+    }
+
+    // Append the last message's summary (if it was repeated), and forget it - pEnding is the record that ended the run (if any).
+    // - Note: The summary takes the ending record's sequence number, so it sorts right before that record.
+    void MessageCoalescer::EndRun(const LogRecord* pEnding, std::vector<Summary>& summaries)
+    {
+        if ( mHasLastMessage && mRun.count != 0 )
+        {
+            summaries.push_back(Summary {
+                mRun.lvl,
+                mRun.tid,
+                mRun.last,
+                UTF16_LITERAL_STR("Last message repeated ") + std::to_wstring(mRun.count) + UTF16_LITERAL_STR(" times."),
+                (pEnding) ? pEnding->seq : mRun.lastSeq
+            });
+        }
+
+        // Keep the capacity for the next message.
+        mLastMessage.clear( );
+        mHasLastMessage = false;
+    }
+
+    // Append a format string's summary (if it was repeated) - pEnding is the record that ended the run (if any).
+    void MessageCoalescer::EndFormat(const FormatRepeats& format, const LogRecord* pEnding, std::vector<Summary>& summaries)
+    {
+        if ( format.repeats.count == 0 )
+        {
+            return;
+        }
+
+        const std::basic_string<utf16> formatStr = (format.pNarrowFormat) ? StringUtil::UTFConversion<ReturnType::StringObj, utf16>(format.pNarrowFormat)
+            : std::basic_string<utf16>(format.pWideFormat);
+
+        summaries.push_back(Summary {
+            format.repeats.lvl,
+            format.repeats.tid,
+            format.repeats.last,
+            UTF16_LITERAL_STR("Message \"") + formatStr + UTF16_LITERAL_STR("\" repeated ") + std::to_wstring(format.repeats.count) + UTF16_LITERAL_STR(" times."),
+            (pEnding) ? pEnding->seq : format.repeats.lastSeq
+        });
+    }
+
+    // Append summaries whose window has passed by now - pEnding is the record being submitted (if any).
+    void MessageCoalescer::ExpireRuns(const LogTime& now, const bool bAll, const LogRecord* pEnding, std::vector<Summary>& summaries)
+    {
+        // Once its window has passed, the last message is written again the next time it comes up.
+        if ( mHasLastMessage && (bAll || now - mRun.start >= mWindow) )
+        {
+            EndRun(pEnding, summaries);
+        }
+
+        // Only walk the format strings when one of them is due.
+        if ( mFormats.empty( ) || (!bAll && now < mNextExpiry) )
+        {
+            return;
+        }
+
+        mNextExpiry = LogTime::max( );
+
+        for ( auto it = mFormats.begin( ); it != mFormats.end( ); )
+        {
+            if ( bAll || now - it->second.repeats.start >= mWindow )
+            {
+                EndFormat(it->second, pEnding, summaries);
+                it = mFormats.erase(it);
+            }
+            else
+            {
+                mNextExpiry = std::min(mNextExpiry, it->second.repeats.start + mWindow);
+                ++it;
+            }
+        }
+    }
+
+    /// Constructor \\\
+
+    // Window must be positive - bByFormat also coalesces messages by their format string.
+    MessageCoalescer::MessageCoalescer(const std::chrono::milliseconds window, const bool bByFormat) :
+        mWindow(std::chrono::duration_cast<LogClock::duration>(window)),
+        mByFormat(bByFormat),
+        mHasLastMessage(false),
+        mRun { },
+        mNextExpiry(LogTime::max( ))
+    {
+        if ( window <= std::chrono::milliseconds::zero( ) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid window (" + std::to_string(window.count( )) + "ms).");
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Returns whether the record should be written - false if it's been counted as a repeat instead.
+    // Summaries that are due (e.g., for the run this record ends) are appended to summaries, to be written before it.
+    bool MessageCoalescer::Submit(const LogRecord& record, const utf8* pNarrowFormat, const utf16* pWideFormat, std::vector<Summary>& summaries)
+    {
+        const void* pFormat = (pNarrowFormat) ? static_cast<const void*>(pNarrowFormat) : static_cast<const void*>(pWideFormat);
+        const bool bByFormat = mByFormat && pFormat;
+
+        ExpireRuns(record.time, false, &record, summaries);
+
+        // Messages with a format string are matched by it, the rest by their text.
+        if ( bByFormat )
+        {
+            auto it = mFormats.find(pFormat);
+
+            if ( it != mFormats.end( ) )
+            {
+                CountRepeat(it->second.repeats, record);
+                return false;
+            }
+        }
+        else if ( mHasLastMessage && record.lvl == mRun.lvl && record.message == mLastMessage )
+        {
+            CountRepeat(mRun, record);
+            return false;
+        }
+
+        // It's getting written - so it ends the last message's run, and starts its own.
+        EndRun(&record, summaries);
+
+        mLastMessage.assign(record.message.data( ), record.message.size( ));
+        mHasLastMessage = true;
+        mRun = Repeats { record.lvl, record.tid, record.time, record.time, record.seq, 0 };
+
+        if ( bByFormat )
+        {
+            mFormats.emplace(pFormat, FormatRepeats { mRun, pNarrowFormat, pWideFormat });
+            mNextExpiry = std::min(mNextExpiry, record.time + mWindow);
+        }
+
+        return true;
+    }
+
+    // Append summaries whose window has passed by now (bAll - every pending summary, e.g., on shutdown).
+    void MessageCoalescer::Expire(const LogTime& now, const bool bAll, std::vector<Summary>& summaries)
+    {
+        ExpireRuns(now, bAll, nullptr, summaries);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+// For NUMA topology and node-local allocation.
+#include <Windows.h>
+
+// Class Declaration
+#include <NumaHelper.h>
+
+// STL
+#include <mutex>
+#include <new>
+
+namespace SLL
+{
+    /// Static Private Helper Methods \\\
+
+    // Enable the lock-memory privilege large page allocations need (once per process).  Returns false if it isn't held.
+    bool NumaHelper::EnableLargePages( ) noexcept
+    {
+        static std::once_flag s_EnableOnce;
+        static bool s_bEnabled = false;
+
+        std::call_once(s_EnableOnce, [ ] ( )
+        {
+            HANDLE hToken = nullptr;
+            TOKEN_PRIVILEGES privileges { };
+
+            if ( ::GetLargePageMinimum( ) == 0 || ::OpenProcessToken(::GetCurrentProcess( ), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &hToken) == FALSE )
+            {
+                return;
+            }
+
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+            // AdjustTokenPrivileges "succeeds" without enabling anything if the privilege isn't held - check for that too.
+            if ( ::LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) != FALSE
+                && ::AdjustTokenPrivileges(hToken, FALSE, &privileges, 0, nullptr, nullptr) != FALSE )
+            {
+                s_bEnabled = ::GetLastError( ) == ERROR_SUCCESS;
+            }
+
+            ::CloseHandle(hToken);
+        });
+
+        return s_bEnabled;
+    }
+
+    // Touch every page of a fresh allocation, then lock it into memory (best effort).
+    // - Note: Locking can fail once the process's minimum working set is used up - the pages are still resident, just pageable.
+    void NumaHelper::Prefault(void* p, const size_t bytes) noexcept
+    {
+        SYSTEM_INFO info;
+        volatile uint8_t* pBytes = static_cast<volatile uint8_t*>(p);
+
+        ::GetSystemInfo(&info);
+
+        for ( size_t offset = 0; offset < bytes; offset += info.dwPageSize )
+        {
+            pBytes[offset] = 0;
+        }
+
+        ::VirtualLock(p, bytes);
+    }
+
+    /// Static Public Methods \\\
+
+    // Returns number of NUMA nodes in the system (1 if it isn't NUMA, or the count isn't available).
+    size_t NumaHelper::GetNodeCount( ) noexcept
+    {
+        ULONG highestNode = 0;
+
+        if ( ::GetNumaHighestNodeNumber(&highestNode) == FALSE )
+        {
+            return 1;
+        }
+
+        return static_cast<size_t>(highestNode) + 1;
+    }
+
+    // Returns NUMA node of the processor the calling thread is running on (0 if it isn't available).
+    size_t NumaHelper::GetCurrentNode( ) noexcept
+    {
+        PROCESSOR_NUMBER processor;
+        USHORT node = 0;
+
+        ::GetCurrentProcessorNumberEx(&processor);
+
+        if ( ::GetNumaProcessorNodeEx(&processor, &node) == FALSE || node == MAXUSHORT )
+        {
+            return 0;
+        }
+
+        return node;
+    }
+
+    // Returns mask of the processors on a NUMA node (bit N == CPU N, first processor group only).  Returns 0 on failure.
+    uint64_t NumaHelper::GetNodeAffinity(const size_t node) noexcept
+    {
+        GROUP_AFFINITY affinity { };
+
+        if ( ::GetNumaNodeProcessorMaskEx(static_cast<USHORT>(node), &affinity) == FALSE || affinity.Group != 0 )
+        {
+            return 0;
+        }
+
+        return static_cast<uint64_t>(affinity.Mask);
+    }
+
+    // Allocate memory as described by placement (e.g., from a NUMA node's local memory).  Throws std::bad_alloc on failure.
+    void* NumaHelper::Allocate(const size_t bytes, const Placement& placement)
+    {
+        if ( placement == Placement( ) )
+        {
+            return ::operator new(bytes);
+        }
+
+        const DWORD node = (placement.node == AnyNode) ? NUMA_NO_PREFERRED_NODE : static_cast<DWORD>(placement.node);
+        void* p = nullptr;
+
+        // Large pages are always resident and locked - they don't need prefaulting.
+        // - Note: The allocation size must be a multiple of the large page size.
+        if ( placement.bLargePages && EnableLargePages( ) )
+        {
+            const size_t largePage = ::GetLargePageMinimum( );
+            const size_t largeBytes = ((bytes + largePage - 1) / largePage) * largePage;
+
+            p = ::VirtualAllocExNuma(::GetCurrentProcess( ), nullptr, largeBytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, node);
+            if ( p )
+            {
+                return p;
+            }
+        }
+
+        // No large pages (not allowed, or none contiguous enough left) - fall back to normal pages.
+        p = ::VirtualAllocExNuma(::GetCurrentProcess( ), nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+        if ( !p )
+        {
+            throw std::bad_alloc( );
+        }
+
+        if ( placement.bPrefault )
+        {
+            Prefault(p, bytes);
+        }
+
+        return p;
+    }
+
+    // Free memory obtained from Allocate (with the same placement).
+    // - Note: Releasing the pages also unlocks them.
+    void NumaHelper::Free(void* p, const Placement& placement) noexcept
+    {
+        if ( !p )
+        {
+            return;
+        }
+
+        if ( placement == Placement( ) )
+        {
+            ::operator delete(p);
+        }
+        else
+        {
+            ::VirtualFree(p, 0, MEM_RELEASE);
+        }
+    }
+}
\ No newline at end of file
@@ -92,7 +92,9 @@ namespace SLL
             MAKE_STR_TUPLE("LogAsynchronous"),
             MAKE_STR_TUPLE("LogTimestamp"),
             MAKE_STR_TUPLE("LogThreadID"),
-            MAKE_STR_TUPLE("LogVerbosityLevel")
+            MAKE_STR_TUPLE("LogVerbosityLevel"),
+            MAKE_STR_TUPLE("LogSequenceNumber"),
+            MAKE_STR_TUPLE("LogDeferredFormat")
         };
 
         if ( i >= optionFlagStrings.size( ) )
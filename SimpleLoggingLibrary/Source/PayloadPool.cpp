@@ -0,0 +1,274 @@
+// Class Header
+#include <PayloadPool.h>
+
+// STL
+#include <stdexcept>
+#include <string>
+
+namespace SLL
+{
+    /// Slab - Constructor \\\
+
+    PayloadPool::Slab::Slab(const size_t bufferLength, const uint32_t bufferCount, const NumaHelper::Placement& placement) :
+        mBufferLength(bufferLength),
+        mBufferCount(bufferCount),
+        mPlacement(placement),
+        mpMemory(nullptr),
+        mpNext(std::make_unique<std::atomic<uint32_t>[ ]>(bufferCount)),
+        mFreeHead(0),
+        mUnused(0)
+    { }
+
+    /// Slab - Destructor \\\
+
+    PayloadPool::Slab::~Slab( )
+    {
+        NumaHelper::Free(mpMemory.load( ), mPlacement);
+    }
+
+    /// Slab - Public Methods \\\
+
+    // Returns slab memory, allocating it if this is the first use.
+    utf16* PayloadPool::Slab::GetMemory( )
+    {
+        utf16* pMemory = mpMemory.load(std::memory_order_acquire);
+
+        if ( !pMemory )
+        {
+            utf16* pFresh = static_cast<utf16*>(NumaHelper::Allocate(mBufferLength * mBufferCount * sizeof(utf16), mPlacement));
+
+            // Another thread may have beaten us to it - if so, use theirs and discard ours.
+            if ( mpMemory.compare_exchange_strong(pMemory, pFresh, std::memory_order_acq_rel, std::memory_order_acquire) )
+            {
+                pMemory = pFresh;
+            }
+            else
+            {
+                NumaHelper::Free(pFresh, mPlacement);
+            }
+        }
+
+        return pMemory;
+    }
+
+    // Returns length, in characters, of each buffer in this slab.
+    size_t PayloadPool::Slab::GetBufferLength( ) const noexcept
+    {
+        return mBufferLength;
+    }
+
+    // Pop a free buffer, or carve out a never-used one.  Returns nullptr if the slab is exhausted.
+    utf16* PayloadPool::Slab::TryAcquire(uint32_t& slot)
+    {
+        uint64_t head = mFreeHead.load(std::memory_order_acquire);
+
+        // Try the free-list first - recycled buffers are likely still warm in cache.
+        while ( (head & 0xFFFFFFFF) != 0 )
+        {
+            const uint32_t idx = static_cast<uint32_t>(head & 0xFFFFFFFF) - 1;
+            const uint64_t next = mpNext[idx].load(std::memory_order_relaxed);
+            const uint64_t newHead = (((head >> 32) + 1) << 32) | next;
+
+            if ( mFreeHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_acquire) )
+            {
+                slot = idx;
+                return GetMemory( ) + (mBufferLength * slot);
+            }
+        }
+
+        // Free-list is empty - carve out a slot that has never been handed out.
+        uint32_t unused = mUnused.load(std::memory_order_relaxed);
+        while ( unused < mBufferCount )
+        {
+            // - Note: Acquire pairs with Trim resetting the slab, so we see its memory pointer cleared.
+            if ( mUnused.compare_exchange_weak(unused, unused + 1, std::memory_order_acquire, std::memory_order_relaxed) )
+            {
+                slot = unused;
+                return GetMemory( ) + (mBufferLength * slot);
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Push buffer back onto the free-list.
+    void PayloadPool::Slab::Release(const uint32_t slot) noexcept
+    {
+        uint64_t head = mFreeHead.load(std::memory_order_relaxed);
+        uint64_t newHead = 0;
+
+        do
+        {
+            mpNext[slot].store(static_cast<uint32_t>(head & 0xFFFFFFFF), std::memory_order_relaxed);
+            newHead = (((head >> 32) + 1) << 32) | (static_cast<uint64_t>(slot) + 1);
+        } while ( !mFreeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed) );
+    }
+
+    // Free the slab's memory if none of its buffers are in use.  Returns number of bytes freed.
+    // - Note: Takes every never-used slot and the whole free-list first, so nothing can be handed out while we count.
+    //         If they don't add up to every buffer, something's in use - they're all put back.
+    size_t PayloadPool::Slab::Trim( ) noexcept
+    {
+        utf16* pMemory = mpMemory.load(std::memory_order_acquire);
+
+        if ( !pMemory )
+        {
+            return 0;
+        }
+
+        const uint32_t unused = mUnused.exchange(mBufferCount, std::memory_order_acq_rel);
+        uint64_t head = mFreeHead.load(std::memory_order_acquire);
+
+        while ( !mFreeHead.compare_exchange_weak(head, ((head >> 32) + 1) << 32, std::memory_order_acq_rel, std::memory_order_acquire) )
+        {
+            // Retry - a buffer was acquired or released in the meantime.
+        }
+
+        // Count the free buffers we took (the links can't change while they're ours).
+        uint32_t freeCount = 0;
+        uint32_t tail = 0;
+
+        for ( uint32_t link = static_cast<uint32_t>(head & 0xFFFFFFFF); link != 0; link = mpNext[link - 1].load(std::memory_order_relaxed) )
+        {
+            freeCount++;
+            tail = link;
+        }
+
+        // Every buffer that was ever handed out is back - start over as if new.
+        if ( freeCount == unused )
+        {
+            mpMemory.store(nullptr, std::memory_order_relaxed);
+            NumaHelper::Free(pMemory, mPlacement);
+            mUnused.store(0, std::memory_order_release);
+
+            return mBufferLength * mBufferCount * sizeof(utf16);
+        }
+
+        // Something's in use - put the free-list back in front of anything released since, then reopen the never-used slots.
+        if ( tail != 0 )
+        {
+            uint64_t current = mFreeHead.load(std::memory_order_relaxed);
+            uint64_t newHead = 0;
+
+            do
+            {
+                mpNext[tail - 1].store(static_cast<uint32_t>(current & 0xFFFFFFFF), std::memory_order_relaxed);
+                newHead = (((current >> 32) + 1) << 32) | (head & 0xFFFFFFFF);
+            } while ( !mFreeHead.compare_exchange_weak(current, newHead, std::memory_order_release, std::memory_order_relaxed) );
+        }
+
+        mUnused.store(unused, std::memory_order_release);
+
+        return 0;
+    }
+
+    /// Private Helper Methods \\\
+
+    // Returns size class for a buffer of the specified length, or HeapSizeClass if too large.
+    uint32_t PayloadPool::GetSizeClass(const size_t len) noexcept
+    {
+        const size_t bytes = len * sizeof(utf16);
+        size_t classBytes = MinBufferBytes;
+
+        for ( uint32_t sizeClass = 0; sizeClass < SizeClassCount; sizeClass++, classBytes <<= 1 )
+        {
+            if ( bytes <= classBytes )
+            {
+                return sizeClass;
+            }
+        }
+
+        return HeapSizeClass;
+    }
+
+    /// Constructor \\\
+
+    // Place slab memory as described by placement (the default placement selects the heap).
+    PayloadPool::PayloadPool(const NumaHelper::Placement& placement)
+    {
+        NumaHelper::Placement slabPlacement = placement;
+        size_t classBytes = MinBufferBytes;
+
+        slabPlacement.bLargePages = false;
+
+        for ( auto& pSlab : mSlabs )
+        {
+            pSlab = std::make_unique<Slab>(classBytes / sizeof(utf16), static_cast<uint32_t>(SlabBytes / classBytes), slabPlacement);
+            classBytes <<= 1;
+
+            // Fault the whole slab in now, rather than on the first message that needs it.
+            if ( slabPlacement.bPrefault )
+            {
+                pSlab->GetMemory( );
+            }
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Obtain buffer that holds at least len characters.
+    PayloadPool::Buffer PayloadPool::Acquire(const size_t len)
+    {
+        Buffer buf;
+
+        if ( len == 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid buffer length (" + std::to_string(len) + ").");
+        }
+
+        buf.mSizeClass = GetSizeClass(len);
+
+        if ( buf.mSizeClass != HeapSizeClass )
+        {
+            Slab& slab = *mSlabs[buf.mSizeClass];
+
+            buf.mpData = slab.TryAcquire(buf.mSlot);
+            if ( buf.mpData )
+            {
+                buf.mLength = slab.GetBufferLength( );
+                return buf;
+            }
+        }
+
+        // Too large for any size class, or the class is exhausted - fall back to the heap.
+        buf.mpData = new utf16[len];
+        buf.mLength = len;
+        buf.mSizeClass = HeapSizeClass;
+
+        return buf;
+    }
+
+    // Return buffer to the pool (or to the heap).
+    void PayloadPool::Release(Buffer& buf) noexcept
+    {
+        if ( !buf.mpData )
+        {
+            return;
+        }
+
+        if ( buf.mSizeClass == HeapSizeClass )
+        {
+            delete[ ] buf.mpData;
+        }
+        else
+        {
+            mSlabs[buf.mSizeClass]->Release(buf.mSlot);
+        }
+
+        buf.mpData = nullptr;
+        buf.mLength = 0;
+    }
+
+    // Free the memory of every slab with no buffers in use.
+    size_t PayloadPool::Trim( ) noexcept
+    {
+        size_t freed = 0;
+
+        for ( const std::unique_ptr<Slab>& pSlab : mSlabs )
+        {
+            freed += pSlab->Trim( );
+        }
+
+        return freed;
+    }
+}
\ No newline at end of file
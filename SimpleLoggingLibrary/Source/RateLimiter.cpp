@@ -0,0 +1,227 @@
+// Class Header
+#include <RateLimiter.h>
+
+// STL
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace SLL
+{
+    // Returns capacity rounded up to a power of two - throws if it's zero, or too large to round up.
+    static size_t RoundUpCapacity(const size_t capacity)
+    {
+        size_t rounded = 1;
+
+        if ( capacity == 0 || capacity > (SIZE_MAX >> 1) + 1 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid site capacity (" + std::to_string(capacity) + ").");
+        }
+
+        while ( rounded < capacity )
+        {
+            rounded <<= 1;
+        }
+
+        return rounded;
+    }
+
+    /// Private Helper Methods \\\
+
+    // Returns site's slot, claiming one if it's new (null if there's no room for it).
+    // - Note: Slots are never given up once claimed, so a site's slot can't change under a racing thread.
+    RateLimiter::Site* RateLimiter::FindSite(const void* pSite) noexcept
+    {
+        // Fibonacci hashing - format strings are often laid out side by side, so their addresses need spreading out.
+        const size_t hash = static_cast<size_t>((reinterpret_cast<uintptr_t>(pSite) >> 3) * 0x9E3779B97F4A7C15ull >> 32);
+        const size_t probes = std::min(MaxProbes, mSiteMask + 1);
+
+        for ( size_t i = 0; i < probes; i++ )
+        {
+            Site& site = mpSites[(hash + i) & mSiteMask];
+            const void* key = site.key.load(std::memory_order_acquire);
+
+            if ( key == nullptr && site.key.compare_exchange_strong(key, pSite, std::memory_order_acq_rel) )
+            {
+                mSiteCount.fetch_add(1, std::memory_order_relaxed);
+                return &site;
+            }
+
+            // Ours, whether it was already, or another thread claimed it for the same site first.
+            if ( key == pSite )
+            {
+                return &site;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// Constructor \\\
+
+    // Tracks up to siteCapacity call sites (rounded up to a power of two) - must be non-zero (and small enough to round up).
+    RateLimiter::RateLimiter(const size_t siteCapacity) :
+        mSiteMask(RoundUpCapacity(siteCapacity) - 1),
+        mpSites(new Site[mSiteMask + 1]( )),
+        mSampleFirst(0),
+        mSampleEvery(1),
+        mTokenInterval(0),
+        mTokenBurst(0),
+        mExemptThreshold(VerbosityLevel::ERROR),
+        mSiteCount(0),
+        mSampledCount(0),
+        mThrottledCount(0),
+        mUntrackedCount(0)
+    { }
+
+    /// Public Methods \\\
+
+    // Returns whether a message from call site pSite should be logged - false if it's been sampled out or throttled.
+    bool RateLimiter::Allow(const void* pSite, const VerbosityLevel& lvl) noexcept
+    {
+        if ( !pSite || lvl >= mExemptThreshold.load(std::memory_order_relaxed) )
+        {
+            return true;
+        }
+
+        const uint64_t every = mSampleEvery.load(std::memory_order_relaxed);
+        const int64_t interval = mTokenInterval.load(std::memory_order_relaxed);
+
+        // Nothing to limit.
+        if ( every <= 1 && interval == 0 )
+        {
+            return true;
+        }
+
+        Site* pState = FindSite(pSite);
+
+        if ( !pState )
+        {
+            mUntrackedCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Sampling - the first N, then 1 in M.
+        if ( every > 1 )
+        {
+            const uint64_t first = mSampleFirst.load(std::memory_order_relaxed);
+            const uint64_t n = pState->count.fetch_add(1, std::memory_order_relaxed);
+
+            if ( n >= first && (n - first) % every != 0 )
+            {
+                mSampledCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        // Token bucket - each message pushes the site's arrival time on by one interval, and the site is throttled
+        // while that's more than a full burst ahead of now.
+        if ( interval != 0 )
+        {
+            const int64_t now = std::chrono::steady_clock::now( ).time_since_epoch( ).count( );
+            // Limits are read one at a time, so a racing SetTokenBucket may pair the new interval with the old burst.
+            const int64_t burst = std::max<int64_t>(1, mTokenBurst.load(std::memory_order_relaxed));
+            const int64_t tolerance = (interval > INT64_MAX / burst) ? INT64_MAX : interval * burst;
+            int64_t tat = pState->tat.load(std::memory_order_relaxed);
+
+            while ( true )
+            {
+                const int64_t next = std::max(tat, now) + interval;
+
+                if ( next - now > tolerance )
+                {
+                    mThrottledCount.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                if ( pState->tat.compare_exchange_weak(tat, next, std::memory_order_relaxed) )
+                {
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Sets sampling - each site's first N messages are logged, then 1 in every M (M of 1 disables sampling).
+    void RateLimiter::SetSampling(const uint64_t first, const uint64_t every)
+    {
+        if ( every == 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid sampling rate (1 in 0).");
+        }
+
+        mSampleFirst.store(first, std::memory_order_relaxed);
+        mSampleEvery.store(every, std::memory_order_relaxed);
+    }
+
+    // Sets each site's token bucket - up to burst messages at once, refilled at messagesPerSecond (0 disables it).
+    void RateLimiter::SetTokenBucket(const double messagesPerSecond, const uint64_t burst)
+    {
+        if ( !(messagesPerSecond >= 0.0) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid token rate (" + std::to_string(messagesPerSecond) + " per second).");
+        }
+
+        if ( messagesPerSecond > 0.0 && burst == 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid token burst (0).");
+        }
+
+        // At least one tick per token, so a huge rate still means a bucket (just one that's never empty).
+        const double ticks = (messagesPerSecond > 0.0) ? std::chrono::steady_clock::period::den / (messagesPerSecond * std::chrono::steady_clock::period::num) : 0.0;
+        const int64_t interval = (messagesPerSecond > 0.0) ? std::max<int64_t>(1, static_cast<int64_t>(std::min(ticks, 1e18))) : 0;
+
+        mTokenBurst.store(static_cast<int64_t>(std::min<uint64_t>(burst, INT64_MAX)), std::memory_order_relaxed);
+        mTokenInterval.store(interval, std::memory_order_relaxed);
+    }
+
+    // Sets level at and above which messages are never limited (VerbosityLevel::MAX exempts nothing).
+    void RateLimiter::SetExemptThreshold(const VerbosityLevel lvl)
+    {
+        if ( lvl < VerbosityLevel::BEGIN || lvl > VerbosityLevel::MAX )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid exempt threshold (" + std::to_string(static_cast<VerbosityLevelType>(lvl)) + ").");
+        }
+
+        mExemptThreshold.store(lvl, std::memory_order_relaxed);
+    }
+
+    // Start every site over - sample counts from zero, and full token buckets.
+    // - Note: Sites stay claimed - only their counts are cleared.
+    void RateLimiter::Reset( ) noexcept
+    {
+        for ( size_t i = 0; i <= mSiteMask; i++ )
+        {
+            mpSites[i].count.store(0, std::memory_order_relaxed);
+            mpSites[i].tat.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns number of call sites tracked so far.
+    size_t RateLimiter::GetSiteCount( ) const noexcept
+    {
+        return mSiteCount.load(std::memory_order_relaxed);
+    }
+
+    // Returns number of messages sampled out.
+    uint64_t RateLimiter::GetSampledCount( ) const noexcept
+    {
+        return mSampledCount.load(std::memory_order_relaxed);
+    }
+
+    // Returns number of messages turned away by a token bucket.
+    uint64_t RateLimiter::GetThrottledCount( ) const noexcept
+    {
+        return mThrottledCount.load(std::memory_order_relaxed);
+    }
+
+    // Returns number of messages that weren't limited because their site didn't fit in the table.
+    uint64_t RateLimiter::GetUntrackedCount( ) const noexcept
+    {
+        return mUntrackedCount.load(std::memory_order_relaxed);
+    }
+}
\ No newline at end of file
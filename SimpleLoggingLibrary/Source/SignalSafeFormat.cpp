@@ -0,0 +1,265 @@
+// Class Header
+#include <SignalSafeFormat.h>
+
+// STL
+#include <cstdint>
+#include <type_traits>
+
+namespace SLL
+{
+    /// Non-Member Helpers \\\
+
+    namespace
+    {
+        // Length modifiers we accept.
+        enum class LengthModifier { None, hh, h, l, ll, j, z, t };
+
+        // Bounded output cursor - drops anything that doesn't fit, leaving room for the null-terminator.
+        struct Output
+        {
+            utf16* pBuf;
+            size_t bufLen;
+            size_t len;
+
+            void Put(const utf16 c) noexcept
+            {
+                if ( len + 1 < bufLen )
+                {
+                    pBuf[len++] = c;
+                }
+            }
+        };
+
+        template <class T>
+        utf16 Widen(const T c) noexcept
+        {
+            return static_cast<utf16>(static_cast<std::make_unsigned_t<T>>(c));
+        }
+
+        void PutUnsigned(Output& out, unsigned long long val, const unsigned base, const bool bUpper, const size_t minDigits = 1) noexcept
+        {
+            static const char* lowerDigits = "0123456789abcdef";
+            static const char* upperDigits = "0123456789ABCDEF";
+
+            const char* digits = (bUpper) ? upperDigits : lowerDigits;
+            char tmp[64];
+            size_t n = 0;
+
+            do
+            {
+                tmp[n++] = digits[val % base];
+                val /= base;
+            } while ( val != 0 && n < sizeof(tmp) );
+
+            while ( n < minDigits && n < sizeof(tmp) )
+            {
+                tmp[n++] = '0';
+            }
+
+            while ( n != 0 )
+            {
+                out.Put(static_cast<utf16>(tmp[--n]));
+            }
+        }
+
+        void PutSigned(Output& out, const long long val) noexcept
+        {
+            if ( val < 0 )
+            {
+                out.Put(static_cast<utf16>('-'));
+                PutUnsigned(out, 0ULL - static_cast<unsigned long long>(val), 10, false);
+            }
+            else
+            {
+                PutUnsigned(out, static_cast<unsigned long long>(val), 10, false);
+            }
+        }
+
+        long long ReadSigned(const LengthModifier lm, va_list& pArgs) noexcept
+        {
+            switch ( lm )
+            {
+            case LengthModifier::hh:
+                return static_cast<signed char>(va_arg(pArgs, int));
+            case LengthModifier::h:
+                return static_cast<short>(va_arg(pArgs, int));
+            case LengthModifier::l:
+                return va_arg(pArgs, long);
+            case LengthModifier::ll:
+                return va_arg(pArgs, long long);
+            case LengthModifier::j:
+                return va_arg(pArgs, intmax_t);
+            case LengthModifier::z:
+                return va_arg(pArgs, std::make_signed_t<size_t>);
+            case LengthModifier::t:
+                return va_arg(pArgs, ptrdiff_t);
+            default:
+                return va_arg(pArgs, int);
+            }
+        }
+
+        unsigned long long ReadUnsigned(const LengthModifier lm, va_list& pArgs) noexcept
+        {
+            switch ( lm )
+            {
+            case LengthModifier::hh:
+                return static_cast<unsigned char>(va_arg(pArgs, unsigned int));
+            case LengthModifier::h:
+                return static_cast<unsigned short>(va_arg(pArgs, unsigned int));
+            case LengthModifier::l:
+                return va_arg(pArgs, unsigned long);
+            case LengthModifier::ll:
+                return va_arg(pArgs, unsigned long long);
+            case LengthModifier::j:
+                return va_arg(pArgs, uintmax_t);
+            case LengthModifier::z:
+                return va_arg(pArgs, size_t);
+            case LengthModifier::t:
+                return static_cast<std::make_unsigned_t<ptrdiff_t>>(va_arg(pArgs, ptrdiff_t));
+            default:
+                return va_arg(pArgs, unsigned int);
+            }
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Format into pBuf (always null-terminated if bufLen != 0).  Returns number of characters written, excluding the null-terminator.
+    template <class T>
+    size_t SignalSafeFormat::Format(utf16* pBuf, const size_t bufLen, const T* pFormat, va_list pArgs) noexcept
+    {
+        static const T nullString[ ] = { T('('), T('n'), T('u'), T('l'), T('l'), T(')'), T('\0') };
+
+        Output out { pBuf, bufLen, 0 };
+        va_list args;
+
+        if ( !pBuf || bufLen == 0 )
+        {
+            return 0;
+        }
+
+        if ( !pFormat )
+        {
+            pBuf[0] = static_cast<utf16>('\0');
+            return 0;
+        }
+
+        va_copy(args, pArgs);
+
+        for ( const T* p = pFormat; *p != T('\0'); p++ )
+        {
+            if ( *p != T('%') )
+            {
+                out.Put(Widen(*p));
+                continue;
+            }
+
+            const T* pSpec = p++;
+            LengthModifier lm = LengthModifier::None;
+
+            if ( *p == T('%') )
+            {
+                out.Put(static_cast<utf16>('%'));
+                continue;
+            }
+
+            // Length modifier
+            if ( *p == T('h') )
+            {
+                lm = LengthModifier::h;
+                if ( *++p == T('h') )
+                {
+                    lm = LengthModifier::hh;
+                    p++;
+                }
+            }
+            else if ( *p == T('l') )
+            {
+                lm = LengthModifier::l;
+                if ( *++p == T('l') )
+                {
+                    lm = LengthModifier::ll;
+                    p++;
+                }
+            }
+            else if ( *p == T('j') )
+            {
+                lm = LengthModifier::j;
+                p++;
+            }
+            else if ( *p == T('z') )
+            {
+                lm = LengthModifier::z;
+                p++;
+            }
+            else if ( *p == T('t') )
+            {
+                lm = LengthModifier::t;
+                p++;
+            }
+
+            switch ( *p )
+            {
+            case T('d'):
+            case T('i'):
+                PutSigned(out, ReadSigned(lm, args));
+                break;
+
+            case T('u'):
+                PutUnsigned(out, ReadUnsigned(lm, args), 10, false);
+                break;
+
+            case T('x'):
+            case T('X'):
+                PutUnsigned(out, ReadUnsigned(lm, args), 16, *p == T('X'));
+                break;
+
+            case T('o'):
+                PutUnsigned(out, ReadUnsigned(lm, args), 8, false);
+                break;
+
+            case T('c'):
+                out.Put(static_cast<utf16>(va_arg(args, int)));
+                break;
+
+            case T('s'):
+            {
+                const T* pStr = va_arg(args, const T*);
+
+                for ( const T* s = (pStr) ? pStr : nullString; *s != T('\0'); s++ )
+                {
+                    out.Put(Widen(*s));
+                }
+
+                break;
+            }
+
+            case T('p'):
+                // Same shape as the CRT's %p - zero-padded, upper-case hex.
+                PutUnsigned(out, reinterpret_cast<uintptr_t>(va_arg(args, void*)), 16, true, sizeof(void*) * 2);
+                break;
+
+            default:
+                // Unsupported (or the format ended mid-specification) - copy the rest of the format as-is.
+                for ( const T* s = pSpec; *s != T('\0'); s++ )
+                {
+                    out.Put(Widen(*s));
+                }
+
+                va_end(args);
+                pBuf[out.len] = static_cast<utf16>('\0');
+                return out.len;
+            }
+        }
+
+        va_end(args);
+        pBuf[out.len] = static_cast<utf16>('\0');
+
+        return out.len;
+    }
+
+    /// Explicit Template Instantiation \\\
+
+    template size_t SignalSafeFormat::Format<utf8>(utf16*, const size_t, const utf8*, va_list) noexcept;
+    template size_t SignalSafeFormat::Format<utf16>(utf16*, const size_t, const utf16*, va_list) noexcept;
+}
\ No newline at end of file
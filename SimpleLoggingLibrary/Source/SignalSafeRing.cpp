@@ -0,0 +1,108 @@
+// Class Header
+#include <SignalSafeRing.h>
+
+// STL
+#include <stdexcept>
+#include <string>
+
+namespace SLL
+{
+    /// Private Helper Methods \\\
+
+    // Returns capacity rounded up to a power of two (at least two slots).
+    // - Note: With a single slot the mask is zero, so a producer a full lap ahead would claim the unread slot.
+    size_t SignalSafeRing::RoundUpCapacity(const size_t capacity)
+    {
+        size_t slotCount = 2;
+
+        if ( capacity == 0 || capacity > (SIZE_MAX >> 1) + 1 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid capacity (" + std::to_string(capacity) + ").");
+        }
+
+        while ( slotCount < capacity )
+        {
+            slotCount <<= 1;
+        }
+
+        return slotCount;
+    }
+
+    /// Constructor \\\
+
+    // Capacity is rounded up to a power of two (at least two).
+    SignalSafeRing::SignalSafeRing(const size_t capacity) :
+        mMask(RoundUpCapacity(capacity) - 1),
+        mpSlots(std::make_unique<Slot[ ]>(mMask + 1)),
+        mClaimPos(0),
+        mConsumePos(0)
+    {
+        // Slot i is free for the producer that claims position i.
+        for ( size_t i = 0; i <= mMask; i++ )
+        {
+            mpSlots[i].turn.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Returns number of entries the ring can hold.
+    size_t SignalSafeRing::GetCapacity( ) const noexcept
+    {
+        return mMask + 1;
+    }
+
+    // Producer - claim an entry to fill, or nullptr if the ring is full.  Publish(ticket) once it's filled.
+    SignalSafeRing::Entry* SignalSafeRing::TryClaim(uint64_t& ticket) noexcept
+    {
+        uint64_t pos = mClaimPos.load(std::memory_order_relaxed);
+
+        for ( ;; )
+        {
+            Slot& slot = mpSlots[pos & mMask];
+            const uint64_t turn = slot.turn.load(std::memory_order_acquire);
+
+            if ( turn == pos )
+            {
+                // Slot is free for this position - try to take it.
+                if ( mClaimPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed) )
+                {
+                    ticket = pos;
+                    return &slot.entry;
+                }
+            }
+            else if ( turn < pos )
+            {
+                // Slot still holds an entry from the previous lap - ring is full.
+                return nullptr;
+            }
+            else
+            {
+                // Another producer took this position - try the next one.
+                pos = mClaimPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Producer - hand a claimed entry to the consumer.
+    void SignalSafeRing::Publish(const uint64_t ticket) noexcept
+    {
+        mpSlots[ticket & mMask].turn.store(ticket + 1, std::memory_order_release);
+    }
+
+    // Consumer - returns the oldest published entry, or nullptr if there isn't one.  Pop( ) once done with it.
+    const SignalSafeRing::Entry* SignalSafeRing::Front( ) noexcept
+    {
+        Slot& slot = mpSlots[mConsumePos & mMask];
+
+        return (slot.turn.load(std::memory_order_acquire) == mConsumePos + 1) ? &slot.entry : nullptr;
+    }
+
+    // Consumer - release the entry returned by Front( ) back to the producers.
+    void SignalSafeRing::Pop( ) noexcept
+    {
+        // Free the slot for the producer one lap ahead.
+        mpSlots[mConsumePos & mMask].turn.store(mConsumePos + GetCapacity( ), std::memory_order_release);
+        mConsumePos++;
+    }
+}
\ No newline at end of file
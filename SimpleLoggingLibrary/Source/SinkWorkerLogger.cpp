@@ -0,0 +1,755 @@
+// Class Header
+#include <SinkWorkerLogger.h>
+
+// CC StringUtil - UTF Conversions
+#include <CCStringUtil.h>
+
+// STL
+#include <iterator>
+#include <stdexcept>
+
+namespace SLL
+{
+    using ReturnType = CC::StringUtil::ReturnType;
+
+    /// Private Helper Methods \\\
+
+    // Delivery queue worker - writes and flushes the sink's queued records until stopped.
+    void SinkWorkerLogger::SinkWorkerLoop(const std::shared_ptr<Sink>& pSink)
+    {
+        Sink& sink = *pSink;
+        std::deque<QueuedRecord> batch;
+        std::vector<FlushBarrier> done;
+        std::unique_lock<std::mutex> lock(sink.mutex);
+
+        while ( true )
+        {
+            sink.workCV.wait(lock, [&sink] ( ) -> bool
+            {
+                return !sink.queue.empty( ) || sink.bFlushWanted || sink.bStop;
+            });
+
+            if ( sink.queue.empty( ) && !sink.bFlushWanted )
+            {
+                // Stopped, and nothing left to write.
+                break;
+            }
+
+            // Claim the sink for this pass - once the crash hook has it, we leave the sink and its queue alone.
+            std::thread::id none;
+            if ( !sink.writer.compare_exchange_strong(none, std::this_thread::get_id( )) )
+            {
+                break;
+            }
+
+            // Take everything queued so far - this pass's flush also answers any flush request made before now.
+            batch.swap(sink.queue);
+            sink.bFlushWanted = false;
+            sink.queueDepth = 0;
+
+            const uint64_t target = sink.submitted;
+
+            // Make room for writers waiting on a full queue.
+            sink.doneCV.notify_all( );
+
+            // Write and flush without the lock, so the caller never waits on the sink itself.
+            lock.unlock( );
+
+            for ( const QueuedRecord& record : batch )
+            {
+                try
+                {
+                    sink.pLogger->WriteRecord(LogRecord { record.lvl, record.tid, record.time, record.message, record.seq });
+                }
+                catch ( const std::exception& )
+                {
+                    // Best effort - the sink counts its own failures.
+                }
+            }
+
+            batch.clear( );
+
+            bool bFlushed = false;
+
+            try
+            {
+                bFlushed = sink.pLogger->Flush( );
+            }
+            catch ( const std::exception& )
+            {
+                // Best effort - reported to whoever is waiting on the flush.
+            }
+
+            lock.lock( );
+
+            sink.flushedThrough = target;
+            sink.flushPasses++;
+            sink.bFlushOk = bFlushed;
+            sink.writer = std::thread::id( );
+            sink.doneCV.notify_all( );
+
+            // Barriers are added in submission order, so those this pass answers are at the front.
+            auto it = sink.barriers.begin( );
+            while ( it != sink.barriers.end( ) && it->passes != sink.flushPasses && it->target <= sink.flushedThrough )
+            {
+                ++it;
+            }
+
+            if ( it != sink.barriers.begin( ) )
+            {
+                std::move(sink.barriers.begin( ), it, std::back_inserter(done));
+                sink.barriers.erase(sink.barriers.begin( ), it);
+
+                // Complete outside the lock - a callback is free to log again.
+                lock.unlock( );
+
+                for ( FlushBarrier& barrier : done )
+                {
+                    CompleteFlush(*barrier.pFlush, bFlushed);
+                }
+
+                done.clear( );
+                lock.lock( );
+            }
+        }
+
+        sink.bExited = true;
+        sink.doneCV.notify_all( );
+    }
+
+    // Queue a copy of the record for a queued sink.  Returns false if it was dropped.
+    bool SinkWorkerLogger::QueueRecord(Sink& sink, const LogRecord& record) const
+    {
+        std::unique_lock<std::mutex> lock(sink.mutex);
+
+        // Backpressure - wait for the worker to take the queue.
+        if ( sink.queue.size( ) >= sink.queueCapacity && sink.bBlockWhenFull && !sink.bStop && !mNoBlock )
+        {
+            sink.doneCV.wait(lock, [this, &sink] ( ) -> bool
+            {
+                return sink.queue.size( ) < sink.queueCapacity || sink.bStop || mNoBlock;
+            });
+        }
+
+        // Dropped if the queue is still full, or we're stopping (the worker may already be gone).
+        if ( sink.bStop || sink.queue.size( ) >= sink.queueCapacity )
+        {
+            sink.dropped++;
+            mStats.Add(StatCounters::Counter::Dropped);
+            return false;
+        }
+
+        sink.queue.push_back(QueuedRecord { record.lvl, record.tid, record.time, record.seq, std::basic_string<utf16>(record.message) });
+        sink.submitted++;
+
+        const size_t depth = sink.queue.size( );
+        sink.queueDepth = depth;
+
+        if ( depth > sink.queueHighWatermark )
+        {
+            sink.queueHighWatermark = depth;
+        }
+
+        // Only wake the worker for the first record - it takes everything queued once it's up.
+        if ( depth == 1 )
+        {
+            sink.workCV.notify_one( );
+        }
+
+        return true;
+    }
+
+    // Wait until everything queued for the sink so far is written and flushed.  Returns the flush result.
+    bool SinkWorkerLogger::FlushQueuedSink(Sink& sink) const
+    {
+        std::unique_lock<std::mutex> lock(sink.mutex);
+
+        const uint64_t target = sink.submitted;
+        const uint64_t passes = sink.flushPasses;
+
+        // Ask for a pass even with nothing queued, so the sink's own buffer is flushed too.
+        sink.bFlushWanted = true;
+        sink.workCV.notify_one( );
+
+        sink.doneCV.wait(lock, [&sink, target, passes] ( ) -> bool
+        {
+            return (sink.flushPasses != passes && sink.flushedThrough >= target) || sink.bExited;
+        });
+
+        // The worker is gone (e.g., the crash hook took the sink over) - nobody is left to flush it.
+        if ( sink.flushPasses == passes || sink.flushedThrough < target )
+        {
+            return false;
+        }
+
+        return sink.bFlushOk;
+    }
+
+    // Stop the sink's worker once its queue is empty, and wait for it - unless it stops making progress.
+    // Returns false if the worker was abandoned (and left running).
+    // - Note: The worker gets StopTimeout for each pass, so a long queue going to a slow (but working) sink isn't cut short.
+    bool SinkWorkerLogger::StopSinkWorker(Sink& sink) noexcept
+    {
+        std::vector<FlushBarrier> abandoned;
+        bool bExited = false;
+
+        if ( !sink.worker.joinable( ) )
+        {
+            return true;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(sink.mutex);
+            sink.bStop = true;
+            sink.workCV.notify_one( );
+            sink.doneCV.notify_all( );
+
+            uint64_t passes = sink.flushPasses;
+
+            while ( !sink.bExited )
+            {
+                const bool bProgress = sink.doneCV.wait_for(lock, StopTimeout, [&sink, passes] ( ) -> bool
+                {
+                    return sink.bExited || sink.flushPasses != passes;
+                });
+
+                if ( !bProgress )
+                {
+                    break;
+                }
+
+                passes = sink.flushPasses;
+            }
+
+            bExited = sink.bExited;
+
+            if ( !bExited )
+            {
+                abandoned.swap(sink.barriers);
+            }
+        }
+
+        // Stuck - leave it running (it holds its own reference to the sink), and fail anyone still waiting on it.
+        if ( !bExited )
+        {
+            sink.worker.detach( );
+
+            for ( FlushBarrier& barrier : abandoned )
+            {
+                CompleteFlush(*barrier.pFlush, false);
+            }
+
+            return false;
+        }
+
+        sink.worker.join( );
+        return true;
+    }
+
+    // Deliver one sink's result to a pending flush - the last one in calls onFlushed.
+    void SinkWorkerLogger::CompleteFlush(PendingFlush& flush, const bool bFlushed) noexcept
+    {
+        if ( !bFlushed )
+        {
+            flush.bFlushed = false;
+        }
+
+        if ( flush.remaining.fetch_sub(1) != 1 )
+        {
+            return;
+        }
+
+        try
+        {
+            flush.onFlushed(flush.bFlushed);
+        }
+        catch ( ... )
+        {
+            // Best effort - a throwing callback must not take a worker down with it.
+        }
+    }
+
+    // Build the sinks from their settings.
+    std::vector<std::shared_ptr<SinkWorkerLogger::Sink>> SinkWorkerLogger::BuildSinks(std::vector<SinkSettings>&& settings)
+    {
+        std::vector<std::shared_ptr<Sink>> sinks;
+
+        if ( settings.empty( ) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid sinks argument (empty).");
+        }
+
+        sinks.reserve(settings.size( ));
+
+        for ( SinkSettings& s : settings )
+        {
+            if ( !s.pLogger )
+            {
+                throw std::invalid_argument(__FUNCTION__" - Invalid sink logger (nullptr).");
+            }
+
+            std::shared_ptr<Sink> pSink = std::make_shared<Sink>( );
+            pSink->pLogger = std::move(s.pLogger);
+            pSink->queueCapacity = s.queueCapacity;
+            pSink->bBlockWhenFull = s.bBlockWhenFull;
+
+            sinks.push_back(std::move(pSink));
+        }
+
+        return sinks;
+    }
+
+    /// Constructor \\\
+
+    // Sinks Constructor - starts a worker for each sink with a delivery queue.
+    SinkWorkerLogger::SinkWorkerLogger(std::vector<SinkSettings> sinks) :
+        LoggerBase(ConfigPackage( )),
+        mSinks(BuildSinks(std::move(sinks))),
+        mCrashed(false),
+        mNoBlock(false)
+    {
+        try
+        {
+            for ( const std::shared_ptr<Sink>& pSink : mSinks )
+            {
+                if ( pSink->queueCapacity != 0 )
+                {
+                    pSink->worker = std::thread(&SinkWorkerLogger::SinkWorkerLoop, pSink);
+                }
+            }
+        }
+        catch ( const std::exception& )
+        {
+            // Don't leave already-started workers running against a half-built logger.
+            for ( const std::shared_ptr<Sink>& pSink : mSinks )
+            {
+                StopSinkWorker(*pSink);
+            }
+
+            throw;
+        }
+    }
+
+    /// Destructor \\\
+
+    // Write out what's left in each delivery queue, stop the workers and report any drops.
+    SinkWorkerLogger::~SinkWorkerLogger( )
+    {
+        for ( const std::shared_ptr<Sink>& pSink : mSinks )
+        {
+            // An abandoned worker may still be inside the sink - leave the sink to it.
+            if ( !StopSinkWorker(*pSink) )
+            {
+                continue;
+            }
+
+            if ( pSink->dropped != 0 )
+            {
+                // Attempt to log one last message - report drops to the sink that missed out on them.
+                try
+                {
+                    pSink->pLogger->Log(
+                        VerbosityLevel::WARN,
+                        __FUNCTION__" - dropped logs = %llu (delivery queue full).\r\n",
+                        static_cast<unsigned long long>(pSink->dropped.load( ))
+                    );
+                }
+                catch ( ... )
+                {
+                    // Best effort - nothing else to do.
+                }
+            }
+        }
+    }
+
+    /// Public Methods \\\
+
+    // Submit log message to sink(s) (variadic arguments, narrow).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
+    // Submit log message to sink(s) (variadic arguments, wide).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
+    // Submit log message to sink(s) (va_list, narrow).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const utf8* pFormat, va_list pArgs) const
+    {
+        return Log(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to sink(s) (va_list, wide).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const utf16* pFormat, va_list pArgs) const
+    {
+        return Log(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to sink(s) (variadic arguments, narrow, explicit thread ID).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
+    // Submit log message to sink(s) (variadic arguments, wide, explicit thread ID).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
+    // Submit log message to sink(s) (va_list, narrow, explicit thread ID).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, va_list pArgs) const
+    {
+        return Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to sink(s) (va_list, wide, explicit thread ID).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const
+    {
+        return Log(lvl, tid, LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to sink(s) (variadic arguments, narrow, explicit thread ID and event time).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
+    // Submit log message to sink(s) (variadic arguments, wide, explicit thread ID and event time).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+
+        try
+        {
+            ret = Log(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            // Cleanup and pass the exception further down the call stack.
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+
+        return ret;
+    }
+
+    // Submit log message to sink(s) (va_list, narrow, explicit thread ID and event time).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const
+    {
+        if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
+        }
+
+        // Records are UTF-16 - convert the format and take the wide path.
+        return Log(lvl, tid, time, CC::StringUtil::UTFConversion<ReturnType::SmartCString, utf16, utf8>(pFormat).get( ), pArgs);
+    }
+
+    // Submit log message to sink(s) (va_list, wide, explicit thread ID and event time).
+    bool SinkWorkerLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const
+    {
+        if ( !pFormat )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid format argument (null).");
+        }
+
+        // Format once, then hand the same text to every sink.
+        const std::unique_ptr<utf16[ ]> pMessage = LoggerBase::BuildFormattedMessage<utf16>(pFormat, pArgs);
+
+        return WriteRecord(LogRecord { lvl, tid, time, std::basic_string_view<utf16>(pMessage.get( )), NextSequenceNumber( ) });
+    }
+
+    // Submit pre-formatted log record to every sink - written in-line, or queued for the sink's worker.
+    bool SinkWorkerLogger::WriteRecord(const LogRecord& record) const
+    {
+        bool bWriteFailed = false;
+        bool bTaken = false;
+
+        if ( record.lvl < VerbosityLevel::BEGIN || record.lvl >= VerbosityLevel::MAX )
+        {
+            throw std::invalid_argument(
+                __FUNCTION__" - Invalid verbosity level argument (" +
+                std::to_string(static_cast<VerbosityLevelType>(record.lvl)) +
+                ")."
+            );
+        }
+
+        // Every sink gets its chance, even if an earlier one failed.
+        // - Note: Drops are counted on their own (see GetStats), so they don't fail the record if another sink took it.
+        // - Note: After a crash, a queued sink the crash hook couldn't take over is skipped - its worker is stuck or gone.
+        for ( const std::shared_ptr<Sink>& pSink : mSinks )
+        {
+            if ( pSink->queueCapacity != 0 && !pSink->bTakenOver )
+            {
+                bTaken |= !mCrashed && QueueRecord(*pSink, record);
+            }
+            else if ( pSink->pLogger->WriteRecord(record) )
+            {
+                bTaken = true;
+            }
+            else
+            {
+                bWriteFailed = true;
+            }
+        }
+
+        return bTaken && !bWriteFailed;
+    }
+
+    // Flush every sink, waiting for each queued sink's worker to write and flush everything queued so far.
+    bool SinkWorkerLogger::Flush( ) const
+    {
+        bool ret = true;
+
+        for ( const std::shared_ptr<Sink>& pSink : mSinks )
+        {
+            if ( pSink->queueCapacity != 0 && !pSink->bTakenOver )
+            {
+                ret &= !mCrashed && FlushQueuedSink(*pSink);
+            }
+            else
+            {
+                ret &= pSink->pLogger->Flush( );
+            }
+        }
+
+        return ret;
+    }
+
+    // Flush only the sinks written in-line - queued sinks flush themselves after each pass.
+    bool SinkWorkerLogger::FlushInlineSinks( ) const
+    {
+        bool ret = true;
+
+        for ( const std::shared_ptr<Sink>& pSink : mSinks )
+        {
+            if ( pSink->queueCapacity == 0 )
+            {
+                ret &= pSink->pLogger->Flush( );
+            }
+        }
+
+        return ret;
+    }
+
+    // Stop making writers wait for queue space - from now on, records that don't fit are dropped.
+    void SinkWorkerLogger::StopBlocking( ) const noexcept
+    {
+        mNoBlock = true;
+
+        // Wake writers under each sink's lock, so one that's about to wait can't miss the flag.
+        for ( const std::shared_ptr<Sink>& pSink : mSinks )
+        {
+            if ( pSink->queueCapacity != 0 )
+            {
+                std::lock_guard<std::mutex> lg(pSink->mutex);
+                pSink->doneCV.notify_all( );
+            }
+        }
+    }
+
+    // Flush every sink without waiting on the queued ones - in-line sinks are flushed now, queued sinks by their worker
+    // once it has written everything queued so far.  onFlushed gets the combined result once every sink is done.
+    void SinkWorkerLogger::FlushAsync(std::function<void(bool)> onFlushed) const
+    {
+        std::shared_ptr<PendingFlush> pFlush = std::make_shared<PendingFlush>( );
+        bool bFlushed = true;
+
+        // Our own hold on the flush, so it can't complete while we're still handing it out.
+        pFlush->remaining = 1;
+        pFlush->bFlushed = true;
+        pFlush->onFlushed = std::move(onFlushed);
+
+        try
+        {
+            for ( const std::shared_ptr<Sink>& pSink : mSinks )
+            {
+                if ( pSink->queueCapacity == 0 )
+                {
+                    bFlushed &= pSink->pLogger->Flush( );
+                    continue;
+                }
+
+                std::lock_guard<std::mutex> lg(pSink->mutex);
+
+                // Stopping - the worker may already be gone.
+                if ( pSink->bStop )
+                {
+                    bFlushed = false;
+                    continue;
+                }
+
+                // Ask for a pass even with nothing queued, so the sink's own buffer is flushed too.
+                pSink->barriers.push_back(FlushBarrier { pSink->submitted, pSink->flushPasses, pFlush });
+                pFlush->remaining++;
+                pSink->bFlushWanted = true;
+                pSink->workCV.notify_one( );
+            }
+        }
+        catch ( const std::exception& )
+        {
+            // Whatever was handed out still completes - the flush just fails.
+            bFlushed = false;
+        }
+
+        CompleteFlush(*pFlush, bFlushed);
+    }
+
+    // Crash hook for AsyncLogger (see CrashDrain) - takes each queued sink over from its worker, and writes what's still
+    // queued for it straight to the sink.
+    // - Note: The queue is read without its lock - once we have the sink, the worker won't touch it, and AsyncLogger's
+    //         crash hook has already taken its own sink (us) over from AsyncLogger's worker, the only other writer.
+    void SinkWorkerLogger::TakeOverSinks(const std::chrono::steady_clock::time_point& deadline) const noexcept
+    {
+        const std::thread::id self = std::this_thread::get_id( );
+
+        mCrashed = true;
+
+        for ( const std::shared_ptr<Sink>& pSink : mSinks )
+        {
+            std::thread::id owner;
+            bool bClaimed = pSink->queueCapacity != 0;
+
+            // If the crashing thread is the sink's worker, the sink is in no state to take any more.
+            while ( bClaimed && !pSink->writer.compare_exchange_weak(owner, self) )
+            {
+                bClaimed = owner != self && std::chrono::steady_clock::now( ) < deadline;
+                owner = std::thread::id( );
+                std::this_thread::yield( );
+            }
+
+            if ( !bClaimed )
+            {
+                continue;
+            }
+
+            for ( const QueuedRecord& record : pSink->queue )
+            {
+                try
+                {
+                    pSink->pLogger->WriteRecord(LogRecord { record.lvl, record.tid, record.time, record.message, record.seq });
+                }
+                catch ( ... )
+                {
+                    // Best effort - keep going with the rest.
+                }
+            }
+
+            pSink->bTakenOver = true;
+        }
+    }
+
+    // Returns every sink's statistics added together, plus delivery queue drops, depth and high-watermark (lock-free).
+    LogStats SinkWorkerLogger::GetStats( ) const
+    {
+        LogStats stats = mStats.GetSnapshot( );
+
+        for ( const std::shared_ptr<Sink>& pSink : mSinks )
+        {
+            stats += pSink->pLogger->GetStats( );
+            stats.queueDepth += pSink->queueDepth;
+            stats.queueHighWatermark += pSink->queueHighWatermark;
+        }
+
+        return stats;
+    }
+}
\ No newline at end of file
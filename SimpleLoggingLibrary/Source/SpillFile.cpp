@@ -0,0 +1,242 @@
+// Class Header
+#include <SpillFile.h>
+
+// STL
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace SLL
+{
+    // Paths of every spill file currently open in this process - two loggers must never share one.
+    static std::mutex s_PathsInUseMutex;
+    static std::set<std::filesystem::path> s_PathsInUse;
+
+    /// Private Helper Methods \\\
+
+    // Returns the path the file is claimed under - absolute, so relative and absolute spellings of one file match.
+    std::filesystem::path SpillFile::GetClaimPath(const std::filesystem::path& file)
+    {
+        std::error_code ec;
+        const std::filesystem::path absolute = std::filesystem::absolute(file, ec);
+
+        return (ec ? file : absolute).lexically_normal( );
+    }
+
+    // Claim the path for this file - throws if another spill file in the process already has it.
+    void SpillFile::ClaimPath( )
+    {
+        std::lock_guard<std::mutex> lock(s_PathsInUseMutex);
+
+        if ( !s_PathsInUse.insert(mClaimPath).second )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid file argument (already in use by another spill file).");
+        }
+    }
+
+    // Release the path claimed by ClaimPath.
+    void SpillFile::ReleasePath( ) noexcept
+    {
+        std::lock_guard<std::mutex> lock(s_PathsInUseMutex);
+
+        s_PathsInUse.erase(mClaimPath);
+    }
+
+    // Position the stream for the next read or write.
+    void SpillFile::Seek(const Access access)
+    {
+        // The stream already sits where the last access of the same kind left it.
+        if ( access == mLastAccess )
+        {
+            return;
+        }
+
+        if ( access == Access::Write )
+        {
+            mStream.seekp(static_cast<std::streamoff>(mWriteOffset));
+        }
+        else
+        {
+            mStream.seekg(static_cast<std::streamoff>(mReadOffset));
+        }
+
+        mLastAccess = access;
+    }
+
+    // Throw (after clearing the stream's error state) if the last stream operation failed.
+    void SpillFile::ThrowIfFailed(const char* pFunction)
+    {
+        if ( mStream.fail( ) )
+        {
+            // Leave the stream usable, and make the next access seek back to a known position.
+            mStream.clear( );
+            mLastAccess = Access::None;
+
+            throw std::runtime_error(std::string(pFunction) + " - Spill file I/O failed.");
+        }
+    }
+
+    /// Constructor \\\
+
+    // Create (or overwrite) the file, preallocating preallocateBytes.
+    // - Note: The path is claimed before the file is opened, so a path in use is rejected without truncating the other file.
+    SpillFile::SpillFile(const std::filesystem::path& file, const uint64_t preallocateBytes) :
+        mPath(file),
+        mClaimPath(GetClaimPath(file)),
+        mWriteOffset(0),
+        mReadOffset(0),
+        mCount(0),
+        mLastAccess(Access::None)
+    {
+        if ( mPath.empty( ) )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid file argument (empty).");
+        }
+
+        ClaimPath( );
+
+        try
+        {
+            mStream.open(mPath, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+            if ( !mStream.is_open( ) )
+            {
+                throw std::runtime_error(__FUNCTION__" - Failed to open spill file.");
+            }
+
+            // Preallocate by writing the last byte - the file only grows past this during a larger burst.
+            if ( preallocateBytes != 0 )
+            {
+                mStream.seekp(static_cast<std::streamoff>(preallocateBytes - 1));
+                mStream.put('\0');
+                mStream.flush( );
+
+                ThrowIfFailed(__FUNCTION__);
+            }
+        }
+        catch ( ... )
+        {
+            ReleasePath( );
+            throw;
+        }
+    }
+
+    /// Destructor \\\
+
+    // Close and delete the file.
+    SpillFile::~SpillFile( )
+    {
+        std::error_code ec;
+
+        mStream.close( );
+
+        // Best effort - a leftover scratch file is overwritten next time.
+        std::filesystem::remove(mPath, ec);
+
+        ReleasePath( );
+    }
+
+    /// Public Methods \\\
+
+    // Returns number of bytes a record with len characters of payload takes up.
+    uint64_t SpillFile::GetRecordSize(const size_t len) noexcept
+    {
+        return sizeof(Header) + (static_cast<uint64_t>(len) * sizeof(utf16));
+    }
+
+    // Returns number of records that haven't been read back yet.
+    size_t SpillFile::GetCount( ) const noexcept
+    {
+        return mCount;
+    }
+
+    // Returns true if every record has been read back.
+    bool SpillFile::Empty( ) const noexcept
+    {
+        return mCount == 0;
+    }
+
+    // Append a record - pPayload holds hdr.len characters.
+    void SpillFile::Append(const Header& hdr, const void* pPayload)
+    {
+        const size_t payloadBytes = hdr.len * sizeof(utf16);
+
+        if ( !pPayload && payloadBytes != 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid payload argument (null).");
+        }
+
+        Seek(Access::Write);
+
+        mStream.write(reinterpret_cast<const char*>(&hdr), sizeof(Header));
+        mStream.write(static_cast<const char*>(pPayload), static_cast<std::streamsize>(payloadBytes));
+
+        // A partially-written record isn't counted - the next append overwrites it.
+        ThrowIfFailed(__FUNCTION__);
+
+        mWriteOffset += GetRecordSize(hdr.len);
+        mCount++;
+    }
+
+    // Read the oldest record's header, without consuming it.
+    void SpillFile::PeekHeader(Header& hdr)
+    {
+        if ( mCount == 0 )
+        {
+            throw std::logic_error(__FUNCTION__" - No records to read.");
+        }
+
+        // Reading means switching away from writing - this also pushes buffered appends out to the file.
+        Seek(Access::Read);
+
+        mStream.read(reinterpret_cast<char*>(&hdr), sizeof(Header));
+        ThrowIfFailed(__FUNCTION__);
+
+        // Leave the stream at the record's start, so the header can be peeked again.
+        mStream.seekg(static_cast<std::streamoff>(mReadOffset));
+    }
+
+    // Read the oldest record's payload (hdr.len characters, per PeekHeader) into pPayload, consuming the record.
+    void SpillFile::ReadPayload(const Header& hdr, void* pPayload)
+    {
+        const size_t payloadBytes = hdr.len * sizeof(utf16);
+
+        if ( mCount == 0 )
+        {
+            throw std::logic_error(__FUNCTION__" - No records to read.");
+        }
+
+        if ( !pPayload && payloadBytes != 0 )
+        {
+            throw std::invalid_argument(__FUNCTION__" - Invalid payload argument (null).");
+        }
+
+        Seek(Access::Read);
+
+        mStream.seekg(static_cast<std::streamoff>(mReadOffset + sizeof(Header)));
+        mStream.read(static_cast<char*>(pPayload), static_cast<std::streamsize>(payloadBytes));
+        ThrowIfFailed(__FUNCTION__);
+
+        mReadOffset += GetRecordSize(hdr.len);
+
+        // Everything has been read back - rewind, so the next burst reuses the same space.
+        if ( --mCount == 0 )
+        {
+            Discard( );
+        }
+    }
+
+    // Drop every unread record and rewind.  Returns number of records dropped.
+    size_t SpillFile::Discard( ) noexcept
+    {
+        const size_t dropped = mCount;
+
+        mWriteOffset = 0;
+        mReadOffset = 0;
+        mCount = 0;
+        mLastAccess = Access::None;
+
+        return dropped;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+// Class Header
+#include <StatCounters.h>
+
+namespace SLL
+{
+    // Next slot to hand out (round-robin across threads).
+    static std::atomic<size_t> s_NextSlot(0);
+
+    /// Static Private Helper Methods \\\
+
+    // Returns the calling thread's slot index.
+    size_t StatCounters::GetSlotIndex( ) noexcept
+    {
+        // Assigned on the thread's first use, shared by every logger's counters.
+        static thread_local const size_t slot = s_NextSlot.fetch_add(1, std::memory_order_relaxed) % SlotCount;
+
+        return slot;
+    }
+
+    /// Constructors \\\
+
+    // Default Constructor - all counters start at zero.
+    StatCounters::StatCounters( ) noexcept
+    {
+        Reset( );
+    }
+
+    // Move Constructor - totals are carried over, src is reset.
+    StatCounters::StatCounters(StatCounters&& src) noexcept
+    {
+        *this = std::move(src);
+    }
+
+    /// Assignment Overload \\\
+
+    // Move Assignment - totals are carried over, src is reset.
+    StatCounters& StatCounters::operator=(StatCounters&& src) noexcept
+    {
+        if ( this != &src )
+        {
+            Reset( );
+
+            for ( size_t i = 0; i < CounterCount; i++ )
+            {
+                mSlots[0].counts[i].store(src.Get(static_cast<Counter>(i)), std::memory_order_relaxed);
+            }
+
+            src.Reset( );
+        }
+
+        return *this;
+    }
+
+    /// Public Methods \\\
+
+    // Add to a counter (calling thread's slot only).
+    void StatCounters::Add(const Counter counter, const uint64_t n) noexcept
+    {
+        mSlots[GetSlotIndex( )].counts[static_cast<size_t>(counter)].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    // Returns a counter's total across all slots.
+    uint64_t StatCounters::Get(const Counter counter) const noexcept
+    {
+        uint64_t total = 0;
+
+        for ( const Slot& slot : mSlots )
+        {
+            total += slot.counts[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+        }
+
+        return total;
+    }
+
+    // Returns every counter's total, as a LogStats snapshot (queue fields are left at zero).
+    LogStats StatCounters::GetSnapshot( ) const noexcept
+    {
+        LogStats stats;
+
+        stats.accepted = Get(Counter::Accepted);
+        stats.filtered = Get(Counter::Filtered);
+        stats.dropped = Get(Counter::Dropped);
+        stats.coalesced = Get(Counter::Coalesced);
+        stats.rateLimited = Get(Counter::RateLimited);
+        stats.written = Get(Counter::Written);
+        stats.failed = Get(Counter::Failed);
+        stats.bytesWritten = Get(Counter::BytesWritten);
+        stats.flushes = Get(Counter::Flushes);
+        stats.restoreAttempts = Get(Counter::RestoreAttempts);
+
+        return stats;
+    }
+
+    // Zero every counter.
+    void StatCounters::Reset( ) noexcept
+    {
+        for ( Slot& slot : mSlots )
+        {
+            for ( std::atomic<uint64_t>& count : slot.counts )
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
\ No newline at end of file
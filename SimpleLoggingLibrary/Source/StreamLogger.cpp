@@ -5,9 +5,13 @@
 // using Window's Virtual Terminal
 #include <WindowsConsoleHelper.h>
 
+// Call-site rate limiting
+#include <RateLimiter.h>
+
 // STL
 #include <stdexcept>
 #include <thread>
+#include <type_traits>
 
 // CC StringUtil - UTF Conversions
 #include <CCStringUtil.h>
@@ -151,6 +155,8 @@ namespace SLL
         static size_t failTicker = 0;
         static size_t failFreq = FAIL_FREQ_START;
 
+        mStats.Add(StatCounters::Counter::RestoreAttempts);
+
         try
         {
             // Clear stream state and attempt to flush.
@@ -190,10 +196,14 @@ namespace SLL
             return;
         }
 
+        const size_t flushInterval = GetConfig( ).GetFlushInterval( );
+
         // Flush messages to file periodically, or if the message is likely important.
-        if ( (mFlushCounter++ % mFlushInterval) == 0 || lvl >= VerbosityLevel::WARN )
+        // A flush interval of zero disables periodic flushing (e.g., caller flushes per batch).
+        if ( (flushInterval != 0 && (mFlushCounter++ % flushInterval) == 0) || lvl >= VerbosityLevel::WARN )
         {
             mStream.flush( );
+            mStats.Add(StatCounters::Counter::Flushes);
         }
     }
 
@@ -252,7 +262,15 @@ namespace SLL
 
     template <class StreamType>
     template <class T>
-    bool StreamLogger<StreamType>::LogInternal(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_z_ _Printf_format_string_ const T* pFormat, _In_ va_list pArgs) const
+    bool StreamLogger<StreamType>::LogInternal(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const T* pFormat, _In_ va_list pArgs) const
+    {
+        return LogInternal(lvl, tid, time, std::nullopt, pFormat, pArgs);
+    }
+
+    // Internal Logging Implementation - with a sequence number stamped by the caller (none - written messages take their own).
+    template <class StreamType>
+    template <class T>
+    bool StreamLogger<StreamType>::LogInternal(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_ const std::optional<uint64_t>& seq, _In_z_ _Printf_format_string_ const T* pFormat, _In_ va_list pArgs) const
     {
         // Ensure verbosity level is valid.
         if ( lvl < VerbosityLevel::BEGIN || lvl >= VerbosityLevel::MAX )
@@ -279,24 +297,81 @@ namespace SLL
         // Don't log if message level is below the configured verbosity threshold.
         if ( lvl < GetConfig( ).GetVerbosityThreshold( ) )
         {
+            mStats.Add(StatCounters::Counter::Filtered);
+            return true;
+        }
+
+        // Don't log if the call site is over its rate limit - decided before anything is formatted.
+        const std::shared_ptr<RateLimiter>& pLimiter = GetConfig( ).GetRateLimiter( );
+
+        if ( pLimiter && !pLimiter->Allow(pFormat, lvl) )
+        {
+            mStats.Add(StatCounters::Counter::RateLimited);
             return true;
         }
 
+        mStats.Add(StatCounters::Counter::Accepted);
+
         // Check if the stream is still open and in a good state, attempt to recover if not.
         if ( !IsStreamGood( ) && !RestoreStream( ) )
         {
+            mStats.Add(StatCounters::Counter::Failed);
             return false;
         }
 
+        // When coalescing, the message is formatted up front, so it can be compared with the ones before it.
+        if ( mpCoalescing )
+        {
+            try
+            {
+                const std::unique_ptr<T[ ]> message = BuildFormattedMessage<T>(pFormat, pArgs);
+                const T* pMessage = message.get( );
+
+                // Narrow text is widened a character at a time, same as the stream would.
+                mpCoalescing->message.assign(pMessage, pMessage + std::char_traits<T>::length(pMessage));
+            }
+            catch ( const std::exception& )
+            {
+                mStats.Add(StatCounters::Counter::Failed);
+                return false;
+            }
+
+            LogRecord record { lvl, tid, time, mpCoalescing->message, seq.value_or(0) };
+            bool bWrite = false;
+
+            if constexpr ( std::is_same_v<T, utf8> )
+            {
+                bWrite = CoalesceRecord(record, pFormat, nullptr, seq.has_value( ));
+            }
+            else
+            {
+                bWrite = CoalesceRecord(record, nullptr, pFormat, seq.has_value( ));
+            }
+
+            if ( !bWrite )
+            {
+                return true;
+            }
+
+            // Only written messages take a sequence number of their own.
+            if ( !seq )
+            {
+                record.seq = GetConfig( ).OptionEnabled(OptionFlag::LogSequenceNumber) ? NextSequenceNumber( ) : 0;
+            }
+
+            return WriteText(record);
+        }
+
         // Log message prefix strings.
         try
         {
-            LogPrefixes<T>(lvl, tid);
+            LogPrefixes<T>(lvl, tid, time, (seq) ? *seq : (GetConfig( ).OptionEnabled(OptionFlag::LogSequenceNumber) ? NextSequenceNumber( ) : 0));
         }
         catch ( const std::exception& )
         {
             // Best effort - we'll attempt to restore to a good state next log.
             mStream.setstate(std::ios_base::badbit);
+            mStats.Add(StatCounters::Counter::Failed);
             return IsStreamGood( );
         }
 
@@ -309,19 +384,20 @@ namespace SLL
         {
             // Best effort - we'll attempt to restore to a good state next log.
             mStream.setstate(std::ios_base::badbit);
+            mStats.Add(StatCounters::Counter::Failed);
             return IsStreamGood( );
         }
 
         // Flush messages to file periodically, or if the message is likely important.
         Flush(lvl);
 
-        return IsStreamGood( );
+        return CountWriteResult( );
     }
 
     // Log Prefixes to Stream.
     template <class StreamType>
     template <class T>
-    void StreamLogger<StreamType>::LogPrefixes(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid) const
+    void StreamLogger<StreamType>::LogPrefixes(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_ const uint64_t seq) const
     {
         std::vector<std::unique_ptr<T[ ]>> prefixes;
 
@@ -332,7 +408,7 @@ namespace SLL
 
         try
         {
-            prefixes = BuildMessagePrefixes<T>(lvl, tid);
+            prefixes = BuildMessagePrefixes<T>(lvl, tid, time, seq);
         }
         catch ( const std::exception& )
         {
@@ -343,7 +419,9 @@ namespace SLL
         // Log in color if option is enabled (does nothing for FileLogger specialization).
         if ( GetConfig( ).OptionEnabled(OptionFlag::LogInColor) )
         {
-            mStream << GetColorSequence<utf16>(lvl).c_str( );
+            const std::basic_string<utf16>& color = GetColorSequence<utf16>(lvl);
+            mStream << color.c_str( );
+            CountBytesWritten(color.size( ));
         }
 
         for ( auto& p : prefixes )
@@ -354,6 +432,7 @@ namespace SLL
             }
 
             mStream << p.get( );
+            CountBytesWritten(std::char_traits<T>::length(p.get( )));
         }
     }
 
@@ -385,15 +464,156 @@ namespace SLL
         }
 
         mStream << message.get( );
+        CountBytesWritten(std::char_traits<T>::length(message.get( )));
+
+        EndMessage( );
+    }
+
+    // Log Pre-Formatted Message To Stream.
+    template <class StreamType>
+    void StreamLogger<StreamType>::LogRawMessage(_In_ const std::basic_string_view<utf16>& message) const
+    {
+        if ( !IsStreamGood( ) )
+        {
+            throw std::runtime_error(__FUNCTION__" - Stream in bad state, cannot write message to stream.");
+        }
+
+        mStream.write(message.data( ), static_cast<std::streamsize>(message.size( )));
+        CountBytesWritten(message.size( ));
 
+        EndMessage( );
+    }
+
+    // Write message terminator (and restore console color, if enabled).
+    template <class StreamType>
+    void StreamLogger<StreamType>::EndMessage( ) const
+    {
         // If LogInColor is enabled, then return text output to the 
         // original console foreground color, in case other things are writting to stdout.
         if ( GetConfig( ).OptionEnabled(OptionFlag::LogInColor) )
         {
-            mStream << GetColorSequence<utf16>(Color::DEFAULT);
+            const std::basic_string<utf16>& color = GetColorSequence<utf16>(Color::DEFAULT);
+            mStream << color;
+            CountBytesWritten(color.size( ));
         }
 
         mStream << L"\n";
+        CountBytesWritten(1);
+    }
+
+    // Count characters just written to the stream (as UTF-16 bytes), if the stream took them.
+    template <class StreamType>
+    void StreamLogger<StreamType>::CountBytesWritten(_In_ const size_t length) const noexcept
+    {
+        if ( IsStreamGood( ) )
+        {
+            mStats.Add(StatCounters::Counter::BytesWritten, length * sizeof(utf16));
+        }
+    }
+
+    // Count a finished write as written or failed, by the stream's state.  Returns whether it was written.
+    template <class StreamType>
+    bool StreamLogger<StreamType>::CountWriteResult( ) const noexcept
+    {
+        const bool bWritten = IsStreamGood( );
+
+        mStats.Add((bWritten) ? StatCounters::Counter::Written : StatCounters::Counter::Failed);
+
+        return bWritten;
+    }
+
+    // Write record's prefixes and text, then flush if it's due.  Returns whether it was written.
+    template <class StreamType>
+    bool StreamLogger<StreamType>::WriteText(_In_ const LogRecord& record) const
+    {
+        // Log message prefix strings, followed by the message itself.
+        try
+        {
+            LogPrefixes<utf16>(record.lvl, record.tid, record.time, record.seq);
+            LogRawMessage(record.message);
+        }
+        catch ( const std::exception& )
+        {
+            // Best effort - we'll attempt to restore to a good state next log.
+            mStream.setstate(std::ios_base::badbit);
+            mStats.Add(StatCounters::Counter::Failed);
+            return IsStreamGood( );
+        }
+
+        // Flush messages to file periodically, or if the message is likely important.
+        Flush(record.lvl);
+
+        return CountWriteResult( );
+    }
+
+    // Pass record through the coalescer, writing any summaries due ahead of it.  Returns whether record should be written.
+    template <class StreamType>
+    bool StreamLogger<StreamType>::CoalesceRecord(_In_ const LogRecord& record, _In_ const utf8* pNarrowFormat, _In_ const utf16* pWideFormat, _In_ const bool bStamped) const
+    {
+        const bool bWrite = mpCoalescing->coalescer.Submit(record, pNarrowFormat, pWideFormat, mpCoalescing->summaries);
+
+        WriteSummaries(bStamped);
+
+        if ( !bWrite )
+        {
+            mStats.Add(StatCounters::Counter::Coalesced);
+        }
+
+        return bWrite;
+    }
+
+    // Write the coalescer's summaries that are due (bAll - every pending summary, e.g., on destruction).
+    template <class StreamType>
+    void StreamLogger<StreamType>::WriteDueSummaries(_In_ const bool bAll) const
+    {
+        mpCoalescing->coalescer.Expire(LogClock::now( ), bAll, mpCoalescing->summaries);
+
+        WriteSummaries(false);
+    }
+
+    // Write summaries the coalescer has handed back, then forget them (bStamped - see CoalesceRecord).
+    // - Note: Summaries aren't messages in their own right, so only their bytes are counted.
+    template <class StreamType>
+    void StreamLogger<StreamType>::WriteSummaries(_In_ const bool bStamped) const
+    {
+        const bool bSequence = GetConfig( ).OptionEnabled(OptionFlag::LogSequenceNumber);
+
+        for ( const MessageCoalescer::Summary& summary : mpCoalescing->summaries )
+        {
+            try
+            {
+                LogPrefixes<utf16>(summary.lvl, summary.tid, summary.time, (bStamped) ? summary.seq : ((bSequence) ? NextSequenceNumber( ) : 0));
+                LogRawMessage(summary.message);
+            }
+            catch ( const std::exception& )
+            {
+                // Best effort - we'll attempt to restore to a good state next log.
+                mStream.setstate(std::ios_base::badbit);
+                break;
+            }
+        }
+
+        mpCoalescing->summaries.clear( );
+    }
+
+    // Returns coalescing state for config (null if coalescing is disabled).
+    template <class StreamType>
+    std::unique_ptr<typename StreamLogger<StreamType>::Coalescing> StreamLogger<StreamType>::BuildCoalescing(_In_ const ConfigPackage& config)
+    {
+        if ( config.GetCoalesceWindow( ) == std::chrono::milliseconds::zero( ) )
+        {
+            return nullptr;
+        }
+
+        return std::make_unique<Coalescing>(config);
+    }
+
+    // Coalescing Constructor
+    template <class StreamType>
+    StreamLogger<StreamType>::Coalescing::Coalescing(_In_ const ConfigPackage& config) :
+        coalescer(config.GetCoalesceWindow( ), config.GetCoalesceByFormat( ))
+    {
+
     }
 
     template <class StreamType>
@@ -409,7 +629,8 @@ namespace SLL
     StreamLogger<StdOutStream>::StreamLogger(_In_ const ConfigPackage& config) :
         LoggerBase(config),
         mpUTF16StreamBuffer(reinterpret_cast<std::basic_streambuf<utf16>*>(std::wcout.rdbuf( ))),
-        mStream(mpUTF16StreamBuffer)
+        mStream(mpUTF16StreamBuffer),
+        mpCoalescing(BuildCoalescing(config))
     {
         InitializeStream( );
     }
@@ -418,7 +639,8 @@ namespace SLL
     template <>
     StreamLogger<FileStream>::StreamLogger(_In_ const ConfigPackage& config) :
         LoggerBase(config),
-        mpUTF16StreamBuffer(nullptr)
+        mpUTF16StreamBuffer(nullptr),
+        mpCoalescing(BuildCoalescing(config))
     {
         InitializeStream( );
     }
@@ -428,7 +650,8 @@ namespace SLL
     StreamLogger<StdOutStream>::StreamLogger(_In_ ConfigPackage&& config) :
         LoggerBase(std::move(config)),
         mpUTF16StreamBuffer(reinterpret_cast<std::basic_streambuf<utf16>*>(std::wcout.rdbuf( ))),
-        mStream(mpUTF16StreamBuffer)
+        mStream(mpUTF16StreamBuffer),
+        mpCoalescing(BuildCoalescing(GetConfig( )))
     {
         InitializeStream( );
     }
@@ -437,7 +660,8 @@ namespace SLL
     template <>
     StreamLogger<FileStream>::StreamLogger(_In_ ConfigPackage&& config) :
         LoggerBase(std::move(config)),
-        mpUTF16StreamBuffer(nullptr)
+        mpUTF16StreamBuffer(nullptr),
+        mpCoalescing(BuildCoalescing(GetConfig( )))
     {
         InitializeStream( );
     }
@@ -447,7 +671,8 @@ namespace SLL
     StreamLogger<StdOutStream>::StreamLogger(_In_ StreamLogger&& src) :
         LoggerBase(std::move(src)),
         mpUTF16StreamBuffer(reinterpret_cast<std::basic_streambuf<utf16>*>(std::wcout.rdbuf( ))),
-        mStream(mpUTF16StreamBuffer)
+        mStream(mpUTF16StreamBuffer),
+        mpCoalescing(std::move(src.mpCoalescing))
     {
         InitializeStream( );
     }
@@ -456,7 +681,8 @@ namespace SLL
     template <>
     StreamLogger<FileStream>::StreamLogger(_In_ StreamLogger&& src) :
         LoggerBase(std::move(src)),
-        mpUTF16StreamBuffer(nullptr)
+        mpUTF16StreamBuffer(nullptr),
+        mpCoalescing(std::move(src.mpCoalescing))
     {
         InitializeStream( );
     }
@@ -469,6 +695,12 @@ namespace SLL
     {
         try
         {
+            // Repeats still being counted get their summary now.
+            if ( mpCoalescing && IsStreamGood( ) )
+            {
+                WriteDueSummaries(true);
+            }
+
             Flush(SLL::VerbosityLevel::FATAL);
         }
         catch ( const std::exception& )
@@ -491,6 +723,7 @@ namespace SLL
         LoggerBase::operator=(std::move(src));
         src.mStream.set_rdbuf(nullptr);
         mpUTF16StreamBuffer = std::move(src.mpUTF16StreamBuffer);
+        mpCoalescing = std::move(src.mpCoalescing);
 
         return *this;
     }
@@ -507,6 +740,7 @@ namespace SLL
         LoggerBase::operator=(std::move(src));
         mStream = std::move(src.mStream);
         mpUTF16StreamBuffer = std::move(src.mpUTF16StreamBuffer);
+        mpCoalescing = std::move(src.mpCoalescing);
 
         return *this;
     }
@@ -530,7 +764,7 @@ namespace SLL
         va_start(pArgs, pFormat);
         try
         {
-            ret = LogInternal(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+            ret = LogInternal(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs);
         }
         catch ( const std::exception& )
         {
@@ -551,7 +785,7 @@ namespace SLL
         va_start(pArgs, pFormat);
         try
         {
-            ret = LogInternal(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+            ret = LogInternal(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs);
         }
         catch ( const std::exception& )
         {
@@ -572,7 +806,7 @@ namespace SLL
         va_start(pArgs, pFormat);
         try
         {
-            ret = LogInternal(lvl, tid, pFormat, pArgs);
+            ret = LogInternal(lvl, tid, LogClock::now( ), pFormat, pArgs);
         }
         catch ( const std::exception& )
         {
@@ -593,7 +827,7 @@ namespace SLL
         va_start(pArgs, pFormat);
         try
         {
-            ret = LogInternal(lvl, tid, pFormat, pArgs);
+            ret = LogInternal(lvl, tid, LogClock::now( ), pFormat, pArgs);
         }
         catch ( const std::exception& )
         {
@@ -609,28 +843,144 @@ namespace SLL
     template <class StreamType>
     bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_z_ _Printf_format_string_ const utf8* pFormat, _In_ va_list pArgs) const
     {
-        return LogInternal(lvl, std::this_thread::get_id( ), pFormat, pArgs);
+        return LogInternal(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat, pArgs);
     }
 
     // Submit log message to stream(s) (va_list, wide).
     template <class StreamType>
     bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_z_ _Printf_format_string_  const utf16* pFormat, _In_ va_list pArgs) const
     {
-        return LogInternal(lvl, std::this_thread::get_id( ), pFormat , pArgs);
+        return LogInternal(lvl, std::this_thread::get_id( ), LogClock::now( ), pFormat , pArgs);
     }
 
     // Submit log message to stream(s) (va_list, narrow, explicit thread ID).
     template <class StreamType>
     bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_z_ _Printf_format_string_ const utf8* pFormat, _In_ va_list pArgs) const
     {
-        return LogInternal(lvl, tid, pFormat, pArgs);
+        return LogInternal(lvl, tid, LogClock::now( ), pFormat, pArgs);
     }
 
     // Submit log message to stream(s) (va_list, wide, explicit thread ID).
     template <class StreamType>
     bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_z_ _Printf_format_string_ const utf16* pFormat, _In_ va_list pArgs) const
     {
-        return LogInternal(lvl, tid, pFormat, pArgs);
+        return LogInternal(lvl, tid, LogClock::now( ), pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (variadic arguments, narrow, explicit thread ID and event time).
+    template <class StreamType>
+    bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf8* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+        try
+        {
+            ret = LogInternal(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (variadic arguments, wide, explicit thread ID and event time).
+    template <class StreamType>
+    bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf16* pFormat, ...) const
+    {
+        bool ret = false;
+        va_list pArgs;
+        va_start(pArgs, pFormat);
+        try
+        {
+            ret = LogInternal(lvl, tid, time, pFormat, pArgs);
+        }
+        catch ( const std::exception& )
+        {
+            va_end(pArgs);
+            throw;
+        }
+
+        va_end(pArgs);
+        return ret;
+    }
+
+    // Submit log message to stream(s) (va_list, narrow, explicit thread ID and event time).
+    template <class StreamType>
+    bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf8* pFormat, _In_ va_list pArgs) const
+    {
+        return LogInternal(lvl, tid, time, pFormat, pArgs);
+    }
+
+    // Submit log message to stream(s) (va_list, wide, explicit thread ID and event time).
+    template <class StreamType>
+    bool StreamLogger<StreamType>::Log(_In_ const VerbosityLevel& lvl, _In_ const std::thread::id& tid, _In_ const LogTime& time, _In_z_ _Printf_format_string_ const utf16* pFormat, _In_ va_list pArgs) const
+    {
+        return LogInternal(lvl, tid, time, pFormat, pArgs);
+    }
+
+    // Submit pre-formatted log record to stream - message text is written as-is.
+    template <class StreamType>
+    bool StreamLogger<StreamType>::WriteRecord(_In_ const LogRecord& record) const
+    {
+        // Ensure verbosity level is valid.
+        if ( record.lvl < VerbosityLevel::BEGIN || record.lvl >= VerbosityLevel::MAX )
+        {
+            throw std::invalid_argument(
+                __FUNCTION__" - Invalid verbosity level argument (" +
+                std::to_string(static_cast<VerbosityLevelType>(record.lvl)) +
+                ")."
+            );
+        }
+
+        // Don't log if message level is below the configured verbosity threshold.
+        if ( record.lvl < GetConfig( ).GetVerbosityThreshold( ) )
+        {
+            mStats.Add(StatCounters::Counter::Filtered);
+            return true;
+        }
+
+        mStats.Add(StatCounters::Counter::Accepted);
+
+        // Check if the stream is still open and in a good state, attempt to recover if not.
+        if ( !IsStreamGood( ) && !RestoreStream( ) )
+        {
+            mStats.Add(StatCounters::Counter::Failed);
+            return false;
+        }
+
+        // Repeats are counted rather than written.
+        if ( mpCoalescing && !CoalesceRecord(record, nullptr, nullptr, true) )
+        {
+            return true;
+        }
+
+        return WriteText(record);
+    }
+
+    // Force any buffered log messages out to stream.
+    // - Note: Coalescing summaries are only written here once they're due, so repeats are still coalesced across flushes.
+    template <class StreamType>
+    bool StreamLogger<StreamType>::Flush( ) const
+    {
+        if ( !IsStreamGood( ) )
+        {
+            return false;
+        }
+
+        if ( mpCoalescing )
+        {
+            WriteDueSummaries(false);
+        }
+
+        mStream.flush( );
+        mStats.Add(StatCounters::Counter::Flushes);
+
+        return IsStreamGood( );
     }
 
     /// Explicit Template Instantiations \\\
@@ -664,4 +1014,30 @@ namespace SLL
     template bool StdOutLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const;
     template bool FileLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf8* pFormat, va_list pArgs) const;
     template bool FileLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const utf16* pFormat, va_list pArgs) const;
+
+    // Log Instantiations - Variadic Arguments, Explicit Thread ID and Event Time
+    template bool StdOutLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, ...) const;
+    template bool StdOutLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, ...) const;
+    template bool FileLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, ...) const;
+    template bool FileLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, ...) const;
+
+    // Log Instantiations - va_list, Explicit Thread ID and Event Time
+    template bool StdOutLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const;
+    template bool StdOutLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const;
+    template bool FileLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf8* pFormat, va_list pArgs) const;
+    template bool FileLogger::Log(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const utf16* pFormat, va_list pArgs) const;
+
+    // LogInternal Instantiations - Caller-Stamped Sequence Number (used by DualLogger)
+    template bool StdOutLogger::LogInternal(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const std::optional<uint64_t>& seq, const utf8* pFormat, va_list pArgs) const;
+    template bool StdOutLogger::LogInternal(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const std::optional<uint64_t>& seq, const utf16* pFormat, va_list pArgs) const;
+    template bool FileLogger::LogInternal(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const std::optional<uint64_t>& seq, const utf8* pFormat, va_list pArgs) const;
+    template bool FileLogger::LogInternal(const VerbosityLevel& lvl, const std::thread::id& tid, const LogTime& time, const std::optional<uint64_t>& seq, const utf16* pFormat, va_list pArgs) const;
+
+    // WriteRecord Instantiations
+    template bool StdOutLogger::WriteRecord(const LogRecord& record) const;
+    template bool FileLogger::WriteRecord(const LogRecord& record) const;
+
+    // Flush Instantiations
+    template bool StdOutLogger::Flush( ) const;
+    template bool FileLogger::Flush( ) const;
 }
\ No newline at end of file
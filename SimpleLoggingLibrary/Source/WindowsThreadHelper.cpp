@@ -0,0 +1,29 @@
+// For thread affinity, priority and naming.
+#include <Windows.h>
+
+// Class Declaration
+#include <WindowsThreadHelper.h>
+
+namespace SLL
+{
+    /// Static Public Methods \\\
+
+    // Restrict the calling thread to the CPUs in affinityMask (bit N == CPU N).  Returns false on failure.
+    // - Note: Only covers the calling thread's processor group (the first 64 CPUs).
+    bool WindowsThreadHelper::SetCurrentThreadAffinity(const uint64_t affinityMask)
+    {
+        return ::SetThreadAffinityMask(::GetCurrentThread( ), static_cast<DWORD_PTR>(affinityMask)) != 0;
+    }
+
+    // Set the calling thread's priority (THREAD_PRIORITY_* value).  Returns false on failure.
+    bool WindowsThreadHelper::SetCurrentThreadPriority(const int priority)
+    {
+        return ::SetThreadPriority(::GetCurrentThread( ), priority) != FALSE;
+    }
+
+    // Name the calling thread.  Returns false on failure.
+    bool WindowsThreadHelper::SetCurrentThreadName(const std::basic_string<utf16>& name)
+    {
+        return SUCCEEDED(::SetThreadDescription(::GetCurrentThread( ), name.c_str( )));
+    }
+}
\ No newline at end of file
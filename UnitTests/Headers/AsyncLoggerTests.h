@@ -13,5 +13,77 @@ namespace AsyncLoggerTests
     {
         template <class T>
         UnitTestResult LogAsynchronously( );
+
+        template <class T>
+        UnitTestResult LogAsynchronouslyBatched( );
+
+        template <class T>
+        UnitTestResult LogAsynchronouslyDeferred( );
+
+        template <class T>
+        UnitTestResult LogAsynchronouslyPooled( );
+
+        UnitTestResult SharedPoolManyLoggers( );
+
+        UnitTestResult LogOnCustomExecutor( );
+
+        UnitTestResult DeferredFormatMatchesImmediate( );
+
+        UnitTestResult TimestampCapturedAtCallSite( );
+
+        UnitTestResult PriorityLaneBypassesBacklog( );
+
+        UnitTestResult QueueFullDropsWithoutSpillFile( );
+
+        UnitTestResult QueueFullSpillsToDisk( );
+
+        UnitTestResult QueueFullSpillsFromManyThreads( );
+
+        UnitTestResult SpillFileNotShared( );
+
+        UnitTestResult StartAndShutdown( );
+
+        UnitTestResult ShutdownDeadlineDiscards( );
+
+        UnitTestResult WorkerThreadSettings( );
+
+        UnitTestResult NumaProducersBenchmark( );
+
+        UnitTestResult PrefaultedLargePageQueues( );
+
+        UnitTestResult ReserveAndCommit( );
+
+        UnitTestResult ThreadStagingHandOff( );
+
+        UnitTestResult GetStatsCounts( );
+
+        UnitTestResult FlushCounts( );
+
+        UnitTestResult SinkDeliveryQueue( );
+        UnitTestResult LatencyHistograms( );
+        UnitTestResult MemoryBudgetShedding( );
+        UnitTestResult RateLimitedCallSites( );
+        UnitTestResult CoalesceRepeatsOnWorker( );
+        UnitTestResult CoalesceByFormatOnWorker( );
+
+        UnitTestResult DrainOnCrashRegistration( );
+
+        UnitTestResult LogSignalSafe( );
+
+        UnitTestResult LogSignalSafeFromHandler( );
+
+        UnitTestResult FlushNothingQueued( );
+
+        UnitTestResult FlushAsyncIgnoresBatchLatency( );
+
+        UnitTestResult FlushTimeout( );
+
+        UnitTestResult FlushAsyncCallback( );
+
+        UnitTestResult LogAsyncCallback( );
+
+        UnitTestResult LogAsyncNotDurable( );
+
+        UnitTestResult SteadyStateNoAllocations( );
     }
 }
\ No newline at end of file
@@ -100,4 +100,210 @@ namespace ConfigPackageTests
 
         UnitTestResult ValidVerbosityLevel( );
     }
+
+    namespace SetAsyncBatchLatency
+    {
+        /// Negative Test \\\
+
+        UnitTestResult NegativeLatency( );
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidLatency( );
+    }
+
+    namespace SetAsyncBatchSize
+    {
+        /// Negative Test \\\
+
+        UnitTestResult ZeroSize( );
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidSize( );
+    }
+
+    namespace SetAsyncExecutor
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoExecutor( );
+        UnitTestResult SharedExecutor( );
+    }
+
+    namespace SetAsyncDrainOnCrash
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetAsyncSignalSafeCapacity
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult ValidCapacity( );
+    }
+
+    namespace SetAsyncQueueCapacity
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultUnbounded( );
+        UnitTestResult ValidCapacity( );
+    }
+
+    namespace SetAsyncSpillFile
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoSpillFile( );
+        UnitTestResult ValidFile( );
+    }
+
+    namespace SetAsyncEagerStart
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetAsyncWorkerAffinity
+    {
+        /// Negative Test \\\
+
+        UnitTestResult MaskBeyondPointerWidth( );
+
+
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultAnyCPU( );
+        UnitTestResult ValidMask( );
+    }
+
+    namespace SetAsyncWorkerPriority
+    {
+        /// Negative Test \\\
+
+        UnitTestResult InvalidPriority( );
+
+
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNormal( );
+        UnitTestResult ValidPriority( );
+    }
+
+    namespace SetAsyncWorkerName
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultUnnamed( );
+        UnitTestResult ValidName( );
+    }
+
+    namespace SetAsyncNumaAware
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetAsyncLargePages
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetAsyncPrefaultMemory
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetAsyncThreadStagingSize
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult ValidSize( );
+    }
+
+    namespace SetAsyncSinkQueueCapacity
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult ValidCapacity( );
+    }
+
+    namespace SetAsyncSinkBlockWhenFull
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetAsyncLatencyHistograms
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetAsyncLatencySummaryInterval
+    {
+        /// Negative Test \\\
+
+        UnitTestResult NegativeInterval( );
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidInterval( );
+    }
+
+    namespace SetAsyncMemoryBudget
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoBudget( );
+        UnitTestResult SharedBudget( );
+    }
+
+    namespace SetCoalesceWindow
+    {
+        /// Negative Test \\\
+
+        UnitTestResult NegativeWindow( );
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidWindow( );
+    }
+
+    namespace SetCoalesceByFormat
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( );
+        UnitTestResult EnableDisable( );
+    }
+
+    namespace SetRateLimiter
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoLimiter( );
+        UnitTestResult SharedLimiter( );
+    }
 }
\ No newline at end of file
@@ -41,4 +41,22 @@ namespace DualLoggerTests
         UnitTestResult GetFileLoggerConfig( );
         UnitTestResult GetStdOutLoggerConfig( );
     }
+
+    namespace RateLimit
+    {
+        /// Negative Tests \\\
+
+        UnitTestResult MismatchedLimiters( );
+
+        /// Positive Tests \\\
+
+        UnitTestResult LimitedOncePerMessage( );
+    }
+
+    namespace SequenceNumber
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult SharedAcrossStreams( );
+    }
 }
\ No newline at end of file
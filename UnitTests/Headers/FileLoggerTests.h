@@ -3,6 +3,9 @@
 // Target Class - FileLogger specialization.
 #include <StreamLogger.h>
 
+// Call-Site Rate Limiting
+#include <RateLimiter.h>
+
 // LoggerBase - Helper Functions and Macros
 #include <LoggerBaseTests.h>
 
@@ -155,6 +158,48 @@ namespace FileLoggerTests
         template <class T>
         UnitTestResult AppendFileWrite( );
     }
+
+    namespace WriteRecord
+    {
+        /// Negative Tests \\\
+
+        UnitTestResult BadVerbosityLevel( );
+
+        /// Positive Tests \\\
+
+        UnitTestResult NoLogBelowThreshold( );
+        UnitTestResult RawMessage( );
+    }
+
+    namespace GetStats
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult CountsMessages( );
+    }
+
+    namespace Coalesce
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult RepeatedMessages( );
+        UnitTestResult ByFormatString( );
+    }
+
+    namespace RateLimit
+    {
+        /// Negative Tests \\\
+
+        UnitTestResult InvalidSiteCapacity( );
+
+
+        /// Positive Tests \\\
+
+        UnitTestResult SampledCallSite( );
+        UnitTestResult TokenBucket( );
+        UnitTestResult ResetStartsOver( );
+        UnitTestResult SitesBeyondTable( );
+    }
 }
 
 
@@ -240,7 +285,8 @@ namespace StreamLoggerTests
         {
             std::make_tuple(SLL::OptionFlag::LogTimestamp, LoggerBaseTests::IsTimePrefix<T>, 24),
             std::make_tuple(SLL::OptionFlag::LogThreadID, LoggerBaseTests::IsThreadIDPrefix<T>, 16),
-            std::make_tuple(SLL::OptionFlag::LogVerbosityLevel, LoggerBaseTests::IsVerbosityLevelPrefix<T>, 14)
+            std::make_tuple(SLL::OptionFlag::LogVerbosityLevel, LoggerBaseTests::IsVerbosityLevelPrefix<T>, 14),
+            std::make_tuple(SLL::OptionFlag::LogSequenceNumber, LoggerBaseTests::IsSequenceNumberPrefix<T>, 24)
         };
 
         // Check to see if there's any work to do.
@@ -104,6 +104,9 @@ namespace LoggerBaseTests
         template <class T>
         UnitTestResult VerbosityLevelOnly( );
 
+        template <class T>
+        UnitTestResult SequenceNumberOnly( );
+
         template <class T>
         UnitTestResult Time_ThreadID( );
 
@@ -305,6 +308,33 @@ namespace LoggerBaseTests
         // String end (10 - 13).
         return (str[10] == T(']') && IsSpace<T>(str[11]) && IsSpace<T>(str[12]) && str[13] == T('\0'));
     }
+
+    template <class T>
+    inline bool IsSequenceNumberPrefix(const std::unique_ptr<T[ ]>& str)
+    {
+        if ( !str )
+        {
+            return false;
+        }
+
+        // SEQ Prefix (0 - 3)
+        if ( !(str[0] == T('S') && str[1] == T('E') && str[2] == T('Q') && str[3] == T('[')) )
+        {
+            return false;
+        }
+
+        // Sequence Number - Hexademical Digits (4 - 19)
+        for ( size_t c = 0; c < 16; c++ )
+        {
+            if ( !IsHex<T>(str[c + 4]) || str[c + 4] == T('\0') )
+            {
+                return false;
+            }
+        }
+
+        // String end (20 - 23).
+        return (str[20] == T(']') && IsSpace<T>(str[21]) && IsSpace<T>(str[22]) && str[23] == T('\0'));
+    }
 }
 
 namespace LoggerBaseTests
@@ -477,9 +507,9 @@ namespace LoggerBaseTests
 
         // Wrapper for BuildMessagePrefixes.
         template <class T, ENABLE_IF_SUPPORTED_CHARACTER_TYPE(T)>
-        std::vector<std::unique_ptr<T[ ]>> BuildMessagePrefixes(const SLL::VerbosityLevel& lvl, const std::thread::id& tid) const
+        std::vector<std::unique_ptr<T[ ]>> BuildMessagePrefixes(const SLL::VerbosityLevel& lvl, const std::thread::id& tid, const uint64_t seq = 0) const
         {
-            return LoggerBase::BuildMessagePrefixes<T>(lvl, tid);
+            return LoggerBase::BuildMessagePrefixes<T>(lvl, tid, SLL::LogClock::now( ), seq);
         }
     };
 }
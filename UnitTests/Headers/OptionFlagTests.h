@@ -30,6 +30,9 @@ namespace OptionFlagTests
     UnitTestResult LeftShiftAssign( );
     UnitTestResult RightShiftAssign( );
 
+    // Range Tests
+    UnitTestResult RangesMatchMasks( );
+
     // Conversion Tests
     namespace ConverterTests
     { 
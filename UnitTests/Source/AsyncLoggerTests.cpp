@@ -1,8 +1,23 @@
 #include <AsyncLoggerTests.h>
 
 #include <AsyncLogger.h>
+#include <AsyncWorkerPool.h>
+#include <CrashDrain.h>
+#include <MemoryBudget.h>
+#include <NumaHelper.h>
+#include <RateLimiter.h>
+#include <WindowsThreadHelper.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <crtdbg.h>
+#include <csignal>
+#include <cstdlib>
+#include <deque>
 #include <future>
+#include <iomanip>
+#include <sstream>
 
 #include <FileLoggerTests.h>
 
@@ -13,12 +28,90 @@ namespace AsyncLoggerTests
     using SLL::VerbosityLevel;
     using SLL::AsyncLogger;
 
+    namespace AllocationTracking
+    {
+        // Thread whose heap allocations are counted, and how many it has made.
+        std::atomic<std::thread::id> s_countedThread;
+        std::atomic<size_t> s_allocationCount(0);
+
+        // CRT allocation hook - only called by the debug CRT, and must not allocate itself.
+        // Returns non-zero so the allocation goes ahead.
+        int __cdecl CountAllocations(int allocType, void*, size_t, int, long, const unsigned char*, int)
+        {
+            if ( (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC) && std::this_thread::get_id( ) == s_countedThread.load( ) )
+            {
+                s_allocationCount++;
+            }
+
+            return 1;
+        }
+    }
+
     std::list<std::function<UnitTestResult(void)>> GetTests( )
     {
         static const std::list<std::function<UnitTestResult(void)>> testList
         {
             Log::LogAsynchronously<utf8>,
-            Log::LogAsynchronously<utf16>
+            Log::LogAsynchronously<utf16>,
+
+            Log::LogAsynchronouslyBatched<utf8>,
+            Log::LogAsynchronouslyBatched<utf16>,
+
+            Log::LogAsynchronouslyDeferred<utf8>,
+            Log::LogAsynchronouslyDeferred<utf16>,
+
+            Log::LogAsynchronouslyPooled<utf8>,
+            Log::LogAsynchronouslyPooled<utf16>,
+
+            Log::SharedPoolManyLoggers,
+
+            Log::LogOnCustomExecutor,
+
+            Log::DeferredFormatMatchesImmediate,
+
+            Log::TimestampCapturedAtCallSite,
+
+            Log::PriorityLaneBypassesBacklog,
+
+            Log::QueueFullDropsWithoutSpillFile,
+            Log::QueueFullSpillsToDisk,
+            Log::QueueFullSpillsFromManyThreads,
+            Log::SpillFileNotShared,
+
+            Log::StartAndShutdown,
+            Log::ShutdownDeadlineDiscards,
+
+            Log::WorkerThreadSettings,
+
+            Log::NumaProducersBenchmark,
+
+            Log::PrefaultedLargePageQueues,
+
+            Log::ReserveAndCommit,
+
+            Log::ThreadStagingHandOff,
+            Log::GetStatsCounts,
+            Log::FlushCounts,
+            Log::SinkDeliveryQueue,
+            Log::LatencyHistograms,
+            Log::MemoryBudgetShedding,
+            Log::RateLimitedCallSites,
+            Log::CoalesceRepeatsOnWorker,
+            Log::CoalesceByFormatOnWorker,
+
+            Log::DrainOnCrashRegistration,
+
+            Log::LogSignalSafe,
+            Log::LogSignalSafeFromHandler,
+
+            Log::FlushNothingQueued,
+            Log::FlushAsyncIgnoresBatchLatency,
+            Log::FlushTimeout,
+            Log::FlushAsyncCallback,
+            Log::LogAsyncCallback,
+            Log::LogAsyncNotDurable,
+
+            Log::SteadyStateNoAllocations
         };
 
         return testList;
@@ -43,6 +136,21 @@ namespace AsyncLoggerTests
             return str;
         }
 
+        std::basic_string<utf16> BuildTimePrefix(const std::chrono::system_clock::time_point& time)
+        {
+            std::basic_ostringstream<utf16> oss;
+            const std::time_t t = std::chrono::system_clock::to_time_t(time);
+            std::tm tm;
+
+            if ( localtime_s(&tm, &t) != 0 )
+            {
+                throw std::runtime_error(__FUNCTION__" - Failed to obtain local-time.");
+            }
+
+            oss << std::put_time<utf16>(&tm, UTF16_LITERAL_STR("[%D - %T]"));
+            return oss.str( );
+        }
+
         bool AllMessagesInFile(const std::filesystem::path& fileName)
         {
             // Substrings that we want to search for.
@@ -90,19 +198,88 @@ namespace AsyncLoggerTests
             return msgMask == std::numeric_limits<unsigned long long>::max( );
         }
 
+        // Minimal single-threaded event loop, standing in for a caller-supplied executor.
+        class TestExecutor : public SLL::IAsyncExecutor
+        {
+            std::thread mThread;
+            std::mutex mMutex;
+            std::condition_variable mCV;
+            std::deque<std::function<void( )>> mWork;
+            bool mTerminate;
+            std::atomic<size_t> mPostCount;
+
+            void Loop( )
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+
+                while ( true )
+                {
+                    mCV.wait(lock, [this] ( ) -> bool
+                    {
+                        return mTerminate || !mWork.empty( );
+                    });
+
+                    if ( mWork.empty( ) )
+                    {
+                        break;
+                    }
+
+                    std::function<void( )> work = std::move(mWork.front( ));
+                    mWork.pop_front( );
+
+                    lock.unlock( );
+                    work( );
+                    lock.lock( );
+                }
+            }
+
+        public:
+            TestExecutor( ) :
+                mTerminate(false),
+                mPostCount(0)
+            {
+                mThread = std::thread(&TestExecutor::Loop, this);
+            }
+
+            ~TestExecutor( )
+            {
+                {
+                    std::lock_guard<std::mutex> lg(mMutex);
+                    mTerminate = true;
+                    mCV.notify_one( );
+                }
+
+                mThread.join( );
+            }
+
+            size_t GetPostCount( ) const noexcept
+            {
+                return mPostCount;
+            }
+
+            void Post(std::function<void( )> work) override
+            {
+                std::lock_guard<std::mutex> lg(mMutex);
+                mWork.push_back(std::move(work));
+                mPostCount++;
+                mCV.notify_one( );
+            }
+
+            // No timers - run it right away.
+            void PostAfter(const std::chrono::microseconds&, std::function<void( )> work) override
+            {
+                Post(std::move(work));
+            }
+        };
+
         template <class T>
-        UnitTestResult LogAsynchronously( )
+        UnitTestResult LogAsynchronouslyWithConfig(const ConfigPackage& config)
         {
             std::unique_ptr<AsyncLogger> pLogger;
             std::vector<std::future<bool>> threads;
 
-            // Setup the configuration package for AsyncLogger.
-            ConfigPackage config;
-            config.Enable(OptionFlag::PREFIX_MASK | OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogInColor);
-            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
-
             // Lambda function that the threads we kick off will execute.
-            static const auto asyncLog = [&pLogger] (size_t num) -> bool
+            const auto asyncLog = [&pLogger] (size_t num) -> bool
             {
                 if constexpr ( std::is_same_v<T, utf8> )
                 {
@@ -147,13 +324,2232 @@ namespace AsyncLoggerTests
                 SUTL_TEST_ASSERT(results.get( ));
             }
 
-            // Cleanup AsyncLogger object.
-            // This will wait on pLogger's worker thread to exit.
-            pLogger.reset( );
+            // Wait for every submitted message to be written out.
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
 
             // Make sure all messages made it to the log file.
             SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
 
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        template <class T>
+        UnitTestResult LogAsynchronously( )
+        {
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::PREFIX_MASK | OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogInColor);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            return LogAsynchronouslyWithConfig<T>(config);
+        }
+
+        template <class T>
+        UnitTestResult LogAsynchronouslyBatched( )
+        {
+            // Setup the configuration package for AsyncLogger - small batches, short latency target.
+            ConfigPackage config;
+            config.Enable(OptionFlag::PREFIX_MASK | OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::milliseconds(1));
+            config.SetAsyncBatchSize(8);
+
+            return LogAsynchronouslyWithConfig<T>(config);
+        }
+
+        template <class T>
+        UnitTestResult LogAsynchronouslyDeferred( )
+        {
+            // Setup the configuration package for AsyncLogger - format on the worker thread.
+            ConfigPackage config;
+            config.Enable(OptionFlag::PREFIX_MASK | OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogDeferredFormat);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            return LogAsynchronouslyWithConfig<T>(config);
+        }
+
+        template <class T>
+        UnitTestResult LogAsynchronouslyPooled( )
+        {
+            // Setup the configuration package for AsyncLogger - run on a shared pool, with batching.
+            ConfigPackage config;
+            config.Enable(OptionFlag::PREFIX_MASK | OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::milliseconds(1));
+            config.SetAsyncBatchSize(8);
+
+            try
+            {
+                config.SetAsyncExecutor(std::make_shared<SLL::AsyncWorkerPool>(2));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            return LogAsynchronouslyWithConfig<T>(config);
+        }
+
+        UnitTestResult SharedPoolManyLoggers( )
+        {
+            static const size_t loggerCount = 8;
+
+            std::shared_ptr<SLL::AsyncWorkerPool> pPool;
+            std::vector<std::unique_ptr<AsyncLogger>> loggers;
+            std::vector<std::filesystem::path> files;
+            std::vector<std::future<bool>> producers;
+
+            // Each producer fills its own logger with 64 numbered messages.
+            const auto logAll = [ ] (const AsyncLogger* pLogger) -> bool
+            {
+                bool ret = true;
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    ret &= pLogger->Log(VerbosityLevel::INFO, "Test log message (#%zu).", i);
+                }
+
+                return ret;
+            };
+
+            // Many loggers, two workers - the loggers must share.
+            try
+            {
+                pPool = std::make_shared<SLL::AsyncWorkerPool>(2);
+
+                for ( size_t i = 0; i < loggerCount; i++ )
+                {
+                    ConfigPackage config;
+                    config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+                    config.SetFile(std::filesystem::current_path( ) / ("test_file_" + std::to_string(i) + ".log"));
+                    config.SetAsyncBatchSize(4);
+                    config.SetAsyncExecutor(pPool);
+
+                    files.push_back(config.GetFile( ));
+                    loggers.push_back(std::make_unique<AsyncLogger>(config));
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_SETUP_ASSERT(pPool->GetWorkerCount( ) == 2);
+
+            try
+            {
+                for ( const auto& pLogger : loggers )
+                {
+                    producers.push_back(std::async(std::launch::async, logAll, pLogger.get( )));
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            for ( auto& result : producers )
+            {
+                SUTL_TEST_ASSERT(result.get( ));
+            }
+
+            // Every logger's messages should have been written by the shared workers.
+            for ( size_t i = 0; i < loggerCount; i++ )
+            {
+                SUTL_TEST_ASSERT(loggers[i]->Flush( ));
+                SUTL_TEST_ASSERT(AllMessagesInFile(files[i]));
+            }
+
+            // Cleanup AsyncLogger objects, then the pool.
+            loggers.clear( );
+            pPool.reset( );
+
+            // Attempt to cleanup test log files.
+            for ( const auto& f : files )
+            {
+                SUTL_CLEANUP_ASSERT(std::filesystem::remove(f));
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult LogOnCustomExecutor( )
+        {
+            std::shared_ptr<TestExecutor> pExecutor;
+
+            // Setup the configuration package for AsyncLogger - run on the caller's executor, with batching.
+            ConfigPackage config;
+            config.Enable(OptionFlag::PREFIX_MASK | OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::milliseconds(1));
+            config.SetAsyncBatchSize(8);
+
+            try
+            {
+                pExecutor = std::make_shared<TestExecutor>( );
+                config.SetAsyncExecutor(pExecutor);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            const UnitTestResult result = LogAsynchronouslyWithConfig<utf8>(config);
+
+            // The writing should have been done by passes posted to our executor.
+            SUTL_TEST_ASSERT(pExecutor->GetPostCount( ) != 0);
+
+            return result;
+        }
+
+        UnitTestResult DeferredFormatMatchesImmediate( )
+        {
+            static const utf16* wideFormat = UTF16_LITERAL_STR("[%5d|%-8ls|%hs|%.3f|%zu|%*lld|%c|%p|%%]");
+            static const utf8* narrowFormat = "[%5d|%-8ls|%hs|%.3f|%zu|%*lld|%c|%p|%%]";
+            static const utf16* wideArg = UTF16_LITERAL_STR("wide");
+            static const utf8* narrowArg = "narrow";
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> expected;
+            std::basic_string<utf16> fileContents;
+            const void* pArg = &expected;
+            bool logged = false;
+
+            // Setup the configuration package for AsyncLogger - no prefixes, so the file holds just the messages.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogDeferredFormat);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            // What the immediate (non-deferred) formatting path would have produced.
+            expected.resize(256);
+            const int expectedLen = swprintf(
+                reinterpret_cast<wchar_t*>(&expected[0]),
+                expected.size( ),
+                reinterpret_cast<const wchar_t*>(wideFormat),
+                -42, wideArg, narrowArg, 3.14159, static_cast<size_t>(7), 10, -1234567ll, L'x', pArg
+            );
+
+            SUTL_SETUP_ASSERT(expectedLen > 0);
+            expected.resize(static_cast<size_t>(expectedLen));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                // Log the same message via both the wide and narrow format paths.
+                logged = pLogger->Log(VerbosityLevel::INFO, wideFormat, -42, wideArg, narrowArg, 3.14159, static_cast<size_t>(7), 10, -1234567ll, L'x', pArg);
+                logged &= pLogger->Log(VerbosityLevel::INFO, narrowFormat, -42, wideArg, narrowArg, 3.14159, static_cast<size_t>(7), 10, -1234567ll, L'x', pArg);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+
+            // Both messages should come out exactly as the immediate path would have written them.
+            fileContents = ReadFile(config.GetFile( ));
+            SUTL_TEST_ASSERT(fileContents.compare(0, expected.size( ) * 2, expected + expected) == 0);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult TimestampCapturedAtCallSite( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            std::basic_string<utf16> before;
+            std::basic_string<utf16> after;
+            bool logged = false;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: The long latency target holds the message in the queue well past the call.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogTimestamp);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(3));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                before = BuildTimePrefix(std::chrono::system_clock::now( ));
+                logged = pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Timestamp test message."));
+                after = BuildTimePrefix(std::chrono::system_clock::now( ));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Let the wall-clock move on while the message sits in the queue.
+            std::this_thread::sleep_for(std::chrono::seconds(2));
+
+            // Have the worker write the message out now, two seconds after the call.
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+
+            // The prefix should show when Log was called, not when the worker got around to writing it.
+            fileContents = ReadFile(config.GetFile( ));
+            SUTL_TEST_ASSERT(fileContents.find(before) == 0 || fileContents.find(after) == 0);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult PriorityLaneBypassesBacklog( )
+        {
+            static const utf16* fatalMsg = UTF16_LITERAL_STR("Fatal test message.");
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            std::vector<std::basic_string<utf16>> lines;
+            std::basic_string<utf16> line;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: The long latency target holds the INFO backlog in the queue for the whole test.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogSequenceNumber);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+
+                logged &= pLogger->Log(VerbosityLevel::FATAL, fatalMsg);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+
+            // The FATAL message should be written (and flushed) without waiting on the backlog or the latency target.
+            const auto deadline = std::chrono::steady_clock::now( ) + std::chrono::seconds(10);
+            while ( (fileContents = ReadFile(config.GetFile( ))).find(fatalMsg) == std::basic_string<utf16>::npos && std::chrono::steady_clock::now( ) < deadline )
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+
+            SUTL_TEST_ASSERT(fileContents.find(fatalMsg) != std::basic_string<utf16>::npos);
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("(#")) == std::basic_string<utf16>::npos);
+
+            // Write out the backlog.
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            std::basic_ifstream<utf16> file(config.GetFile( ));
+            while ( std::getline(file, line) )
+            {
+                if ( !line.empty( ) )
+                {
+                    lines.push_back(line);
+                }
+            }
+
+            SUTL_TEST_ASSERT(lines.size( ) == 65);
+            SUTL_TEST_ASSERT(lines.front( ).find(fatalMsg) != std::basic_string<utf16>::npos);
+
+            // FATAL was written first, but its sequence number (SEQ[%016llX]) still shows it was submitted last.
+            try
+            {
+                const unsigned long long fatalSeq = std::stoull(lines.front( ).substr(4, 16), nullptr, 16);
+                unsigned long long prevSeq = 0;
+
+                for ( size_t i = 1; i < lines.size( ); i++ )
+                {
+                    const unsigned long long seq = std::stoull(lines[i].substr(4, 16), nullptr, 16);
+
+                    SUTL_TEST_ASSERT(seq < fatalSeq);
+                    SUTL_TEST_ASSERT(i == 1 || seq > prevSeq);
+
+                    prevSeq = seq;
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult QueueFullDropsWithoutSpillFile( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            size_t loggedCount = 0;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: The long latency target holds the queue full for the whole test.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+            config.SetAsyncQueueCapacity(8);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    if ( pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i) )
+                    {
+                        loggedCount++;
+                    }
+                }
+
+                // Priority messages are never dropped.
+                SUTL_TEST_ASSERT(pLogger->Log(VerbosityLevel::ERROR, UTF16_LITERAL_STR("Error test message.")));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Only the first queue-full of messages should have been accepted.
+            SUTL_TEST_ASSERT(loggedCount == 8);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult QueueFullSpillsToDisk( )
+        {
+            static const std::filesystem::path spillFile(std::filesystem::current_path( ) / L"test_spill.bin");
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::vector<std::basic_string<utf16>> lines;
+            std::basic_string<utf16> line;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: The queue only holds a fraction of the messages - the rest have to go through the spill file.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogSequenceNumber);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+            config.SetAsyncQueueCapacity(8);
+            config.SetAsyncSpillFile(spillFile);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Nothing should have been dropped.
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(std::filesystem::exists(spillFile));
+
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            // Spilled messages should have been written after the in-memory ones, in submission order.
+            std::basic_ifstream<utf16> file(config.GetFile( ));
+            while ( std::getline(file, line) )
+            {
+                if ( !line.empty( ) )
+                {
+                    lines.push_back(line);
+                }
+            }
+
+            file.close( );
+
+            SUTL_TEST_ASSERT(lines.size( ) == 64);
+
+            try
+            {
+                unsigned long long prevSeq = 0;
+
+                for ( size_t i = 0; i < lines.size( ); i++ )
+                {
+                    const unsigned long long seq = std::stoull(lines[i].substr(4, 16), nullptr, 16);
+
+                    SUTL_TEST_ASSERT(i == 0 || seq > prevSeq);
+                    SUTL_TEST_ASSERT(lines[i].find(UTF16_LITERAL_STR("(#") + std::to_wstring(i) + UTF16_LITERAL_STR(")")) != std::basic_string<utf16>::npos);
+
+                    prevSeq = seq;
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Cleanup AsyncLogger object - the spill file goes with it.
+            pLogger.reset( );
+            SUTL_TEST_ASSERT(!std::filesystem::exists(spillFile));
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult QueueFullSpillsFromManyThreads( )
+        {
+            static const std::filesystem::path spillFile(std::filesystem::current_path( ) / L"test_spill.bin");
+            static const size_t threadCount = 4;
+            static const size_t msgsPerThread = 256;
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::vector<unsigned long long> seqs;
+            std::basic_string<utf16> line;
+            std::atomic<size_t> logged = 0;
+            SLL::LogStats stats;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: Producers append spilled messages to the file outside the queue lock, racing each other and the worker's replay.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogSequenceNumber);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncQueueCapacity(8);
+            config.SetAsyncSpillFile(spillFile);
+
+            try
+            {
+                std::vector<std::thread> producers;
+
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t t = 0; t < threadCount; t++ )
+                {
+                    producers.emplace_back([&pLogger, &logged, t] ( )
+                    {
+                        for ( size_t i = 0; i < msgsPerThread; i++ )
+                        {
+                            logged += (pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Thread %zu message (#%zu)."), t, i)) ? 1 : 0;
+                        }
+                    });
+                }
+
+                for ( std::thread& producer : producers )
+                {
+                    producer.join( );
+                }
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                stats = pLogger->GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Nothing should have been dropped.
+            SUTL_TEST_ASSERT(logged == threadCount * msgsPerThread);
+            SUTL_TEST_ASSERT(stats.dropped == 0);
+            SUTL_TEST_ASSERT(stats.failed == 0);
+
+            // Spilled or not, messages are written in submission (sequence number) order.
+            std::basic_ifstream<utf16> file(config.GetFile( ));
+            while ( std::getline(file, line) )
+            {
+                if ( line.compare(0, 4, UTF16_LITERAL_STR("SEQ[")) == 0 )
+                {
+                    seqs.push_back(std::stoull(line.substr(4, 16), nullptr, 16));
+                }
+            }
+
+            file.close( );
+
+            SUTL_TEST_ASSERT(seqs.size( ) == threadCount * msgsPerThread);
+            SUTL_TEST_ASSERT(std::is_sorted(seqs.begin( ), seqs.end( )));
+            SUTL_TEST_ASSERT(std::adjacent_find(seqs.begin( ), seqs.end( )) == seqs.end( ));
+
+            // Cleanup AsyncLogger object - the spill file goes with it.
+            pLogger.reset( );
+            SUTL_TEST_ASSERT(!std::filesystem::exists(spillFile));
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult SpillFileNotShared( )
+        {
+            static const std::filesystem::path spillFile(std::filesystem::current_path( ) / L"test_spill.bin");
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::unique_ptr<AsyncLogger> pOther;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: Both loggers are built from the one config, so they'd both spill to the same file.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+            config.SetAsyncQueueCapacity(8);
+            config.SetAsyncSpillFile(spillFile);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_SETUP_ASSERT(logged);
+
+            // The second logger should be rejected, without touching the first one's spilled messages.
+            try
+            {
+                pOther = std::make_unique<AsyncLogger>(ConfigPackage(config));
+                SUTL_TEST_ASSERT(false);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                // Expected - the path is in use.
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            // Once the first logger is gone, the path is free again.
+            pLogger.reset( );
+
+            try
+            {
+                pOther = std::make_unique<AsyncLogger>(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            pOther.reset( );
+            SUTL_TEST_ASSERT(!std::filesystem::exists(spillFile));
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult StartAndShutdown( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            bool logged = true;
+            size_t discarded = 0;
+            bool threw = false;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                // Start the worker ahead of the first message (twice - the second call does nothing).
+                pLogger->Start( );
+                pLogger->Start( );
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+
+                // Plenty of time - nothing should be discarded, and shutdown shouldn't wait out the batch latency.
+                discarded = pLogger->Shutdown(std::chrono::seconds(10));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(discarded == 0);
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            // Shut down - messages are refused, and the logger can't be restarted.
+            SUTL_TEST_ASSERT(!pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#0).")));
+            SUTL_TEST_ASSERT(pLogger->Shutdown(std::chrono::seconds(10)) == 0);
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+
+            try
+            {
+                pLogger->Start( );
+            }
+            catch ( const std::runtime_error& )
+            {
+                threw = true;
+            }
+
+            SUTL_TEST_ASSERT(threw);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ShutdownDeadlineDiscards( )
+        {
+            static const size_t msgCount = 10000;
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> line;
+            size_t writtenCount = 0;
+            size_t discarded = 0;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+            config.SetAsyncEagerStart(true);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < msgCount; i++ )
+                {
+                    pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+
+                // Deadline has already passed - whatever the worker hasn't started on is discarded.
+                discarded = pLogger->Shutdown(std::chrono::steady_clock::now( ));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // A failed shutdown leaves flush barriers failing.
+            SUTL_TEST_ASSERT(discarded == 0 || !pLogger->Flush( ));
+
+            // Cleanup AsyncLogger object - waits for any write in progress.
+            pLogger.reset( );
+
+            // Every message was either written or counted as discarded - never both.
+            std::basic_ifstream<utf16> file(config.GetFile( ));
+            while ( std::getline(file, line) )
+            {
+                if ( line.find(UTF16_LITERAL_STR("(#")) != std::basic_string<utf16>::npos )
+                {
+                    writtenCount++;
+                }
+            }
+
+            file.close( );
+
+            SUTL_TEST_ASSERT(writtenCount + discarded == msgCount);
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult WorkerThreadSettings( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger - pin the worker to the first CPU, below normal priority.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncWorkerAffinity(0x1);
+            config.SetAsyncWorkerPriority(-1);
+            config.SetAsyncWorkerName(UTF16_LITERAL_STR("sll-worker"));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            // Every setting should have been applied - failures are logged as warnings.
+            fileContents = ReadFile(config.GetFile( ));
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("Failed to set worker thread")) == std::basic_string<utf16>::npos);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult NumaProducersBenchmark( )
+        {
+            static const size_t msgsPerProducer = 20000;
+
+            const size_t nodeCount = SLL::NumaHelper::GetNodeCount( );
+
+            // Each producer pins itself to one NUMA node's CPUs, then logs its share of the messages.
+            const auto produce = [ ] (const AsyncLogger* pLogger, const size_t node, std::atomic<bool>& logged)
+            {
+                const uint64_t affinity = SLL::NumaHelper::GetNodeAffinity(node);
+
+                if ( affinity != 0 )
+                {
+                    SLL::WindowsThreadHelper::SetCurrentThreadAffinity(affinity);
+                }
+
+                for ( size_t i = 0; i < msgsPerProducer; i++ )
+                {
+                    if ( !pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Node %zu benchmark message [#%zu]."), node, i) )
+                    {
+                        logged = false;
+                    }
+                }
+            };
+
+            // Same workload with one shared queue, then with per-node queues.
+            for ( const bool bNumaAware : { false, true } )
+            {
+                std::unique_ptr<AsyncLogger> pLogger;
+                std::vector<std::thread> producers;
+                std::atomic<bool> logged(true);
+                size_t written = 0;
+
+                ConfigPackage config;
+                config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+                config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+                config.SetAsyncNumaAware(bNumaAware);
+
+                try
+                {
+                    pLogger = std::make_unique<AsyncLogger>(config);
+
+                    for ( size_t node = 0; node < nodeCount; node++ )
+                    {
+                        producers.emplace_back(produce, pLogger.get( ), node, std::ref(logged));
+                    }
+
+                    for ( std::thread& producer : producers )
+                    {
+                        producer.join( );
+                    }
+
+                    SUTL_TEST_ASSERT(pLogger->Flush( ));
+                }
+                catch ( const std::exception& e )
+                {
+                    SUTL_TEST_EXCEPTION(e.what( ));
+                }
+
+                SUTL_TEST_ASSERT(logged);
+
+                // Cleanup AsyncLogger object.
+                pLogger.reset( );
+
+                // Every message from every node should have made it out.
+                const std::basic_string<utf16> fileContents = ReadFile(config.GetFile( ));
+                for ( size_t pos = fileContents.find(UTF16_LITERAL_STR("[#")); pos != std::basic_string<utf16>::npos; pos = fileContents.find(UTF16_LITERAL_STR("[#"), pos + 2) )
+                {
+                    written++;
+                }
+
+                SUTL_TEST_ASSERT(written == nodeCount * msgsPerProducer);
+
+                // Attempt to cleanup test log file.
+                SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult PrefaultedLargePageQueues( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger - prefaulted queues, on large pages if the process may use them.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncQueueCapacity(1024);
+            config.SetAsyncLargePages(true);
+            config.SetAsyncPrefaultMemory(true);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Without the lock-memory privilege, the queues silently fall back to normal pages - logging works either way.
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ReserveAndCommit( )
+        {
+            static const utf16* droppedMsg = UTF16_LITERAL_STR("Uncommitted message.");
+            static const char reserveSite = 0;
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            bool logged = true;
+            bool threw = false;
+            bool threwInvalidLevel = false;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                // Format straight into the reserved storage - alternate inline-sized and pooled reservations.
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    AsyncLogger::Reservation slot = pLogger->Reserve(VerbosityLevel::INFO, (i % 2 == 0) ? 64 : 1024, &reserveSite);
+                    const int len = swprintf(reinterpret_cast<wchar_t*>(slot.GetBuffer( )), slot.GetCapacity( ) + 1, L"Test log message (#%zu).", i);
+
+                    logged &= len > 0 && slot.Commit(static_cast<size_t>(len));
+                    logged &= slot.GetBuffer( ) == nullptr;
+                }
+
+                // Dropping a reservation without committing it drops the message.
+                {
+                    AsyncLogger::Reservation slot = pLogger->Reserve(VerbosityLevel::INFO, 64, &reserveSite);
+                    std::char_traits<utf16>::copy(slot.GetBuffer( ), droppedMsg, std::char_traits<utf16>::length(droppedMsg) + 1);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Committing more than was reserved should throw.
+            try
+            {
+                AsyncLogger::Reservation slot = pLogger->Reserve(VerbosityLevel::INFO, 4, &reserveSite);
+                slot.Commit(5);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Reserving with an invalid verbosity level should throw, like Log does.
+            try
+            {
+                pLogger->Reserve(VerbosityLevel::MAX, 4, &reserveSite);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threwInvalidLevel = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw);
+            SUTL_TEST_ASSERT(threwInvalidLevel);
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            fileContents = ReadFile(config.GetFile( ));
+            SUTL_TEST_ASSERT(fileContents.find(droppedMsg) == std::basic_string<utf16>::npos);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ThreadStagingHandOff( )
+        {
+            static const utf16* warnMsg = UTF16_LITERAL_STR("Staged warning.");
+            static const size_t producerCount = 4;
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::vector<std::future<bool>> producers;
+            std::basic_string<utf16> fileContents;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger - stage up to 16 messages per thread.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncThreadStagingSize(16);
+
+            // Each producer stages its own numbered messages, and hands off whatever's left itself.
+            const auto logAll = [ ] (const AsyncLogger* pLogger, const size_t first) -> bool
+            {
+                bool ret = true;
+
+                for ( size_t i = first; i < 64; i += producerCount )
+                {
+                    ret &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+
+                return ret && pLogger->FlushThread( );
+            };
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < producerCount; i++ )
+                {
+                    producers.push_back(std::async(std::launch::async, logAll, pLogger.get( ), i));
+                }
+
+                for ( auto& result : producers )
+                {
+                    logged &= result.get( );
+                }
+
+                // A warning is handed off right away, along with everything staged before it.
+                logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Staged info."));
+                logged &= pLogger->Log(VerbosityLevel::WARN, warnMsg);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            fileContents = ReadFile(config.GetFile( ));
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("Staged info.")) < fileContents.find(warnMsg));
+            SUTL_TEST_ASSERT(fileContents.find(warnMsg) != std::basic_string<utf16>::npos);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult GetStatsCounts( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            SLL::LogStats queued;
+            SLL::LogStats flushed;
+            SLL::LogStats shutDown;
+            size_t accepted = 0;
+
+            // Setup the configuration package for AsyncLogger - the worker holds off until 256 messages
+            // (or a flush), so the queue fills up and stays full.  Every other message is below the threshold.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetVerbosityThreshold(VerbosityLevel::WARN);
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+            config.SetAsyncQueueCapacity(16);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 32; i++ )
+                {
+                    accepted += (pLogger->Log((i % 2 == 0) ? VerbosityLevel::WARN : VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i)) ? 1 : 0;
+                }
+
+                queued = pLogger->GetStats( );
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                flushed = pLogger->GetStats( );
+
+                pLogger->Shutdown(std::chrono::seconds(5));
+                SUTL_TEST_ASSERT(!pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Too late.")));
+                shutDown = pLogger->GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Full queue - half the messages are turned away, the rest wait in the queue.
+            SUTL_TEST_ASSERT(accepted == 16);
+            SUTL_TEST_ASSERT(queued.accepted == 16);
+            SUTL_TEST_ASSERT(queued.dropped == 16);
+            SUTL_TEST_ASSERT(queued.written == 0);
+            SUTL_TEST_ASSERT(queued.queueDepth == 16);
+            SUTL_TEST_ASSERT(queued.queueHighWatermark == 16);
+
+            // Flushed - everything queued has been written or filtered (not both), and the high-watermark sticks.
+            SUTL_TEST_ASSERT(flushed.written == 8);
+            SUTL_TEST_ASSERT(flushed.filtered == 8);
+            SUTL_TEST_ASSERT(flushed.failed == 0);
+            SUTL_TEST_ASSERT(flushed.queueDepth == 0);
+            SUTL_TEST_ASSERT(flushed.queueHighWatermark == 16);
+            SUTL_TEST_ASSERT(flushed.flushes != 0);
+            SUTL_TEST_ASSERT(flushed.bytesWritten != 0);
+
+            // Shut down - later messages count as dropped.
+            SUTL_TEST_ASSERT(shutDown.dropped == 17);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult FlushCounts( )
+        {
+            static const size_t msgCount = 64;
+            static const size_t batchSize = 16;
+
+            SLL::LogStats everyFourth;
+            SLL::LogStats never;
+            SLL::LogStats batched;
+
+            // Log msgCount messages, flush, and return the logger's stats.
+            const auto logAndFlush = [ ] (const ConfigPackage& config) -> SLL::LogStats
+            {
+                AsyncLogger logger(config);
+
+                for ( size_t i = 0; i < msgCount; i++ )
+                {
+                    if ( !logger.Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i) )
+                    {
+                        throw std::runtime_error(__FUNCTION__" - Failed to log message.");
+                    }
+                }
+
+                if ( !logger.Flush( ) )
+                {
+                    throw std::runtime_error(__FUNCTION__" - Failed to flush.");
+                }
+
+                return logger.GetStats( );
+            };
+
+            // Setup the configuration package for AsyncLogger - no batching, so the sink's flush interval applies.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            try
+            {
+                config.SetFlushInterval(4);
+                everyFourth = logAndFlush(config);
+
+                config.SetFlushInterval(0);
+                never = logAndFlush(config);
+
+                // Batching - the worker holds off until a batch fills (or a flush), and flushes once per batch.
+                // - Note: The sink's flush interval is ignored while batching, so a flush per message would show up here.
+                config.SetFlushInterval(1);
+                config.SetAsyncBatchLatency(std::chrono::seconds(30));
+                config.SetAsyncBatchSize(batchSize);
+                batched = logAndFlush(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Every fourth write, plus the one Flush asked for.
+            SUTL_TEST_ASSERT(everyFourth.written == msgCount);
+            SUTL_TEST_ASSERT(everyFourth.flushes == msgCount / 4 + 1);
+
+            // Periodic flushing disabled - only the one Flush asked for.
+            SUTL_TEST_ASSERT(never.written == msgCount);
+            SUTL_TEST_ASSERT(never.flushes == 1);
+
+            // One per batch, plus the one Flush asked for.
+            // - Note: The worker may wake (and flush) between batches, so allow for one more.
+            SUTL_TEST_ASSERT(batched.written == msgCount);
+            SUTL_TEST_ASSERT(batched.flushes >= 2);
+            SUTL_TEST_ASSERT(batched.flushes <= msgCount / batchSize + 2);
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult SinkDeliveryQueue( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            SLL::LogStats stats;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger - the file sink gets a small delivery queue of its own,
+            // and waits for space rather than dropping when it's full.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncSinkQueueCapacity(8);
+            config.SetAsyncSinkBlockWhenFull(true);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+
+                // Flush waits on the sink's worker, so everything is in the file afterwards.
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                stats = pLogger->GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            // Nothing dropped - the full queue made the logger's worker wait instead.
+            SUTL_TEST_ASSERT(stats.accepted == 64);
+            SUTL_TEST_ASSERT(stats.written == 64);
+            SUTL_TEST_ASSERT(stats.dropped == 0);
+            SUTL_TEST_ASSERT(stats.failed == 0);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult LatencyHistograms( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            SLL::LatencyStats disabled;
+            SLL::LatencyStats stats;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            try
+            {
+                // Histograms are off by default - nothing is recorded.
+                pLogger = std::make_unique<AsyncLogger>(config);
+                SUTL_TEST_ASSERT(pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Not timed.")));
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                disabled = pLogger->GetLatencyStats( );
+                pLogger.reset( );
+
+                config.SetAsyncLatencyHistograms(true);
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    SUTL_TEST_ASSERT(pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i));
+                }
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                stats = pLogger->GetLatencyStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(disabled.queueWait.count == 0);
+            SUTL_TEST_ASSERT(disabled.sinkWrite.count == 0);
+            SUTL_TEST_ASSERT(disabled.logCall.count == 0);
+
+            // Every message was timed at each stage.
+            SUTL_TEST_ASSERT(stats.queueWait.count == 64);
+            SUTL_TEST_ASSERT(stats.sinkWrite.count == 64);
+            SUTL_TEST_ASSERT(stats.logCall.count == 64);
+
+            // Percentiles are ordered, and never past the largest value.
+            SUTL_TEST_ASSERT(stats.sinkWrite.GetPercentile(50.0) <= stats.sinkWrite.GetPercentile(99.0));
+            SUTL_TEST_ASSERT(stats.sinkWrite.GetPercentile(99.0) <= stats.sinkWrite.GetMax( ));
+            SUTL_TEST_ASSERT(stats.sinkWrite.GetMax( ) > std::chrono::nanoseconds::zero( ));
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult MemoryBudgetShedding( )
+        {
+            std::shared_ptr<SLL::MemoryBudget> pBudget;
+            std::unique_ptr<AsyncLogger> pLogger;
+            bool badLimitsThrew = false;
+            size_t infoAccepted = 0;
+            size_t warnAccepted = 0;
+            size_t storageBytes = 0;
+            size_t queuedBytes = 0;
+
+            // Long enough to need a pooled payload - short messages fit in their queue slot, which is already charged.
+            static const utf16* longFormat =
+                UTF16_LITERAL_STR("Test log message (#%zu) - padded out past the inline payload capacity, so the message borrows a buffer ")
+                UTF16_LITERAL_STR("from the payload pool and is charged for it.  The rest of this sentence is only here to add length.");
+
+            // Limits are checked up front.
+            try
+            {
+                SLL::MemoryBudget badBudget(2048, 1024);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                badLimitsThrew = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(badLimitsThrew);
+
+            // Setup the configuration package for AsyncLogger - the worker holds off until a flush, so the queue only grows.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+            config.SetAsyncBatchSize(4096);
+
+            try
+            {
+                // The logger's queue storage is charged up front, and given back when it goes away.
+                pBudget = std::make_shared<SLL::MemoryBudget>(1024 * 1024 * 1024, 1024 * 1024 * 1024);
+                config.SetAsyncMemoryBudget(pBudget);
+                pLogger = std::make_unique<AsyncLogger>(config);
+                storageBytes = pBudget->GetBytesInUse( );
+                pLogger.reset( );
+
+                SUTL_TEST_ASSERT(storageBytes != 0);
+                SUTL_TEST_ASSERT(pBudget->GetBytesInUse( ) == 0);
+
+                // Soft limit at 16KB past the storage, hard limit at 64KB past it - INFO is shed past the soft limit.
+                pBudget = std::make_shared<SLL::MemoryBudget>(storageBytes + 16 * 1024, storageBytes + 64 * 1024);
+                config.SetAsyncMemoryBudget(pBudget);
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 512; i++ )
+                {
+                    infoAccepted += (pLogger->Log(VerbosityLevel::INFO, longFormat, i)) ? 1 : 0;
+                }
+
+                for ( size_t i = 0; i < 512; i++ )
+                {
+                    warnAccepted += (pLogger->Log(VerbosityLevel::WARN, longFormat, i)) ? 1 : 0;
+                }
+
+                queuedBytes = pBudget->GetBytesInUse( );
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // INFO stopped at the soft limit, WARN carried on until the hard limit.
+            SUTL_TEST_ASSERT(infoAccepted != 0 && infoAccepted < 512);
+            SUTL_TEST_ASSERT(warnAccepted > infoAccepted && warnAccepted < 512);
+            SUTL_TEST_ASSERT(pBudget->GetShedCount( ) == 512 - infoAccepted);
+            SUTL_TEST_ASSERT(pBudget->GetOverflowCount( ) == 512 - warnAccepted);
+            SUTL_TEST_ASSERT(queuedBytes <= pBudget->GetHardLimit( ));
+            SUTL_TEST_ASSERT(pBudget->GetPeakBytes( ) == queuedBytes);
+
+            // Written messages give their room back - the storage stays charged until the logger goes away.
+            SUTL_TEST_ASSERT(pBudget->GetBytesInUse( ) == storageBytes);
+            SUTL_TEST_ASSERT(pLogger->GetStats( ).dropped == 1024 - infoAccepted - warnAccepted);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+            SUTL_TEST_ASSERT(pBudget->GetBytesInUse( ) == 0);
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult RateLimitedCallSites( )
+        {
+            static const char reserveSite = 0;
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::shared_ptr<SLL::RateLimiter> pLimiter;
+            SLL::LogStats stats;
+            size_t reserved = 0;
+            bool threw = false;
+
+            // Setup the configuration package for AsyncLogger - the sink only logs WARN and above,
+            // and each call site logs its first 2 messages, then 1 in 1000.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetVerbosityThreshold(VerbosityLevel::WARN);
+
+            try
+            {
+                pLimiter = std::make_shared<SLL::RateLimiter>( );
+                pLimiter->SetSampling(2, 1000);
+                config.SetRateLimiter(pLimiter);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            // Separate ConfigPackages must share the same limiter.
+            try
+            {
+                ConfigPackage otherConfig = config;
+                otherConfig.SetRateLimiter(std::make_shared<SLL::RateLimiter>( ));
+
+                AsyncLogger mismatched(config, otherConfig);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 10; i++ )
+                {
+                    pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Below the threshold (#%zu)."), i);
+                    pLogger->Log(VerbosityLevel::WARN, UTF16_LITERAL_STR("Busy call site (#%zu)."), i);
+
+                    // Reservations are limited by the call site they name - a limited one comes back empty.
+                    AsyncLogger::Reservation slot = pLogger->Reserve(VerbosityLevel::WARN, 64, &reserveSite);
+
+                    if ( slot.GetBuffer( ) )
+                    {
+                        const int len = swprintf(reinterpret_cast<wchar_t*>(slot.GetBuffer( )), slot.GetCapacity( ) + 1, L"Busy reservation site (#%zu).", i);
+
+                        reserved += (len > 0 && slot.Commit(static_cast<size_t>(len))) ? 1 : 0;
+                    }
+                }
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                stats = pLogger->GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // INFO messages never reach the limiter - only the WARN sites are tracked (3 of each one's 10 messages are logged).
+            SUTL_TEST_ASSERT(reserved == 3);
+            SUTL_TEST_ASSERT(pLimiter->GetSiteCount( ) == 2);
+            SUTL_TEST_ASSERT(pLimiter->GetSampledCount( ) == 14);
+            SUTL_TEST_ASSERT(stats.rateLimited == 14);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult CoalesceRepeatsOnWorker( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            std::vector<uint64_t> seqs;
+            SLL::LogStats stats;
+
+            // Setup the configuration packages for AsyncLogger - only the file's ConfigPackage enables coalescing,
+            // and its records carry sequence numbers.
+            ConfigPackage stdOutConfig;
+            ConfigPackage fileConfig;
+            fileConfig.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogSequenceNumber);
+            fileConfig.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            fileConfig.SetCoalesceWindow(std::chrono::minutes(1));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(stdOutConfig, fileConfig);
+
+                for ( size_t i = 0; i < 100; i++ )
+                {
+                    pLogger->Log(VerbosityLevel::WARN, UTF16_LITERAL_STR("Disk full on volume %d."), 3);
+                }
+
+                pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Recovered."));
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                stats = pLogger->GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            fileContents = ReadFile(fileConfig.GetFile( ));
+
+            for ( size_t pos = fileContents.find(UTF16_LITERAL_STR("SEQ[")); pos != std::basic_string<utf16>::npos; pos = fileContents.find(UTF16_LITERAL_STR("SEQ["), pos + 1) )
+            {
+                seqs.push_back(std::stoull(fileContents.substr(pos + 4, 16), nullptr, 16));
+            }
+
+            // The summary is a line the file logger wrote, so it's counted along with the two messages.
+            SUTL_TEST_ASSERT(stats.written == 3);
+            SUTL_TEST_ASSERT(stats.coalesced == 99);
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("Last message repeated 99 times.")) != std::basic_string<utf16>::npos);
+
+            // The summary takes the number of the message that ended the run, so it sorts between the two.
+            SUTL_TEST_ASSERT(seqs.size( ) == 3);
+            SUTL_TEST_ASSERT(seqs[0] < seqs[1]);
+            SUTL_TEST_ASSERT(seqs[1] == seqs[2]);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult CoalesceByFormatOnWorker( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            SLL::LogStats stats;
+
+            // Setup the configuration package for AsyncLogger - deferred messages keep their format string, so
+            // messages from the same call site are coalesced whatever their arguments.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous | OptionFlag::LogDeferredFormat);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetCoalesceWindow(std::chrono::minutes(1));
+            config.SetCoalesceByFormat(true);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 50; i++ )
+                {
+                    pLogger->Log(VerbosityLevel::WARN, UTF16_LITERAL_STR("Request %zu timed out."), i);
+                }
+
+                pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Recovered."));
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+                stats = pLogger->GetStats( );
+
+                // The call site's summary is still pending - it goes out when the logger is destroyed.
+                pLogger.reset( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            fileContents = ReadFile(config.GetFile( ));
+
+            SUTL_TEST_ASSERT(stats.written == 2);
+            SUTL_TEST_ASSERT(stats.coalesced == 49);
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("Request 0 timed out.")) != std::basic_string<utf16>::npos);
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("Request 1 timed out.")) == std::basic_string<utf16>::npos);
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("Message \"Request %zu timed out.\" repeated 49 times.")) != std::basic_string<utf16>::npos);
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult DrainOnCrashRegistration( )
+        {
+            std::vector<std::unique_ptr<AsyncLogger>> loggers;
+            bool logged = true;
+            bool registered = true;
+
+            // Setup the configuration package for AsyncLogger - opt in to the crash hook.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncDrainOnCrash(true);
+
+            // Fill every crash hook slot.
+            try
+            {
+                for ( size_t i = 0; i < SLL::CrashDrain::MaxLoggers; i++ )
+                {
+                    loggers.push_back(std::make_unique<AsyncLogger>(config));
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            // One more logger than that still builds and logs as usual - it just isn't drained on a crash.
+            try
+            {
+                loggers.push_back(std::make_unique<AsyncLogger>(config));
+                registered = SLL::CrashDrain::Register(loggers.back( ).get( ));
+
+                for ( size_t i = 0; i < 32; i++ )
+                {
+                    logged &= loggers.back( )->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(!registered);
+
+            // Destroying a logger frees its slot, and registered loggers log as usual.
+            loggers.clear( );
+
+            try
+            {
+                loggers.push_back(std::make_unique<AsyncLogger>(config));
+
+                for ( size_t i = 32; i < 64; i++ )
+                {
+                    logged &= loggers.back( )->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(loggers.back( )->Flush( ));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            // Cleanup AsyncLogger objects.
+            loggers.clear( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult LogSignalSafe( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            bool logged = false;
+            bool loggedWhileDisabled = true;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            try
+            {
+                // Disabled by default.
+                pLogger = std::make_unique<AsyncLogger>(config);
+                loggedWhileDisabled = pLogger->LogSignalSafe(VerbosityLevel::INFO, "Signal-safe message.");
+                pLogger.reset( );
+
+                config.SetAsyncSignalSafeCapacity(16);
+                pLogger = std::make_unique<AsyncLogger>(config);
+                logged = pLogger->LogSignalSafe(VerbosityLevel::WARN, "Signal-safe message: %d %u %x %X %c %s %zu %lld%%.", -42, 42u, 0xbeefu, 0xbeefu, 'Z', "text", static_cast<size_t>(7), -1234567890123LL);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(!loggedWhileDisabled);
+            SUTL_TEST_ASSERT(logged);
+
+            // Invalid arguments are refused, rather than thrown.
+            SUTL_TEST_ASSERT(!pLogger->LogSignalSafe(VerbosityLevel::MAX, "Bad verbosity level."));
+            SUTL_TEST_ASSERT(!pLogger->LogSignalSafe(VerbosityLevel::INFO, static_cast<const utf8*>(nullptr)));
+
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+
+            fileContents = ReadFile(config.GetFile( ));
+            SUTL_TEST_ASSERT(fileContents.find(UTF16_LITERAL_STR("Signal-safe message: -42 42 beef BEEF Z text 7 -1234567890123%.")) != std::basic_string<utf16>::npos);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        // Logger used by the test signal handler below.
+        static const AsyncLogger* s_pSignalLogger = nullptr;
+        static volatile std::sig_atomic_t s_SignalLogged = 0;
+
+        void SignalSafeTestHandler(int sig)
+        {
+            s_SignalLogged = s_pSignalLogger->LogSignalSafe(VerbosityLevel::WARN, UTF16_LITERAL_STR("Caught signal %d."), sig) ? 1 : 0;
+        }
+
+        UnitTestResult LogSignalSafeFromHandler( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::basic_string<utf16> fileContents;
+            std::basic_ostringstream<utf16> expected;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncSignalSafeCapacity(16);
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            s_pSignalLogger = pLogger.get( );
+            s_SignalLogged = 0;
+
+            const auto prevHandler = std::signal(SIGTERM, SignalSafeTestHandler);
+            SUTL_SETUP_ASSERT(prevHandler != SIG_ERR);
+
+            std::raise(SIGTERM);
+            std::signal(SIGTERM, prevHandler);
+
+            SUTL_TEST_ASSERT(s_SignalLogged == 1);
+
+            // The worker picks the message up without being woken (or flushed).
+            expected << UTF16_LITERAL_STR("Caught signal ") << SIGTERM << UTF16_LITERAL_STR(".");
+
+            const auto deadline = std::chrono::steady_clock::now( ) + std::chrono::seconds(10);
+            while ( (fileContents = ReadFile(config.GetFile( ))).find(expected.str( )) == std::basic_string<utf16>::npos && std::chrono::steady_clock::now( ) < deadline )
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+
+            SUTL_TEST_ASSERT(fileContents.find(expected.str( )) != std::basic_string<utf16>::npos);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+            s_pSignalLogger = nullptr;
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult FlushNothingQueued( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::future<void> barrier;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            // Nothing was ever logged - the barrier should be reached immediately.
+            SUTL_TEST_ASSERT(pLogger->Flush( ));
+
+            try
+            {
+                barrier = pLogger->FlushAsync( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(barrier.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult FlushAsyncIgnoresBatchLatency( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::future<void> barrier;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: Without the barrier, a partial batch would sit in the queue for the whole latency target.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+
+                barrier = pLogger->FlushAsync( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+
+            // The barrier should be reached well before the latency target.
+            SUTL_TEST_ASSERT(barrier.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+
+            try
+            {
+                barrier.get( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Every message submitted before the barrier should be in the file.
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult FlushAsyncCallback( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::promise<bool> flushed;
+            std::future<bool> result = flushed.get_future( );
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger.
+            // - Note: Without the barrier, a partial batch would sit in the queue for the whole latency target.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetAsyncBatchLatency(std::chrono::seconds(30));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+
+                pLogger->FlushAsync([&flushed] (bool bFlushed)
+                {
+                    flushed.set_value(bFlushed);
+                });
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+
+            // The callback should run well before the latency target, and report success.
+            SUTL_TEST_ASSERT(result.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+            SUTL_TEST_ASSERT(result.get( ));
+
+            // Every message submitted before the barrier should be in the file.
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult LogAsyncCallback( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::promise<AsyncLogger::LogAsyncResult> durable;
+            std::future<AsyncLogger::LogAsyncResult> result = durable.get_future( );
+            bool logged = false;
+
+            // Setup the configuration package for AsyncLogger - run on the caller's executor.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            try
+            {
+                config.SetAsyncExecutor(std::make_shared<TestExecutor>( ));
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                logged = pLogger->LogAsync([&durable] (AsyncLogger::LogAsyncResult res)
+                {
+                    durable.set_value(res);
+                }, VerbosityLevel::INFO, "Durable message (#%d).", 1);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(result.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+            SUTL_TEST_ASSERT(result.get( ) == AsyncLogger::LogAsyncResult::Durable);
+
+            // By the time the callback runs, the message must already be in the file.
+            SUTL_TEST_ASSERT(ReadFile(config.GetFile( )).find(UTF16_LITERAL_STR("Durable message (#1).")) != std::basic_string<utf16>::npos);
+
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult LogAsyncNotDurable( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            std::shared_ptr<SLL::RateLimiter> pLimiter;
+            std::mutex resultsMutex;
+            std::vector<AsyncLogger::LogAsyncResult> results;
+            bool logged = true;
+            bool loggedAfterShutdown = true;
+
+            // Records each result - called right away for messages that won't be waited on, otherwise by the worker.
+            const auto record = [&resultsMutex, &results] (AsyncLogger::LogAsyncResult res)
+            {
+                std::lock_guard<std::mutex> lg(resultsMutex);
+                results.push_back(res);
+            };
+
+            // Setup the configuration package for AsyncLogger - the sink only logs WARN and above,
+            // and each call site logs its first message, then 1 in 1000.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+            config.SetVerbosityThreshold(VerbosityLevel::WARN);
+
+            try
+            {
+                pLimiter = std::make_shared<SLL::RateLimiter>( );
+                pLimiter->SetSampling(1, 1000);
+                config.SetRateLimiter(pLimiter);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                // The site's third message is rate limited (its second is the first 1 in 1000), and INFO is below the threshold.
+                for ( int i = 0; i < 3; i++ )
+                {
+                    logged &= pLogger->LogAsync(record, VerbosityLevel::WARN, "Busy call site (#%d).", i);
+                }
+
+                logged &= pLogger->LogAsync(record, VerbosityLevel::INFO, "Below the threshold (#%d).", 0);
+
+                SUTL_TEST_ASSERT(pLogger->Flush( ));
+
+                // Shut down - nothing is queued any more, so nothing will be written.
+                pLogger->Shutdown(std::chrono::seconds(5));
+                loggedAfterShutdown = pLogger->LogAsync(record, VerbosityLevel::ERROR, "Too late (#%d).", 0);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+            SUTL_TEST_ASSERT(!loggedAfterShutdown);
+
+            // The flush waits for the earlier messages' barriers, so every result is in by now.
+            SUTL_TEST_ASSERT(results.size( ) == 5);
+            SUTL_TEST_ASSERT(std::count(results.begin( ), results.end( ), AsyncLogger::LogAsyncResult::Durable) == 2);
+            SUTL_TEST_ASSERT(std::count(results.begin( ), results.end( ), AsyncLogger::LogAsyncResult::Suppressed) == 2);
+            SUTL_TEST_ASSERT(results.back( ) == AsyncLogger::LogAsyncResult::NotWritten);
+
+            // Cleanup AsyncLogger object.
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult FlushTimeout( )
+        {
+            std::unique_ptr<AsyncLogger> pLogger;
+            bool logged = true;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+
+                for ( size_t i = 0; i < 64; i++ )
+                {
+                    logged &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Test log message (#%zu)."), i);
+                }
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(logged);
+
+            // A generous timeout should be met, with every message written out.
+            SUTL_TEST_ASSERT(pLogger->Flush(std::chrono::milliseconds(10000)));
+            SUTL_TEST_ASSERT(AllMessagesInFile(config.GetFile( )));
+
+            pLogger.reset( );
+
+            // Attempt to cleanup test log file.
+            SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult SteadyStateNoAllocations( )
+        {
+            static const size_t msgCount = 64;
+
+            std::unique_ptr<AsyncLogger> pLogger;
+            const std::basic_string<utf16> longArg(300, L'x');
+            size_t allocations = 0;
+            bool allLogged = true;
+
+            // Setup the configuration package for AsyncLogger.
+            ConfigPackage config;
+            config.Enable(OptionFlag::LogToFile | OptionFlag::LogAsynchronous);
+            config.SetFile(FileLoggerTests::GetGoodFilePath( ));
+
+            // Every fourth message is too large for inline storage, so it exercises the payload pool.
+            const auto logMessages = [&pLogger, &longArg] ( ) -> bool
+            {
+                bool ret = true;
+
+                for ( size_t i = 0; i < msgCount; i++ )
+                {
+                    if ( (i % 4) == 0 )
+                    {
+                        ret &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Large message (#%zu) %ls."), i, longArg.c_str( ));
+                    }
+                    else
+                    {
+                        ret &= pLogger->Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Small message (#%zu)."), i);
+                    }
+                }
+
+                return ret;
+            };
+
+            try
+            {
+                pLogger = std::make_unique<AsyncLogger>(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            // Warm-up - starts the worker thread and carves out the payload pool's slab.
+            try
+            {
+                SUTL_SETUP_ASSERT(logMessages( ));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            // Steady-state - the producer thread shouldn't touch the heap at all.
+            // - Note: Only this thread's allocations are counted, and only while the hook is installed.
+            AllocationTracking::s_allocationCount = 0;
+            AllocationTracking::s_countedThread = std::this_thread::get_id( );
+            const _CRT_ALLOC_HOOK prevHook = _CrtSetAllocHook(AllocationTracking::CountAllocations);
+
+            try
+            {
+                allLogged = logMessages( );
+            }
+            catch ( const std::exception& e )
+            {
+                _CrtSetAllocHook(prevHook);
+                AllocationTracking::s_countedThread = std::thread::id( );
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            _CrtSetAllocHook(prevHook);
+            AllocationTracking::s_countedThread = std::thread::id( );
+            allocations = AllocationTracking::s_allocationCount;
+
+            // Cleanup AsyncLogger object - waits on the worker thread to drain the queue.
+            pLogger.reset( );
+
+            SUTL_TEST_ASSERT(allLogged);
+
+            // Allocation hooks are only called by the debug CRT - release builds can't see the allocations.
+#if defined(_DEBUG)
+            SUTL_TEST_ASSERT(allocations == 0);
+#else
+            static_cast<void>(allocations);
+#endif
+
             // Attempt to cleanup test log file.
             SUTL_CLEANUP_ASSERT(FileLoggerTests::DeleteTestFile( ));
 
@@ -2,7 +2,10 @@
 
 #include <ConfigPackageTests.h>
 
+#include <AsyncWorkerPool.h>
 #include <ConfigPackage.h>
+#include <MemoryBudget.h>
+#include <RateLimiter.h>
 
 #include <LoggerBaseTests.h>
 #include <FileLoggerTests.h>
@@ -109,7 +112,211 @@ namespace ConfigPackageTests
 
             /// Positive Test \\\
 
-            SetVerbosityThreshold::ValidVerbosityLevel
+            SetVerbosityThreshold::ValidVerbosityLevel,
+
+
+            // SetAsyncBatchLatency Tests
+
+            /// Negative Test \\\
+
+            SetAsyncBatchLatency::NegativeLatency,
+
+            /// Positive Test \\\
+
+            SetAsyncBatchLatency::ValidLatency,
+
+
+            // SetAsyncBatchSize Tests
+
+            /// Negative Test \\\
+
+            SetAsyncBatchSize::ZeroSize,
+
+            /// Positive Test \\\
+
+            SetAsyncBatchSize::ValidSize,
+
+
+            // SetAsyncExecutor Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncExecutor::DefaultNoExecutor,
+            SetAsyncExecutor::SharedExecutor,
+
+
+            // SetAsyncDrainOnCrash Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncDrainOnCrash::DefaultDisabled,
+            SetAsyncDrainOnCrash::EnableDisable,
+
+
+            // SetAsyncSignalSafeCapacity Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncSignalSafeCapacity::DefaultDisabled,
+            SetAsyncSignalSafeCapacity::ValidCapacity,
+
+
+            // SetAsyncQueueCapacity Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncQueueCapacity::DefaultUnbounded,
+            SetAsyncQueueCapacity::ValidCapacity,
+
+
+            // SetAsyncSpillFile Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncSpillFile::DefaultNoSpillFile,
+            SetAsyncSpillFile::ValidFile,
+
+
+            // SetAsyncEagerStart Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncEagerStart::DefaultDisabled,
+            SetAsyncEagerStart::EnableDisable,
+
+
+            // SetAsyncWorkerAffinity Tests
+
+            /// Negative Test \\\
+
+            SetAsyncWorkerAffinity::MaskBeyondPointerWidth,
+
+            /// Positive Tests \\\
+
+            SetAsyncWorkerAffinity::DefaultAnyCPU,
+            SetAsyncWorkerAffinity::ValidMask,
+
+
+            // SetAsyncWorkerPriority Tests
+
+            /// Negative Test \\\
+
+            SetAsyncWorkerPriority::InvalidPriority,
+
+            /// Positive Tests \\\
+
+            SetAsyncWorkerPriority::DefaultNormal,
+            SetAsyncWorkerPriority::ValidPriority,
+
+
+            // SetAsyncWorkerName Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncWorkerName::DefaultUnnamed,
+            SetAsyncWorkerName::ValidName,
+
+
+            // SetAsyncNumaAware Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncNumaAware::DefaultDisabled,
+            SetAsyncNumaAware::EnableDisable,
+
+
+            // SetAsyncLargePages Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncLargePages::DefaultDisabled,
+            SetAsyncLargePages::EnableDisable,
+
+
+            // SetAsyncPrefaultMemory Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncPrefaultMemory::DefaultDisabled,
+            SetAsyncPrefaultMemory::EnableDisable,
+
+
+            // SetAsyncThreadStagingSize Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncThreadStagingSize::DefaultDisabled,
+            SetAsyncThreadStagingSize::ValidSize,
+
+
+            // SetAsyncSinkQueueCapacity Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncSinkQueueCapacity::DefaultDisabled,
+            SetAsyncSinkQueueCapacity::ValidCapacity,
+
+
+            // SetAsyncSinkBlockWhenFull Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncSinkBlockWhenFull::DefaultDisabled,
+            SetAsyncSinkBlockWhenFull::EnableDisable,
+
+
+            // SetAsyncLatencyHistograms Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncLatencyHistograms::DefaultDisabled,
+            SetAsyncLatencyHistograms::EnableDisable,
+
+
+            // SetAsyncLatencySummaryInterval Tests
+
+            /// Negative Test \\\
+
+            SetAsyncLatencySummaryInterval::NegativeInterval,
+
+            /// Positive Test \\\
+
+            SetAsyncLatencySummaryInterval::ValidInterval,
+
+
+            // SetAsyncMemoryBudget Tests
+
+            /// Positive Tests \\\
+
+            SetAsyncMemoryBudget::DefaultNoBudget,
+            SetAsyncMemoryBudget::SharedBudget,
+
+
+            // SetCoalesceWindow Tests
+
+            /// Negative Test \\\
+
+            SetCoalesceWindow::NegativeWindow,
+
+            /// Positive Test \\\
+
+            SetCoalesceWindow::ValidWindow,
+
+
+            // SetCoalesceByFormat Tests
+
+            /// Positive Tests \\\
+
+            SetCoalesceByFormat::DefaultDisabled,
+            SetCoalesceByFormat::EnableDisable,
+
+
+            // SetRateLimiter Tests
+
+            /// Positive Tests \\\
+
+            SetRateLimiter::DefaultNoLimiter,
+            SetRateLimiter::SharedLimiter
         };
 
         return testList;
@@ -1018,4 +1225,984 @@ namespace ConfigPackageTests
             SUTL_TEST_SUCCESS( );
         }
     }
+
+    namespace SetAsyncBatchLatency
+    {
+        /// Negative Test \\\
+
+        UnitTestResult NegativeLatency( )
+        {
+            ConfigPackage config;
+            bool threw = false;
+
+            try
+            {
+                config.SetAsyncBatchLatency(std::chrono::microseconds(-1));
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw);
+            SUTL_TEST_ASSERT(config.GetAsyncBatchLatency( ) == std::chrono::microseconds::zero( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidLatency( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                configL.SetAsyncBatchLatency(std::chrono::milliseconds(1));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(configL.GetAsyncBatchLatency( ) == std::chrono::milliseconds(1));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR.SetAsyncBatchLatency(std::chrono::microseconds(1000));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncBatchSize
+    {
+        /// Negative Test \\\
+
+        UnitTestResult ZeroSize( )
+        {
+            ConfigPackage config;
+            const size_t defaultSize = config.GetAsyncBatchSize( );
+            bool threw = false;
+
+            try
+            {
+                config.SetAsyncBatchSize(0);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw);
+            SUTL_TEST_ASSERT(config.GetAsyncBatchSize( ) == defaultSize);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidSize( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                configL.SetAsyncBatchSize(1);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(configL.GetAsyncBatchSize( ) == 1);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR.SetAsyncBatchSize(1);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncExecutor
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoExecutor( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncExecutor( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult SharedExecutor( )
+        {
+            std::shared_ptr<SLL::AsyncWorkerPool> pPool;
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                pPool = std::make_shared<SLL::AsyncWorkerPool>(1);
+                configL.SetAsyncExecutor(pPool);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(configL.GetAsyncExecutor( ) == pPool);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            // Copies share the same executor rather than getting one of their own.
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncExecutor( ) == pPool);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncExecutor(nullptr);
+            SUTL_TEST_ASSERT(!configR.GetAsyncExecutor( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncDrainOnCrash
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncDrainOnCrash( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncDrainOnCrash(true);
+            SUTL_TEST_ASSERT(configL.GetAsyncDrainOnCrash( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncDrainOnCrash( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncDrainOnCrash(false);
+            SUTL_TEST_ASSERT(!configR.GetAsyncDrainOnCrash( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncSignalSafeCapacity
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncSignalSafeCapacity( ) == 0);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidCapacity( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncSignalSafeCapacity(128);
+            SUTL_TEST_ASSERT(configL.GetAsyncSignalSafeCapacity( ) == 128);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncSignalSafeCapacity( ) == 128);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncSignalSafeCapacity(0);
+            SUTL_TEST_ASSERT(configR.GetAsyncSignalSafeCapacity( ) == 0);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncQueueCapacity
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultUnbounded( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncQueueCapacity( ) == 0);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidCapacity( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncQueueCapacity(4096);
+            SUTL_TEST_ASSERT(configL.GetAsyncQueueCapacity( ) == 4096);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncQueueCapacity( ) == 4096);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncQueueCapacity(0);
+            SUTL_TEST_ASSERT(configR.GetAsyncQueueCapacity( ) == 0);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncSpillFile
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoSpillFile( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncSpillFile( ).empty( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidFile( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncSpillFile(L"C:\\spill.bin");
+            SUTL_TEST_ASSERT(configL.GetAsyncSpillFile( ) == L"C:\\spill.bin");
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncSpillFile( ) == L"C:\\spill.bin");
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncSpillFile(std::filesystem::path( ));
+            SUTL_TEST_ASSERT(configR.GetAsyncSpillFile( ).empty( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncEagerStart
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncEagerStart( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncEagerStart(true);
+            SUTL_TEST_ASSERT(configL.GetAsyncEagerStart( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncEagerStart( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncEagerStart(false);
+            SUTL_TEST_ASSERT(!configR.GetAsyncEagerStart( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncWorkerAffinity
+    {
+        /// Negative Test \\\
+
+        UnitTestResult MaskBeyondPointerWidth( )
+        {
+            // CPU 32 only exists to Windows when a DWORD_PTR holds 64 bits.
+            const bool bExpectThrow = sizeof(uintptr_t) < sizeof(uint64_t);
+            ConfigPackage config;
+            bool threw = false;
+
+            try
+            {
+                config.SetAsyncWorkerAffinity(1ull << 32);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw == bExpectThrow);
+            SUTL_TEST_ASSERT(config.GetAsyncWorkerAffinity( ) == (bExpectThrow ? 0 : 1ull << 32));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultAnyCPU( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncWorkerAffinity( ) == 0);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidMask( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncWorkerAffinity(0x8);
+            SUTL_TEST_ASSERT(configL.GetAsyncWorkerAffinity( ) == 0x8);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncWorkerAffinity( ) == 0x8);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncWorkerAffinity(0);
+            SUTL_TEST_ASSERT(configR.GetAsyncWorkerAffinity( ) == 0);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncWorkerPriority
+    {
+        /// Negative Test \\\
+
+        UnitTestResult InvalidPriority( )
+        {
+            ConfigPackage config;
+
+            // Only the THREAD_PRIORITY_* levels are valid - not everything in between.
+            for ( const int priority : { -16, -14, -3, 3, 14, 16 } )
+            {
+                bool threw = false;
+
+                try
+                {
+                    config.SetAsyncWorkerPriority(priority);
+                }
+                catch ( const std::invalid_argument& )
+                {
+                    threw = true;
+                }
+                catch ( const std::exception& e )
+                {
+                    SUTL_TEST_EXCEPTION(e.what( ));
+                }
+
+                SUTL_TEST_ASSERT(threw);
+                SUTL_TEST_ASSERT(config.GetAsyncWorkerPriority( ) == 0);
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNormal( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncWorkerPriority( ) == 0);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidPriority( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                for ( const int priority : { -15, -2, -1, 0, 1, 2, 15 } )
+                {
+                    configL.SetAsyncWorkerPriority(priority);
+                    SUTL_TEST_ASSERT(configL.GetAsyncWorkerPriority( ) == priority);
+                }
+
+                configL.SetAsyncWorkerPriority(-1);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(configL.GetAsyncWorkerPriority( ) == -1);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncWorkerPriority( ) == -1);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncWorkerName
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultUnnamed( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncWorkerName( ).empty( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidName( )
+        {
+            static const utf16* name = UTF16_LITERAL_STR("sll-worker");
+
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncWorkerName(name);
+            SUTL_TEST_ASSERT(configL.GetAsyncWorkerName( ) == name);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncWorkerName( ) == name);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncWorkerName(std::basic_string<utf16>( ));
+            SUTL_TEST_ASSERT(configR.GetAsyncWorkerName( ).empty( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncNumaAware
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncNumaAware( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncNumaAware(true);
+            SUTL_TEST_ASSERT(configL.GetAsyncNumaAware( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncNumaAware( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncNumaAware(false);
+            SUTL_TEST_ASSERT(!configR.GetAsyncNumaAware( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncLargePages
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncLargePages( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncLargePages(true);
+            SUTL_TEST_ASSERT(configL.GetAsyncLargePages( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncLargePages( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncLargePages(false);
+            SUTL_TEST_ASSERT(!configR.GetAsyncLargePages( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncPrefaultMemory
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncPrefaultMemory( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncPrefaultMemory(true);
+            SUTL_TEST_ASSERT(configL.GetAsyncPrefaultMemory( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncPrefaultMemory( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncPrefaultMemory(false);
+            SUTL_TEST_ASSERT(!configR.GetAsyncPrefaultMemory( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncThreadStagingSize
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncThreadStagingSize( ) == 0);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidSize( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncThreadStagingSize(64);
+            SUTL_TEST_ASSERT(configL.GetAsyncThreadStagingSize( ) == 64);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncThreadStagingSize( ) == 64);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncThreadStagingSize(0);
+            SUTL_TEST_ASSERT(configR.GetAsyncThreadStagingSize( ) == 0);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncSinkQueueCapacity
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(config.GetAsyncSinkQueueCapacity( ) == 0);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult ValidCapacity( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncSinkQueueCapacity(256);
+            SUTL_TEST_ASSERT(configL.GetAsyncSinkQueueCapacity( ) == 256);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncSinkQueueCapacity( ) == 256);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncSinkQueueCapacity(0);
+            SUTL_TEST_ASSERT(configR.GetAsyncSinkQueueCapacity( ) == 0);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncSinkBlockWhenFull
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncSinkBlockWhenFull( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncSinkBlockWhenFull(true);
+            SUTL_TEST_ASSERT(configL.GetAsyncSinkBlockWhenFull( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncSinkBlockWhenFull( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncSinkBlockWhenFull(false);
+            SUTL_TEST_ASSERT(!configR.GetAsyncSinkBlockWhenFull( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncLatencyHistograms
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncLatencyHistograms( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetAsyncLatencyHistograms(true);
+            SUTL_TEST_ASSERT(configL.GetAsyncLatencyHistograms( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncLatencyHistograms( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncLatencyHistograms(false);
+            SUTL_TEST_ASSERT(!configR.GetAsyncLatencyHistograms( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncLatencySummaryInterval
+    {
+        /// Negative Test \\\
+
+        UnitTestResult NegativeInterval( )
+        {
+            ConfigPackage config;
+            bool threw = false;
+
+            try
+            {
+                config.SetAsyncLatencySummaryInterval(std::chrono::milliseconds(-1));
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw);
+            SUTL_TEST_ASSERT(config.GetAsyncLatencySummaryInterval( ) == std::chrono::milliseconds::zero( ));
+            SUTL_TEST_ASSERT(!config.GetAsyncLatencyHistograms( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidInterval( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                configL.SetAsyncLatencySummaryInterval(std::chrono::seconds(10));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Summaries are built from the histograms, so they're switched on too.
+            SUTL_TEST_ASSERT(configL.GetAsyncLatencySummaryInterval( ) == std::chrono::seconds(10));
+            SUTL_TEST_ASSERT(configL.GetAsyncLatencyHistograms( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR.SetAsyncLatencySummaryInterval(std::chrono::milliseconds(10000));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetAsyncMemoryBudget
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoBudget( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetAsyncMemoryBudget( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult SharedBudget( )
+        {
+            std::shared_ptr<SLL::MemoryBudget> pBudget;
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                pBudget = std::make_shared<SLL::MemoryBudget>(1024 * 1024, 4 * 1024 * 1024);
+                configL.SetAsyncMemoryBudget(pBudget);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(configL.GetAsyncMemoryBudget( ) == pBudget);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            // Copies share the same budget rather than getting one of their own.
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetAsyncMemoryBudget( ) == pBudget);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetAsyncMemoryBudget(nullptr);
+            SUTL_TEST_ASSERT(!configR.GetAsyncMemoryBudget( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetCoalesceWindow
+    {
+        /// Negative Test \\\
+
+        UnitTestResult NegativeWindow( )
+        {
+            ConfigPackage config;
+            bool threw = false;
+
+            try
+            {
+                config.SetCoalesceWindow(std::chrono::milliseconds(-1));
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw);
+            SUTL_TEST_ASSERT(config.GetCoalesceWindow( ) == std::chrono::milliseconds::zero( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+
+        /// Positive Test \\\
+
+        UnitTestResult ValidWindow( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                configL.SetCoalesceWindow(std::chrono::seconds(30));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(configL.GetCoalesceWindow( ) == std::chrono::seconds(30));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR.SetCoalesceWindow(std::chrono::milliseconds(30000));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetCoalesceWindow(std::chrono::milliseconds::zero( ));
+            SUTL_TEST_ASSERT(configR.GetCoalesceWindow( ) == std::chrono::milliseconds::zero( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetCoalesceByFormat
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultDisabled( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetCoalesceByFormat( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult EnableDisable( )
+        {
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            configL.SetCoalesceByFormat(true);
+            SUTL_TEST_ASSERT(configL.GetCoalesceByFormat( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetCoalesceByFormat( ));
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetCoalesceByFormat(false);
+            SUTL_TEST_ASSERT(!configR.GetCoalesceByFormat( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SetRateLimiter
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult DefaultNoLimiter( )
+        {
+            ConfigPackage config;
+
+            SUTL_TEST_ASSERT(!config.GetRateLimiter( ));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        UnitTestResult SharedLimiter( )
+        {
+            std::shared_ptr<SLL::RateLimiter> pLimiter;
+            ConfigPackage configL;
+            ConfigPackage configR;
+
+            try
+            {
+                pLimiter = std::make_shared<SLL::RateLimiter>( );
+                configL.SetRateLimiter(pLimiter);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(configL.GetRateLimiter( ) == pLimiter);
+            SUTL_TEST_ASSERT(configL != configR);
+
+            // Copies share the same limiter, so a limit set on it applies to every logger built from them.
+            configR = configL;
+            SUTL_TEST_ASSERT(configR.GetRateLimiter( ) == pLimiter);
+            SUTL_TEST_ASSERT(configL == configR);
+
+            configR.SetRateLimiter(nullptr);
+            SUTL_TEST_ASSERT(!configR.GetRateLimiter( ));
+            SUTL_TEST_ASSERT(configL != configR);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
 }
\ No newline at end of file
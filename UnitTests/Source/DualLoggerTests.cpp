@@ -4,6 +4,7 @@
 // SLL
 #include <ConfigPackage.h>
 #include <DualLogger.h>
+#include <RateLimiter.h>
 
 // Helper Utilities for Testing
 #include <LoggerBaseTests.h>
@@ -11,6 +12,11 @@
 // C++17 Filesystem
 #include <filesystem>
 
+// STL
+#include <fstream>
+#include <string>
+#include <vector>
+
 namespace DualLoggerTests
 {
     using SLL::ConfigPackage;
@@ -51,6 +57,24 @@ namespace DualLoggerTests
 
             GetConfig::GetFileLoggerConfig,
             GetConfig::GetStdOutLoggerConfig,
+
+
+            // RateLimit Tests
+
+            /// Negative Tests \\\
+
+            RateLimit::MismatchedLimiters,
+
+            /// Positive Tests \\\
+
+            RateLimit::LimitedOncePerMessage,
+
+
+            // SequenceNumber Tests
+
+            /// Positive Tests \\\
+
+            SequenceNumber::SharedAcrossStreams,
         
         };
 
@@ -469,4 +493,184 @@ namespace DualLoggerTests
             SUTL_TEST_SUCCESS( );
         }
     }
+
+    namespace RateLimit
+    {
+        /// Negative Tests \\\
+
+        UnitTestResult MismatchedLimiters( )
+        {
+            ConfigPackage stdOutConfig;
+            ConfigPackage fileConfig;
+            std::unique_ptr<DualLogger> pDualLogger;
+            bool threw = false;
+
+            std::filesystem::path testLog(L"test_file.log");
+
+            fileConfig.SetFile(testLog.string( ));
+
+            try
+            {
+                // A limiter set only in fileConfig would otherwise be silently ignored.
+                fileConfig.SetRateLimiter(std::make_shared<SLL::RateLimiter>( ));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            try
+            {
+                pDualLogger = std::make_unique<DualLogger>(stdOutConfig, fileConfig);
+            }
+            catch ( const std::invalid_argument& )
+            {
+                threw = true;
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(threw);
+            SUTL_TEST_ASSERT(!pDualLogger);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        /// Positive Tests \\\
+
+        UnitTestResult LimitedOncePerMessage( )
+        {
+            ConfigPackage stdOutConfig;
+            ConfigPackage fileConfig;
+            std::unique_ptr<DualLogger> pDualLogger;
+            std::shared_ptr<SLL::RateLimiter> pLimiter;
+            SLL::LogStats stats;
+
+            std::filesystem::path testLog(L"test_file.log");
+
+            // Stdout only logs ERROR and above, the file WARN and above - each call site logs its first 2 messages, then 1 in 1000.
+            stdOutConfig.SetVerbosityThreshold(SLL::VerbosityLevel::ERROR);
+            fileConfig.SetVerbosityThreshold(SLL::VerbosityLevel::WARN);
+            fileConfig.SetFile(testLog.string( ));
+
+            try
+            {
+                pLimiter = std::make_shared<SLL::RateLimiter>( );
+                pLimiter->SetSampling(2, 1000);
+                stdOutConfig.SetRateLimiter(pLimiter);
+                fileConfig.SetRateLimiter(pLimiter);
+
+                pDualLogger = std::make_unique<DualLogger>(stdOutConfig, fileConfig);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            try
+            {
+                for ( size_t i = 0; i < 10; i++ )
+                {
+                    pDualLogger->Log(SLL::VerbosityLevel::INFO, UTF16_LITERAL_STR("Below both thresholds (#%zu)."), i);
+                    pDualLogger->Log(SLL::VerbosityLevel::WARN, UTF16_LITERAL_STR("Busy call site (#%zu)."), i);
+                }
+
+                stats = pDualLogger->GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            // Each WARN message counts once against its site, though two streams see it - INFO messages don't count at all.
+            SUTL_TEST_ASSERT(pLimiter->GetSiteCount( ) == 1);
+            SUTL_TEST_ASSERT(pLimiter->GetSampledCount( ) == 7);
+            SUTL_TEST_ASSERT(stats.rateLimited == 7);
+
+            try
+            {
+                delete pDualLogger.release( );
+                SUTL_CLEANUP_ASSERT(std::filesystem::remove(testLog));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_CLEANUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace SequenceNumber
+    {
+        /// Positive Tests \\\
+
+        UnitTestResult SharedAcrossStreams( )
+        {
+            ConfigPackage config;
+            std::unique_ptr<DualLogger> pDualLogger;
+            std::basic_string<utf16> fileContents;
+            std::basic_string<utf16> line;
+            std::vector<uint64_t> seqs;
+
+            std::filesystem::path testLog(L"test_file.log");
+
+            config.Enable(SLL::OptionFlag::LogSequenceNumber);
+            config.SetFile(testLog.string( ));
+
+            try
+            {
+                pDualLogger = std::make_unique<DualLogger>(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            try
+            {
+                for ( size_t i = 0; i < 3; i++ )
+                {
+                    SUTL_TEST_ASSERT(pDualLogger->Log(SLL::VerbosityLevel::INFO, UTF16_LITERAL_STR("Numbered message (#%zu)."), i));
+                }
+
+                delete pDualLogger.release( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            {
+                std::basic_ifstream<utf16> file(testLog);
+                while ( std::getline(file, line) )
+                {
+                    fileContents.append(line);
+                }
+            }
+
+            for ( size_t pos = fileContents.find(UTF16_LITERAL_STR("SEQ[")); pos != std::basic_string<utf16>::npos; pos = fileContents.find(UTF16_LITERAL_STR("SEQ["), pos + 1) )
+            {
+                seqs.push_back(std::stoull(fileContents.substr(pos + 4, 16), nullptr, 16));
+            }
+
+            // Stdout writes the same numbers, rather than taking every other one for itself.
+            SUTL_TEST_ASSERT(seqs.size( ) == 3);
+            SUTL_TEST_ASSERT(seqs[1] == seqs[0] + 1);
+            SUTL_TEST_ASSERT(seqs[2] == seqs[1] + 1);
+
+            try
+            {
+                SUTL_CLEANUP_ASSERT(std::filesystem::remove(testLog));
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_CLEANUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
 }
\ No newline at end of file
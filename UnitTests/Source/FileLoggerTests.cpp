@@ -132,6 +132,29 @@ namespace FileLoggerTests
 
             Log::AppendFileWrite<utf8>,
             Log::AppendFileWrite<utf16>,
+
+            /// WriteRecord Tests \\\
+
+            WriteRecord::BadVerbosityLevel,
+            WriteRecord::NoLogBelowThreshold,
+            WriteRecord::RawMessage,
+
+            /// GetStats Tests \\\
+
+            GetStats::CountsMessages,
+
+            /// Coalesce Tests \\\
+
+            Coalesce::RepeatedMessages,
+            Coalesce::ByFormatString,
+
+            /// RateLimit Tests \\\
+
+            RateLimit::InvalidSiteCapacity,
+            RateLimit::SampledCallSite,
+            RateLimit::TokenBucket,
+            RateLimit::ResetStartsOver,
+            RateLimit::SitesBeyondTable,
         };
 
         return testList;
@@ -1713,4 +1736,495 @@ namespace FileLoggerTests
             SUTL_TEST_SUCCESS( );
         }
     }
+
+    namespace WriteRecord
+    {
+        /// Negative Tests \\\
+
+        UnitTestResult BadVerbosityLevel( )
+        {
+            bool threw = false;
+            TesterHelper t;
+
+            FILE_LOGGER_TEST_COMMON_SETUP(t);
+
+            try
+            {
+                t.GetLogger( ).WriteRecord(SLL::LogRecord { VerbosityLevel::MAX, std::this_thread::get_id( ), SLL::LogClock::now( ), UTF16_LITERAL_STR("Test string #1") });
+            }
+            catch ( const std::exception& )
+            {
+                threw = true;
+            }
+
+            SUTL_TEST_ASSERT(threw);
+            SUTL_TEST_ASSERT(t.GetStream( ).is_open( ));
+            SUTL_TEST_ASSERT(t.GetStream( ).good( ));
+
+            FILE_LOGGER_TEST_COMMON_CLEANUP(t);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        /// Positive Tests \\\
+
+        UnitTestResult NoLogBelowThreshold( )
+        {
+            for ( VerbosityLevel lvl = VerbosityLevel::BEGIN; lvl < VerbosityLevel::MAX; INCREMENT_VERBOSITY(lvl) )
+            {
+                for ( VerbosityLevel threshold = VerbosityLevel::BEGIN; threshold < VerbosityLevel::MAX; INCREMENT_VERBOSITY(threshold) )
+                {
+                    bool ret = false;
+                    TesterHelper t;
+
+                    FILE_LOGGER_TEST_COMMON_SETUP(t);
+
+                    t.GetConfig( ).SetVerbosityThreshold(threshold);
+
+                    try
+                    {
+                        ret = t.GetLogger( ).WriteRecord(SLL::LogRecord { lvl, std::this_thread::get_id( ), SLL::LogClock::now( ), UTF16_LITERAL_STR("Test string #1") });
+                        t.GetStream( ).flush( );
+                    }
+                    catch ( const std::exception& e )
+                    {
+                        SUTL_TEST_EXCEPTION(e.what( ));
+                    }
+
+                    SUTL_TEST_ASSERT(ret);
+                    SUTL_TEST_ASSERT(t.GetStream( ).good( ));
+                    SUTL_TEST_ASSERT((lvl < threshold) == ReadTestFile( ).empty( ));
+
+                    FILE_LOGGER_TEST_COMMON_CLEANUP(t);
+                }
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        // Record text is written verbatim - format specifiers must not be expanded.
+        UnitTestResult RawMessage( )
+        {
+            std::unique_ptr<utf16[ ]> pExpected;
+            TesterHelper t;
+
+            try
+            {
+                pExpected = CC::StringUtil::UTFConversion<ReturnType::SmartCString, utf16>("Test string %d%% %ls");
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            for ( OptionFlag mask = OptionFlag::PREFIX_BEGIN; mask < OptionFlag::PREFIX_END; mask = static_cast<OptionFlag>(static_cast<SLL::OptionFlagType>(mask) + static_cast<SLL::OptionFlagType>(OptionFlag::PREFIX_BEGIN)) )
+            {
+                for ( VerbosityLevel lvl = VerbosityLevel::BEGIN; lvl < VerbosityLevel::MAX; INCREMENT_VERBOSITY(lvl) )
+                {
+                    bool ret = false;
+
+                    FILE_LOGGER_TEST_COMMON_SETUP(t);
+
+                    t.GetConfig( ).Enable(mask);
+
+                    try
+                    {
+                        ret = t.GetLogger( ).WriteRecord(SLL::LogRecord { lvl, std::this_thread::get_id( ), SLL::LogClock::now( ), pExpected.get( ) });
+                        t.GetStream( ).flush( );
+                    }
+                    catch ( const std::exception& e )
+                    {
+                        SUTL_TEST_EXCEPTION(e.what( ));
+                    }
+
+                    SUTL_TEST_ASSERT(ret);
+                    SUTL_TEST_ASSERT(t.GetStream( ).good( ));
+                    SUTL_TEST_ASSERT(t.GetStream( ).is_open( ));
+                    SUTL_TEST_ASSERT(StreamLoggerTests::ValidateLog(t.GetConfig( ), ReadTestFile( ), pExpected));
+
+                    FILE_LOGGER_TEST_COMMON_CLEANUP(t);
+                }
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+    namespace GetStats
+    {
+        /// Positive Tests \\\
+
+        // Filtered, written and restored-stream messages each land in their own counter.
+        UnitTestResult CountsMessages( )
+        {
+            const std::basic_string<utf16> text(UTF16_LITERAL_STR("Test string #1"));
+            bool ret = true;
+            SLL::LogStats stats;
+            TesterHelper t;
+
+            FILE_LOGGER_TEST_COMMON_SETUP(t);
+
+            t.GetConfig( ).SetVerbosityThreshold(VerbosityLevel::WARN);
+
+            try
+            {
+                // Below threshold - filtered.
+                ret &= t.GetLogger( ).WriteRecord(SLL::LogRecord { VerbosityLevel::INFO, std::this_thread::get_id( ), SLL::LogClock::now( ), text });
+
+                // Written (and flushed, being WARN).
+                ret &= t.GetLogger( ).WriteRecord(SLL::LogRecord { VerbosityLevel::WARN, std::this_thread::get_id( ), SLL::LogClock::now( ), text });
+                ret &= t.GetLogger( ).WriteRecord(SLL::LogRecord { VerbosityLevel::ERROR, std::this_thread::get_id( ), SLL::LogClock::now( ), text });
+
+                // Written after restoring the stream.
+                t.GetStream( ).setstate(std::ios_base::badbit);
+                ret &= t.GetLogger( ).WriteRecord(SLL::LogRecord { VerbosityLevel::WARN, std::this_thread::get_id( ), SLL::LogClock::now( ), text });
+
+                ret &= t.GetLogger( ).Flush( );
+
+                stats = t.GetLogger( ).GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(ret);
+            SUTL_TEST_ASSERT(stats.accepted == 3);
+            SUTL_TEST_ASSERT(stats.filtered == 1);
+            SUTL_TEST_ASSERT(stats.dropped == 0);
+            SUTL_TEST_ASSERT(stats.written == 3);
+            SUTL_TEST_ASSERT(stats.failed == 0);
+            SUTL_TEST_ASSERT(stats.restoreAttempts == 1);
+            SUTL_TEST_ASSERT(stats.flushes == 4);
+            SUTL_TEST_ASSERT(stats.queueDepth == 0);
+            SUTL_TEST_ASSERT(stats.queueHighWatermark == 0);
+
+            // No prefixes are enabled - just the text and a newline per message.
+            SUTL_TEST_ASSERT(stats.bytesWritten == 3 * (text.size( ) + 1) * sizeof(utf16));
+
+            FILE_LOGGER_TEST_COMMON_CLEANUP(t);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace Coalesce
+    {
+        /// Positive Tests \\\
+
+        // A run of identical messages is written once, followed by a summary when a different message ends the run.
+        UnitTestResult RepeatedMessages( )
+        {
+            const std::basic_string<utf16> expected(UTF16_LITERAL_STR("Disk full on volume 3.\nLast message repeated 99 times.\nRecovered."));
+            bool ret = true;
+            SLL::ConfigPackage config = BuildConfig(GetGoodFilePath( ), VerbosityLevel::INFO);
+            SLL::LogStats stats;
+            TesterHelper t;
+
+            config.SetCoalesceWindow(std::chrono::minutes(1));
+
+            try
+            {
+                t.SetLogger(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_SETUP_ASSERT(t.GetStream( ).good( ));
+            SUTL_SETUP_ASSERT(t.GetStream( ).is_open( ));
+
+            try
+            {
+                for ( size_t i = 0; i < 100; i++ )
+                {
+                    ret &= t.GetLogger( ).Log(VerbosityLevel::WARN, UTF16_LITERAL_STR("Disk full on volume %d."), 3);
+                }
+
+                ret &= t.GetLogger( ).Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Recovered."));
+                ret &= t.GetLogger( ).Flush( );
+
+                stats = t.GetLogger( ).GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(ret);
+            SUTL_TEST_ASSERT(stats.accepted == 101);
+            SUTL_TEST_ASSERT(stats.written == 2);
+            SUTL_TEST_ASSERT(stats.coalesced == 99);
+            SUTL_TEST_ASSERT(ReadTestFile( ) == expected);
+
+            FILE_LOGGER_TEST_COMMON_CLEANUP(t);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        // Messages from one format string are coalesced whatever their arguments - the summary goes out once the window has passed.
+        UnitTestResult ByFormatString( )
+        {
+            const std::basic_string<utf16> expected(UTF16_LITERAL_STR("Request 0 timed out.\nMessage \"Request %zu timed out.\" repeated 49 times.\nRecovered."));
+            bool ret = true;
+            SLL::ConfigPackage config = BuildConfig(GetGoodFilePath( ), VerbosityLevel::INFO);
+            SLL::LogStats stats;
+            TesterHelper t;
+
+            config.SetCoalesceWindow(std::chrono::milliseconds(50));
+            config.SetCoalesceByFormat(true);
+
+            try
+            {
+                t.SetLogger(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_SETUP_ASSERT(t.GetStream( ).good( ));
+            SUTL_SETUP_ASSERT(t.GetStream( ).is_open( ));
+
+            try
+            {
+                for ( size_t i = 0; i < 50; i++ )
+                {
+                    ret &= t.GetLogger( ).Log(VerbosityLevel::WARN, UTF16_LITERAL_STR("Request %zu timed out."), i);
+                }
+
+                // Let the window pass - the next message sends the summary out ahead of itself.
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+                ret &= t.GetLogger( ).Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Recovered."));
+                ret &= t.GetLogger( ).Flush( );
+
+                stats = t.GetLogger( ).GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(ret);
+            SUTL_TEST_ASSERT(stats.accepted == 51);
+            SUTL_TEST_ASSERT(stats.written == 2);
+            SUTL_TEST_ASSERT(stats.coalesced == 49);
+            SUTL_TEST_ASSERT(ReadTestFile( ) == expected);
+
+            FILE_LOGGER_TEST_COMMON_CLEANUP(t);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
+
+    namespace RateLimit
+    {
+        /// Negative Tests \\\
+
+        // Zero sites, or more than can be rounded up to a power of two.
+        UnitTestResult InvalidSiteCapacity( )
+        {
+            for ( const size_t capacity : { size_t(0), (SIZE_MAX >> 1) + 2, SIZE_MAX } )
+            {
+                bool threw = false;
+
+                try
+                {
+                    SLL::RateLimiter limiter(capacity);
+                }
+                catch ( const std::invalid_argument& )
+                {
+                    threw = true;
+                }
+                catch ( const std::exception& e )
+                {
+                    SUTL_TEST_EXCEPTION(e.what( ));
+                }
+
+                SUTL_TEST_ASSERT(threw);
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+
+        /// Positive Tests \\\
+
+        // A busy call site is sampled (first 5, then 1 in 10), while ERROR messages from another site are all written.
+        UnitTestResult SampledCallSite( )
+        {
+            bool ret = true;
+            SLL::ConfigPackage config = BuildConfig(GetGoodFilePath( ), VerbosityLevel::INFO);
+            std::shared_ptr<SLL::RateLimiter> pLimiter;
+            std::basic_string<utf16> contents;
+            SLL::LogStats stats;
+            TesterHelper t;
+
+            try
+            {
+                pLimiter = std::make_shared<SLL::RateLimiter>( );
+                pLimiter->SetSampling(5, 10);
+                config.SetRateLimiter(pLimiter);
+                t.SetLogger(config);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            SUTL_SETUP_ASSERT(t.GetStream( ).good( ));
+            SUTL_SETUP_ASSERT(t.GetStream( ).is_open( ));
+
+            try
+            {
+                for ( size_t i = 0; i < 100; i++ )
+                {
+                    ret &= t.GetLogger( ).Log(VerbosityLevel::INFO, UTF16_LITERAL_STR("Retrying request %zu."), i);
+                }
+
+                for ( size_t i = 0; i < 20; i++ )
+                {
+                    ret &= t.GetLogger( ).Log(VerbosityLevel::ERROR, UTF16_LITERAL_STR("Request %zu failed."), i);
+                }
+
+                ret &= t.GetLogger( ).Flush( );
+
+                stats = t.GetLogger( ).GetStats( );
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            contents = ReadTestFile( );
+
+            SUTL_TEST_ASSERT(ret);
+            SUTL_TEST_ASSERT(stats.accepted == 35);
+            SUTL_TEST_ASSERT(stats.written == 35);
+            SUTL_TEST_ASSERT(stats.rateLimited == 85);
+            SUTL_TEST_ASSERT(pLimiter->GetSampledCount( ) == 85);
+            SUTL_TEST_ASSERT(pLimiter->GetSiteCount( ) == 1);
+            SUTL_TEST_ASSERT(contents.find(UTF16_LITERAL_STR("Retrying request 5.")) != std::basic_string<utf16>::npos);
+            SUTL_TEST_ASSERT(contents.find(UTF16_LITERAL_STR("Retrying request 6.")) == std::basic_string<utf16>::npos);
+            SUTL_TEST_ASSERT(contents.find(UTF16_LITERAL_STR("Retrying request 15.")) != std::basic_string<utf16>::npos);
+            SUTL_TEST_ASSERT(contents.find(UTF16_LITERAL_STR("Request 19 failed.")) != std::basic_string<utf16>::npos);
+
+            FILE_LOGGER_TEST_COMMON_CLEANUP(t);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        // A site gets a burst of 3, then nothing until its bucket refills - exempt levels are never throttled.
+        UnitTestResult TokenBucket( )
+        {
+            static const char site = 0;
+            SLL::RateLimiter limiter;
+            size_t allowed = 0;
+            size_t allowedErrors = 0;
+
+            try
+            {
+                // One token a minute, so the bucket can't refill mid-test.
+                limiter.SetTokenBucket(1.0 / 60.0, 3);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            for ( size_t i = 0; i < 10; i++ )
+            {
+                allowed += (limiter.Allow(&site, VerbosityLevel::WARN)) ? 1 : 0;
+                allowedErrors += (limiter.Allow(&site, VerbosityLevel::ERROR)) ? 1 : 0;
+            }
+
+            SUTL_TEST_ASSERT(allowed == 3);
+            SUTL_TEST_ASSERT(allowedErrors == 10);
+            SUTL_TEST_ASSERT(limiter.GetThrottledCount( ) == 7);
+            SUTL_TEST_ASSERT(limiter.GetSampledCount( ) == 0);
+
+            // Disabling the bucket lets everything through again.
+            try
+            {
+                limiter.SetTokenBucket(0.0, 0);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_TEST_EXCEPTION(e.what( ));
+            }
+
+            SUTL_TEST_ASSERT(limiter.Allow(&site, VerbosityLevel::WARN));
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        // Reset gives every site its first N messages (and a full bucket) again - first 2, then 1 in 1000.
+        UnitTestResult ResetStartsOver( )
+        {
+            static const char site = 0;
+            SLL::RateLimiter limiter;
+            size_t allowedBefore = 0;
+            size_t allowedAfter = 0;
+
+            try
+            {
+                limiter.SetSampling(2, 1000);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            for ( size_t i = 0; i < 5; i++ )
+            {
+                allowedBefore += (limiter.Allow(&site, VerbosityLevel::INFO)) ? 1 : 0;
+            }
+
+            limiter.Reset( );
+
+            for ( size_t i = 0; i < 5; i++ )
+            {
+                allowedAfter += (limiter.Allow(&site, VerbosityLevel::INFO)) ? 1 : 0;
+            }
+
+            SUTL_TEST_ASSERT(allowedBefore == 3);
+            SUTL_TEST_ASSERT(allowedAfter == 3);
+            SUTL_TEST_ASSERT(limiter.GetSampledCount( ) == 4);
+            SUTL_TEST_ASSERT(limiter.GetSiteCount( ) == 1);
+
+            SUTL_TEST_SUCCESS( );
+        }
+
+        // Once the table is full, further sites are never limited (and are counted as untracked).
+        UnitTestResult SitesBeyondTable( )
+        {
+            static const uint64_t sites[8] = { };
+            SLL::RateLimiter limiter(4);
+            size_t allowed = 0;
+
+            try
+            {
+                limiter.SetSampling(0, 2);
+            }
+            catch ( const std::exception& e )
+            {
+                SUTL_SETUP_EXCEPTION(e.what( ));
+            }
+
+            // Two messages per site - tracked sites log 1 of them, untracked sites log both.
+            for ( size_t i = 0; i < 8; i++ )
+            {
+                allowed += (limiter.Allow(&sites[i], VerbosityLevel::INFO)) ? 1 : 0;
+                allowed += (limiter.Allow(&sites[i], VerbosityLevel::INFO)) ? 1 : 0;
+            }
+
+            SUTL_TEST_ASSERT(limiter.GetSiteCount( ) == 4);
+            SUTL_TEST_ASSERT(limiter.GetSampledCount( ) == 4);
+            SUTL_TEST_ASSERT(limiter.GetUntrackedCount( ) == 8);
+            SUTL_TEST_ASSERT(allowed == 12);
+
+            SUTL_TEST_SUCCESS( );
+        }
+    }
 }
\ No newline at end of file
@@ -96,6 +96,9 @@ namespace LoggerBaseTests
             BuildMessagePrefixesTests::VerbosityLevelOnly<utf8>,
             BuildMessagePrefixesTests::VerbosityLevelOnly<utf16>,
 
+            BuildMessagePrefixesTests::SequenceNumberOnly<utf8>,
+            BuildMessagePrefixesTests::SequenceNumberOnly<utf16>,
+
             BuildMessagePrefixesTests::Time_ThreadID<utf8>,
             BuildMessagePrefixesTests::Time_ThreadID<utf16>,
 
@@ -980,6 +983,40 @@ namespace LoggerBaseTests
             SUTL_TEST_SUCCESS( );
         }
 
+        template <class T>
+        UnitTestResult SequenceNumberOnly( )
+        {
+            std::vector<std::unique_ptr<T[ ]>> prefixes;
+            SLL::ConfigPackage config;
+            const std::basic_string<T> expected(CC::StringUtil::UTFConversion<ReturnType::SmartCString, T>("SEQ[000000001234ABCD]  ").get( ));
+
+            config.Enable(SLL::OptionFlag::LogSequenceNumber);
+
+            SUTL_SETUP_ASSERT(config.OptionsEnabledAll(SLL::OptionFlag::LogSequenceNumber));
+
+            Tester t(std::move(config));
+
+            for ( SLL::VerbosityLevel lvl = SLL::VerbosityLevel::BEGIN; lvl != SLL::VerbosityLevel::MAX; INCREMENT_VERBOSITY(lvl) )
+            {
+                try
+                {
+                    prefixes = t.BuildMessagePrefixes<T>(lvl, std::this_thread::get_id( ), 0x1234ABCD);
+                }
+                catch ( const std::exception& e )
+                {
+                    SUTL_TEST_EXCEPTION(e.what( ));
+                }
+
+                SUTL_TEST_ASSERT(!prefixes.empty( ));
+                SUTL_TEST_ASSERT(prefixes.size( ) == 1);
+
+                SUTL_TEST_ASSERT(IsSequenceNumberPrefix<T>(prefixes[0]));
+                SUTL_TEST_ASSERT(expected == prefixes[0].get( ));
+            }
+
+            SUTL_TEST_SUCCESS( );
+        }
+
         template <class T>
         UnitTestResult Time_ThreadID( )
         {
@@ -1103,11 +1140,12 @@ namespace LoggerBaseTests
                 }
 
                 SUTL_TEST_ASSERT(!prefixes.empty( ));
-                SUTL_TEST_ASSERT(prefixes.size( ) == 3);
+                SUTL_TEST_ASSERT(prefixes.size( ) == 4);
 
                 SUTL_TEST_ASSERT(IsTimePrefix<T>(prefixes[0]));
                 SUTL_TEST_ASSERT(IsThreadIDPrefix<T>(prefixes[1]));
                 SUTL_TEST_ASSERT(IsVerbosityLevelPrefix<T>(prefixes[2]));
+                SUTL_TEST_ASSERT(IsSequenceNumberPrefix<T>(prefixes[3]));
             }
 
             SUTL_TEST_SUCCESS( );
@@ -39,6 +39,9 @@ namespace OptionFlagTests
             LeftShiftAssign,
             RightShiftAssign,
 
+            // Range Tests
+            RangesMatchMasks,
+
             // Conversion Tests
             ConverterTests::ToScalar,
             ConverterTests::ToString<utf8>,
@@ -226,6 +229,38 @@ namespace OptionFlagTests
         SUTL_TEST_SUCCESS( );
     }
 
+    // Range Tests \\
+
+    UnitTestResult RangesMatchMasks( )
+    {
+        OptionFlag globals = OptionFlag::NONE;
+        OptionFlag prefixes = OptionFlag::NONE;
+
+        for ( OptionFlag f = OptionFlag::GLOBAL_BEGIN; f < OptionFlag::GLOBAL_END; f <<= 1 )
+        {
+            globals |= f;
+        }
+
+        for ( OptionFlag f = OptionFlag::GLOBAL_EXT_BEGIN; f < OptionFlag::GLOBAL_EXT_END; f <<= 1 )
+        {
+            globals |= f;
+        }
+
+        for ( OptionFlag f = OptionFlag::PREFIX_BEGIN; f < OptionFlag::PREFIX_END; f <<= 1 )
+        {
+            prefixes |= f;
+        }
+
+        // Iterating the ranges covers exactly the masks, and every option is either global or prefix.
+        SUTL_TEST_ASSERT(globals == OptionFlag::GLOBAL_MASK);
+        SUTL_TEST_ASSERT(prefixes == OptionFlag::PREFIX_MASK);
+        SUTL_TEST_ASSERT((globals & prefixes) == OptionFlag::NONE);
+        SUTL_TEST_ASSERT((globals | prefixes) == OptionFlag::ALL_MASK);
+
+        /// Test Pass!
+        SUTL_TEST_SUCCESS( );
+    }
+
 
     namespace ConverterTests
     {